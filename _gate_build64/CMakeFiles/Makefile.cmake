@@ -0,0 +1,173 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CMakeOptions.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/doxygen.cmake"
+  "/root/repo/cmake/geogram.cmake"
+  "/root/repo/cmake/platforms/Linux-gcc.cmake"
+  "/root/repo/cmake/platforms/Linux.cmake"
+  "/root/repo/cmake/platforms/Linux64-gcc/config.cmake"
+  "/root/repo/cmake/utilities.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/src/bin/CMakeLists.txt"
+  "/root/repo/src/bin/geodump/CMakeLists.txt"
+  "/root/repo/src/bin/vorpacomp/CMakeLists.txt"
+  "/root/repo/src/bin/vorpalite/CMakeLists.txt"
+  "/root/repo/src/bin/vorpastat/CMakeLists.txt"
+  "/root/repo/src/examples/CMakeLists.txt"
+  "/root/repo/src/examples/exploragram/CMakeLists.txt"
+  "/root/repo/src/examples/exploragram/compute_OTM/CMakeLists.txt"
+  "/root/repo/src/examples/exploragram/hexdom_pipeline/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/compute_RVD/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/compute_delaunay/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/manifold_harmonics/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/opennl_LSCM/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/opennl_basic_example/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/opennl_mesh_smooth/CMakeLists.txt"
+  "/root/repo/src/examples/geogram/simple_raytrace/CMakeLists.txt"
+  "/root/repo/src/lib/exploragram/CMakeLists.txt"
+  "/root/repo/src/lib/geogram/CMakeLists.txt"
+  "/root/repo/src/lib/geogram/basic/version.h.in"
+  "/root/repo/src/lib/geogram/geogram.pc.in"
+  "/root/repo/src/lib/geogram/third_party/CMakeLists.txt"
+  "/root/repo/src/lib/third_party/CMakeLists.txt"
+  "/root/repo/src/lib/third_party/numerics/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/tests/bench_load/CMakeLists.txt"
+  "/root/repo/src/tests/bench_spatial_sort/CMakeLists.txt"
+  "/root/repo/src/tests/test_HLBFGS/CMakeLists.txt"
+  "/root/repo/src/tests/test_RVC/CMakeLists.txt"
+  "/root/repo/src/tests/test_convex_cell/CMakeLists.txt"
+  "/root/repo/src/tests/test_expansion_nt/CMakeLists.txt"
+  "/root/repo/src/tests/test_locks/CMakeLists.txt"
+  "/root/repo/src/tests/test_logger/CMakeLists.txt"
+  "/root/repo/src/tests/test_nn_search/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tools/make_package.pl.in"
+  "/root/repo/tools/runpybot.sh.in"
+  "/root/repo/tools/runride.sh.in"
+  "/root/repo/tools/testenv.sh.in"
+  "/root/repo/tools/valgrind.supp"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "cmake_uninstall.cmake"
+  "make_package.pl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "geogram1.pc"
+  "src/lib/geogram/version.h"
+  "src/lib/geogram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/geogram/third_party/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/third_party/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/third_party/numerics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/exploragram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bin/vorpastat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bin/vorpacomp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bin/geodump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bin/vorpalite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_nn_search/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_convex_cell/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/bench_load/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/bench_spatial_sort/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_locks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_expansion_nt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_HLBFGS/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_RVC/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/test_logger/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/compute_delaunay/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/compute_RVD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/opennl_LSCM/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/opennl_mesh_smooth/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/manifold_harmonics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/opennl_basic_example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/geogram/simple_raytrace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/exploragram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/exploragram/hexdom_pipeline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/exploragram/compute_OTM/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/testenv.sh"
+  "tests/runpybot.sh"
+  "tests/runride.sh"
+  "tests/valgrind.supp"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "src/lib/geogram/CMakeFiles/geogram.dir/DependInfo.cmake"
+  "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/DependInfo.cmake"
+  "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/DependInfo.cmake"
+  "src/lib/exploragram/CMakeFiles/exploragram.dir/DependInfo.cmake"
+  "src/bin/vorpastat/CMakeFiles/vorpastat.dir/DependInfo.cmake"
+  "src/bin/vorpacomp/CMakeFiles/vorpacomp.dir/DependInfo.cmake"
+  "src/bin/geodump/CMakeFiles/geodump.dir/DependInfo.cmake"
+  "src/bin/vorpalite/CMakeFiles/vorpalite.dir/DependInfo.cmake"
+  "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/DependInfo.cmake"
+  "src/tests/test_convex_cell/CMakeFiles/test_convex_cell.dir/DependInfo.cmake"
+  "src/tests/bench_load/CMakeFiles/bench_load.dir/DependInfo.cmake"
+  "src/tests/bench_spatial_sort/CMakeFiles/bench_spatial_sort.dir/DependInfo.cmake"
+  "src/tests/test_locks/CMakeFiles/test_locks.dir/DependInfo.cmake"
+  "src/tests/test_expansion_nt/CMakeFiles/test_expansion_nt.dir/DependInfo.cmake"
+  "src/tests/test_HLBFGS/CMakeFiles/test_HLBFGS.dir/DependInfo.cmake"
+  "src/tests/test_RVC/CMakeFiles/test_RVC.dir/DependInfo.cmake"
+  "src/tests/test_logger/CMakeFiles/test_logger.dir/DependInfo.cmake"
+  "src/examples/geogram/compute_delaunay/CMakeFiles/compute_delaunay.dir/DependInfo.cmake"
+  "src/examples/geogram/compute_RVD/CMakeFiles/compute_RVD.dir/DependInfo.cmake"
+  "src/examples/geogram/opennl_LSCM/CMakeFiles/opennl_LSCM.dir/DependInfo.cmake"
+  "src/examples/geogram/opennl_mesh_smooth/CMakeFiles/opennl_mesh_smooth.dir/DependInfo.cmake"
+  "src/examples/geogram/manifold_harmonics/CMakeFiles/manifold_harmonics.dir/DependInfo.cmake"
+  "src/examples/geogram/opennl_basic_example/CMakeFiles/opennl_basic_example.dir/DependInfo.cmake"
+  "src/examples/geogram/simple_raytrace/CMakeFiles/simple_raytrace.dir/DependInfo.cmake"
+  "src/examples/exploragram/hexdom_pipeline/CMakeFiles/hexdom_pipeline.dir/DependInfo.cmake"
+  "src/examples/exploragram/compute_OTM/CMakeFiles/compute_OTM.dir/DependInfo.cmake"
+  )
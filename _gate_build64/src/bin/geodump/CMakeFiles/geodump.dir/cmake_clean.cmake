@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/geodump"
+  "../../../bin/geodump.pdb"
+  "CMakeFiles/geodump.dir/main.cpp.o"
+  "CMakeFiles/geodump.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geodump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
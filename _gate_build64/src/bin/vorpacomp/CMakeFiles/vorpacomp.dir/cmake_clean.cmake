@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/vorpacomp"
+  "../../../bin/vorpacomp.pdb"
+  "CMakeFiles/vorpacomp.dir/main.cpp.o"
+  "CMakeFiles/vorpacomp.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vorpacomp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/vorpalite"
+  "../../../bin/vorpalite.pdb"
+  "CMakeFiles/vorpalite.dir/main.cpp.o"
+  "CMakeFiles/vorpalite.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vorpalite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/vorpastat"
+  "../../../bin/vorpastat.pdb"
+  "CMakeFiles/vorpastat.dir/main.cpp.o"
+  "CMakeFiles/vorpastat.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vorpastat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
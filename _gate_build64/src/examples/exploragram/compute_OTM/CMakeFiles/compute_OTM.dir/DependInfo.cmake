@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/examples/exploragram/compute_OTM/main.cpp" "src/examples/exploragram/compute_OTM/CMakeFiles/compute_OTM.dir/main.cpp.o" "gcc" "src/examples/exploragram/compute_OTM/CMakeFiles/compute_OTM.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build64/src/lib/exploragram/CMakeFiles/exploragram.dir/DependInfo.cmake"
+  "/root/repo/_gate_build64/src/lib/geogram/CMakeFiles/geogram.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
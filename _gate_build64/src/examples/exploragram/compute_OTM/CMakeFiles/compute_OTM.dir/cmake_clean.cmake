@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/compute_OTM"
+  "../../../../bin/compute_OTM.pdb"
+  "CMakeFiles/compute_OTM.dir/main.cpp.o"
+  "CMakeFiles/compute_OTM.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compute_OTM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/hexdom_pipeline"
+  "../../../../bin/hexdom_pipeline.pdb"
+  "CMakeFiles/hexdom_pipeline.dir/main.cpp.o"
+  "CMakeFiles/hexdom_pipeline.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hexdom_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
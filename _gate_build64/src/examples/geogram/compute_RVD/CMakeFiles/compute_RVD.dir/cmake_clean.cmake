@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/compute_RVD"
+  "../../../../bin/compute_RVD.pdb"
+  "CMakeFiles/compute_RVD.dir/main.cpp.o"
+  "CMakeFiles/compute_RVD.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compute_RVD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/compute_delaunay"
+  "../../../../bin/compute_delaunay.pdb"
+  "CMakeFiles/compute_delaunay.dir/main.cpp.o"
+  "CMakeFiles/compute_delaunay.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compute_delaunay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
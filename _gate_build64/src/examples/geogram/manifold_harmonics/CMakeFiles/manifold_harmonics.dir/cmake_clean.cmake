@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/manifold_harmonics"
+  "../../../../bin/manifold_harmonics.pdb"
+  "CMakeFiles/manifold_harmonics.dir/main.cpp.o"
+  "CMakeFiles/manifold_harmonics.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/manifold_harmonics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/opennl_LSCM"
+  "../../../../bin/opennl_LSCM.pdb"
+  "CMakeFiles/opennl_LSCM.dir/main.cpp.o"
+  "CMakeFiles/opennl_LSCM.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opennl_LSCM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/opennl_basic_example"
+  "../../../../bin/opennl_basic_example.pdb"
+  "CMakeFiles/opennl_basic_example.dir/main.c.o"
+  "CMakeFiles/opennl_basic_example.dir/main.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/opennl_basic_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/opennl_mesh_smooth"
+  "../../../../bin/opennl_mesh_smooth.pdb"
+  "CMakeFiles/opennl_mesh_smooth.dir/main.cpp.o"
+  "CMakeFiles/opennl_mesh_smooth.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opennl_mesh_smooth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
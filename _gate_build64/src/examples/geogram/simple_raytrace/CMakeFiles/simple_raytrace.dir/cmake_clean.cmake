@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/simple_raytrace"
+  "../../../../bin/simple_raytrace.pdb"
+  "CMakeFiles/simple_raytrace.dir/main.cpp.o"
+  "CMakeFiles/simple_raytrace.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_raytrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/exploragram/hexdom/FF.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/FF.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/FF.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/FF_visu.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/FF_visu.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/FF_visu.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/PGP.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/PGP.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/PGP.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/basic.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/basic.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/basic.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/cavity.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/cavity.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/cavity.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/extra_connectivity.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/extra_connectivity.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/extra_connectivity.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/frame.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/frame.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/frame.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/geometry.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/geometry.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/geometry.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/hex.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/hex_candidates.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_candidates.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_candidates.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/hex_cruncher.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_cruncher.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_cruncher.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/hex_dominant.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_dominant.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hex_dominant.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/hexdom_pipeline.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hexdom_pipeline.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/hexdom_pipeline.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/intersect_tools.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/intersect_tools.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/intersect_tools.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/mesh_inspector.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/mesh_inspector.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/mesh_inspector.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/mesh_utils.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/mesh_utils.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/mesh_utils.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/meshcomesh.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/meshcomesh.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/meshcomesh.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/polygon.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/polygon.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/polygon.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/preprocessing.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/preprocessing.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/preprocessing.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/quad_cover.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quad_cover.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quad_cover.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/quad_dominant.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quad_dominant.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quad_dominant.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/quadmesher.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quadmesher.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quadmesher.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/quads_from_boundary.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quads_from_boundary.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/quads_from_boundary.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/sphere_model.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/sphere_model.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/sphere_model.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/spherical_harmonics_l4.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/spherical_harmonics_l4.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/spherical_harmonics_l4.cpp.o.d"
+  "/root/repo/src/lib/exploragram/hexdom/time_log.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/time_log.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/hexdom/time_log.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/VSDM.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/VSDM.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/VSDM.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/linear_least_squares.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/linear_least_squares.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/linear_least_squares.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/optimal_transport.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/optimal_transport_2d.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_2d.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_2d.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/optimal_transport_3d.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_3d.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_3d.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/optimal_transport_on_surface.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_on_surface.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_on_surface.cpp.o.d"
+  "/root/repo/src/lib/exploragram/optimal_transport/sampling.cpp" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/sampling.cpp.o" "gcc" "src/lib/exploragram/CMakeFiles/exploragram.dir/optimal_transport/sampling.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build64/src/lib/geogram/CMakeFiles/geogram.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "../../../lib/libexploragram.a"
+  "../../../lib/libexploragram.pdb"
+  "CMakeFiles/exploragram.dir/hexdom/FF.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/FF.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/FF_visu.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/FF_visu.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/PGP.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/PGP.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/basic.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/basic.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/cavity.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/cavity.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/extra_connectivity.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/extra_connectivity.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/frame.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/frame.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/geometry.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/geometry.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/hex.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/hex.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/hex_candidates.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/hex_candidates.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/hex_cruncher.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/hex_cruncher.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/hex_dominant.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/hex_dominant.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/hexdom_pipeline.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/hexdom_pipeline.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/intersect_tools.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/intersect_tools.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/mesh_inspector.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/mesh_inspector.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/mesh_utils.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/mesh_utils.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/meshcomesh.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/meshcomesh.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/polygon.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/polygon.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/preprocessing.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/preprocessing.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/quad_cover.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/quad_cover.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/quad_dominant.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/quad_dominant.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/quadmesher.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/quadmesher.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/quads_from_boundary.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/quads_from_boundary.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/sphere_model.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/sphere_model.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/spherical_harmonics_l4.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/spherical_harmonics_l4.cpp.o.d"
+  "CMakeFiles/exploragram.dir/hexdom/time_log.cpp.o"
+  "CMakeFiles/exploragram.dir/hexdom/time_log.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/VSDM.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/VSDM.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/linear_least_squares.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/linear_least_squares.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_2d.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_2d.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_3d.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_3d.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_on_surface.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/optimal_transport_on_surface.cpp.o.d"
+  "CMakeFiles/exploragram.dir/optimal_transport/sampling.cpp.o"
+  "CMakeFiles/exploragram.dir/optimal_transport/sampling.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exploragram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,130 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/geogram/NL/nl_api.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_api.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_api.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_arpack.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_arpack.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_arpack.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_blas.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_blas.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_blas.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_cholmod.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_cholmod.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_cholmod.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_context.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_context.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_context.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_cuda.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_cuda.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_cuda.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_iterative_solvers.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_iterative_solvers.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_iterative_solvers.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_matrix.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_matrix.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_matrix.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_mkl.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_mkl.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_mkl.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_os.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_os.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_os.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_preconditioners.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_preconditioners.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_preconditioners.c.o.d"
+  "/root/repo/src/lib/geogram/NL/nl_superlu.c" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_superlu.c.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/NL/nl_superlu.c.o.d"
+  "/root/repo/src/lib/geogram/basic/algorithm.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/algorithm.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/algorithm.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/assert.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/assert.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/assert.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/attribute_codecs.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/attribute_codecs.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/attribute_codecs.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/attributes.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/attributes.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/attributes.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/b_stream.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/b_stream.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/b_stream.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/command_line.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/command_line.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/command_line.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/command_line_args.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/command_line_args.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/command_line_args.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/common.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/common.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/common.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/counted.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/counted.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/counted.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/environment.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/environment.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/environment.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/factory.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/factory.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/factory.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/file_system.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/file_system.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/file_system.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/geofile.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/geofile.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/geofile.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/geometry.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/geometry.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/geometry.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/line_stream.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/line_stream.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/line_stream.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/logger.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/logger.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/logger.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/numeric.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/numeric.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/numeric.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/packed_arrays.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/packed_arrays.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/packed_arrays.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/permutation.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/permutation.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/permutation.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/process.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/process_unix.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process_unix.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process_unix.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/process_win.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process_win.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/process_win.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/progress.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/progress.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/progress.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/quaternion.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/quaternion.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/quaternion.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/stopwatch.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/stopwatch.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/stopwatch.cpp.o.d"
+  "/root/repo/src/lib/geogram/basic/string.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/basic/string.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/basic/string.cpp.o.d"
+  "/root/repo/src/lib/geogram/bibliography/bibliography.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/bibliography/bibliography.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/bibliography/bibliography.cpp.o.d"
+  "/root/repo/src/lib/geogram/bibliography/embedded_references.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/bibliography/embedded_references.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/bibliography/embedded_references.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/LFS.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/LFS.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/LFS.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay_2d.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_2d.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_2d.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay_3d.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_3d.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_3d.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay_nn.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_nn.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_nn.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay_tetgen.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_tetgen.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_tetgen.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/delaunay_triangle.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_triangle.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/delaunay_triangle.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/parallel_delaunay_3d.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/parallel_delaunay_3d.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/parallel_delaunay_3d.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/periodic.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/periodic.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/periodic.cpp.o.d"
+  "/root/repo/src/lib/geogram/delaunay/periodic_delaunay_3d.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/periodic_delaunay_3d.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/delaunay/periodic_delaunay_3d.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/colormap.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/colormap.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/colormap.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_library.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_library.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_library.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_rasterizer.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_rasterizer.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_rasterizer.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_serializer.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_serializer_pgm.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_pgm.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_pgm.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_serializer_stb.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_stb.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_stb.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/image_serializer_xpm.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_xpm.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/image_serializer_xpm.cpp.o.d"
+  "/root/repo/src/lib/geogram/image/morpho_math.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/image/morpho_math.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/image/morpho_math.cpp.o.d"
+  "/root/repo/src/lib/geogram/lua/lua_io.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/lua/lua_io.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/lua/lua_io.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_AABB.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_AABB.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_AABB.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_baking.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_baking.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_baking.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_compare.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_compare.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_compare.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_decimate.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_decimate.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_decimate.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_degree3_vertices.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_degree3_vertices.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_degree3_vertices.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_distance.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_distance.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_distance.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_fill_holes.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_fill_holes.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_fill_holes.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_frame_field.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_frame_field.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_frame_field.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_geometry.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_geometry.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_geometry.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_halfedges.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_halfedges.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_halfedges.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_incidence.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_incidence.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_incidence.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_intersection.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_intersection.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_intersection.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_io.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_io.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_io.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_manifold_harmonics.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_manifold_harmonics.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_manifold_harmonics.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_partition.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_partition.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_partition.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_preprocessing.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_preprocessing.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_preprocessing.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_remesh.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_remesh.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_remesh.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_reorder.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_reorder.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_reorder.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_repair.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_repair.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_repair.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_smoothing.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_smoothing.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_smoothing.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_subdivision.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_subdivision.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_subdivision.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_tetrahedralize.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_tetrahedralize.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_tetrahedralize.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/mesh_topology.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_topology.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/mesh_topology.cpp.o.d"
+  "/root/repo/src/lib/geogram/mesh/triangle_intersection.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/triangle_intersection.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/mesh/triangle_intersection.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/expansion_nt.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/expansion_nt.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/expansion_nt.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/lbfgs_optimizers.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/lbfgs_optimizers.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/lbfgs_optimizers.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/matrix_util.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/matrix_util.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/matrix_util.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/multi_precision.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/multi_precision.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/multi_precision.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/optimizer.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/optimizer.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/optimizer.cpp.o.d"
+  "/root/repo/src/lib/geogram/numerics/predicates.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/predicates.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/numerics/predicates.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_ABF.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_ABF.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_ABF.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_LSCM.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_LSCM.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_LSCM.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_PGP_2d.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_PGP_2d.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_PGP_2d.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_atlas_maker.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_atlas_maker.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_atlas_maker.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_global_param.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_global_param.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_global_param.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_param_packer.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_param_packer.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_param_packer.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_param_validator.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_param_validator.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_param_validator.cpp.o.d"
+  "/root/repo/src/lib/geogram/parameterization/mesh_segmentation.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_segmentation.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/parameterization/mesh_segmentation.cpp.o.d"
+  "/root/repo/src/lib/geogram/points/co3ne.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/points/co3ne.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/points/co3ne.cpp.o.d"
+  "/root/repo/src/lib/geogram/points/colocate.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/points/colocate.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/points/colocate.cpp.o.d"
+  "/root/repo/src/lib/geogram/points/kd_tree.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/points/kd_tree.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/points/kd_tree.cpp.o.d"
+  "/root/repo/src/lib/geogram/points/nn_search.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/points/nn_search.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/points/nn_search.cpp.o.d"
+  "/root/repo/src/lib/geogram/points/principal_axes.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/points/principal_axes.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/points/principal_axes.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/CVT.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/CVT.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/CVT.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/RVD.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/RVD_callback.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD_callback.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD_callback.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/RVD_mesh_builder.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD_mesh_builder.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/RVD_mesh_builder.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/convex_cell.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/convex_cell.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/convex_cell.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/generic_RVD_cell.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/generic_RVD_cell.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/generic_RVD_cell.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/generic_RVD_polygon.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/generic_RVD_polygon.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/generic_RVD_polygon.cpp.o.d"
+  "/root/repo/src/lib/geogram/voronoi/integration_simplex.cpp" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/integration_simplex.cpp.o" "gcc" "src/lib/geogram/CMakeFiles/geogram.dir/voronoi/integration_simplex.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,233 @@
+file(REMOVE_RECURSE
+  "../../../lib/libgeogram.a"
+  "../../../lib/libgeogram.pdb"
+  "CMakeFiles/geogram.dir/NL/nl_api.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_api.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_arpack.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_arpack.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_blas.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_blas.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_cholmod.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_cholmod.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_context.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_context.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_cuda.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_cuda.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_iterative_solvers.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_iterative_solvers.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_matrix.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_matrix.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_mkl.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_mkl.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_os.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_os.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_preconditioners.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_preconditioners.c.o.d"
+  "CMakeFiles/geogram.dir/NL/nl_superlu.c.o"
+  "CMakeFiles/geogram.dir/NL/nl_superlu.c.o.d"
+  "CMakeFiles/geogram.dir/basic/algorithm.cpp.o"
+  "CMakeFiles/geogram.dir/basic/algorithm.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/assert.cpp.o"
+  "CMakeFiles/geogram.dir/basic/assert.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/attribute_codecs.cpp.o"
+  "CMakeFiles/geogram.dir/basic/attribute_codecs.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/attributes.cpp.o"
+  "CMakeFiles/geogram.dir/basic/attributes.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/b_stream.cpp.o"
+  "CMakeFiles/geogram.dir/basic/b_stream.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/command_line.cpp.o"
+  "CMakeFiles/geogram.dir/basic/command_line.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/command_line_args.cpp.o"
+  "CMakeFiles/geogram.dir/basic/command_line_args.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/common.cpp.o"
+  "CMakeFiles/geogram.dir/basic/common.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/counted.cpp.o"
+  "CMakeFiles/geogram.dir/basic/counted.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/environment.cpp.o"
+  "CMakeFiles/geogram.dir/basic/environment.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/factory.cpp.o"
+  "CMakeFiles/geogram.dir/basic/factory.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/file_system.cpp.o"
+  "CMakeFiles/geogram.dir/basic/file_system.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/geofile.cpp.o"
+  "CMakeFiles/geogram.dir/basic/geofile.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/geometry.cpp.o"
+  "CMakeFiles/geogram.dir/basic/geometry.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/line_stream.cpp.o"
+  "CMakeFiles/geogram.dir/basic/line_stream.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/logger.cpp.o"
+  "CMakeFiles/geogram.dir/basic/logger.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/numeric.cpp.o"
+  "CMakeFiles/geogram.dir/basic/numeric.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/packed_arrays.cpp.o"
+  "CMakeFiles/geogram.dir/basic/packed_arrays.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/permutation.cpp.o"
+  "CMakeFiles/geogram.dir/basic/permutation.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/process.cpp.o"
+  "CMakeFiles/geogram.dir/basic/process.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/process_unix.cpp.o"
+  "CMakeFiles/geogram.dir/basic/process_unix.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/process_win.cpp.o"
+  "CMakeFiles/geogram.dir/basic/process_win.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/progress.cpp.o"
+  "CMakeFiles/geogram.dir/basic/progress.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/quaternion.cpp.o"
+  "CMakeFiles/geogram.dir/basic/quaternion.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/stopwatch.cpp.o"
+  "CMakeFiles/geogram.dir/basic/stopwatch.cpp.o.d"
+  "CMakeFiles/geogram.dir/basic/string.cpp.o"
+  "CMakeFiles/geogram.dir/basic/string.cpp.o.d"
+  "CMakeFiles/geogram.dir/bibliography/bibliography.cpp.o"
+  "CMakeFiles/geogram.dir/bibliography/bibliography.cpp.o.d"
+  "CMakeFiles/geogram.dir/bibliography/embedded_references.cpp.o"
+  "CMakeFiles/geogram.dir/bibliography/embedded_references.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/LFS.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/LFS.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_2d.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_2d.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_3d.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_3d.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_nn.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_nn.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_tetgen.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_tetgen.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_triangle.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/delaunay_triangle.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/parallel_delaunay_3d.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/parallel_delaunay_3d.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/periodic.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/periodic.cpp.o.d"
+  "CMakeFiles/geogram.dir/delaunay/periodic_delaunay_3d.cpp.o"
+  "CMakeFiles/geogram.dir/delaunay/periodic_delaunay_3d.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/colormap.cpp.o"
+  "CMakeFiles/geogram.dir/image/colormap.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image.cpp.o"
+  "CMakeFiles/geogram.dir/image/image.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_library.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_library.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_rasterizer.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_rasterizer.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_serializer.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_serializer.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_serializer_pgm.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_serializer_pgm.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_serializer_stb.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_serializer_stb.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/image_serializer_xpm.cpp.o"
+  "CMakeFiles/geogram.dir/image/image_serializer_xpm.cpp.o.d"
+  "CMakeFiles/geogram.dir/image/morpho_math.cpp.o"
+  "CMakeFiles/geogram.dir/image/morpho_math.cpp.o.d"
+  "CMakeFiles/geogram.dir/lua/lua_io.cpp.o"
+  "CMakeFiles/geogram.dir/lua/lua_io.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_AABB.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_AABB.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_baking.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_baking.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_compare.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_compare.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_decimate.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_decimate.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_degree3_vertices.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_degree3_vertices.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_distance.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_distance.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_fill_holes.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_fill_holes.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_frame_field.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_frame_field.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_geometry.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_geometry.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_halfedges.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_halfedges.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_incidence.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_incidence.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_intersection.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_intersection.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_io.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_io.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_manifold_harmonics.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_manifold_harmonics.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_partition.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_partition.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_preprocessing.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_preprocessing.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_remesh.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_remesh.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_reorder.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_reorder.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_repair.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_repair.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_smoothing.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_smoothing.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_subdivision.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_subdivision.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_tetrahedralize.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_tetrahedralize.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/mesh_topology.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/mesh_topology.cpp.o.d"
+  "CMakeFiles/geogram.dir/mesh/triangle_intersection.cpp.o"
+  "CMakeFiles/geogram.dir/mesh/triangle_intersection.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/expansion_nt.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/expansion_nt.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/lbfgs_optimizers.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/lbfgs_optimizers.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/matrix_util.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/matrix_util.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/multi_precision.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/multi_precision.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/optimizer.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/optimizer.cpp.o.d"
+  "CMakeFiles/geogram.dir/numerics/predicates.cpp.o"
+  "CMakeFiles/geogram.dir/numerics/predicates.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_ABF.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_ABF.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_LSCM.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_LSCM.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_PGP_2d.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_PGP_2d.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_atlas_maker.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_atlas_maker.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_global_param.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_global_param.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_param_packer.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_param_packer.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_param_validator.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_param_validator.cpp.o.d"
+  "CMakeFiles/geogram.dir/parameterization/mesh_segmentation.cpp.o"
+  "CMakeFiles/geogram.dir/parameterization/mesh_segmentation.cpp.o.d"
+  "CMakeFiles/geogram.dir/points/co3ne.cpp.o"
+  "CMakeFiles/geogram.dir/points/co3ne.cpp.o.d"
+  "CMakeFiles/geogram.dir/points/colocate.cpp.o"
+  "CMakeFiles/geogram.dir/points/colocate.cpp.o.d"
+  "CMakeFiles/geogram.dir/points/kd_tree.cpp.o"
+  "CMakeFiles/geogram.dir/points/kd_tree.cpp.o.d"
+  "CMakeFiles/geogram.dir/points/nn_search.cpp.o"
+  "CMakeFiles/geogram.dir/points/nn_search.cpp.o.d"
+  "CMakeFiles/geogram.dir/points/principal_axes.cpp.o"
+  "CMakeFiles/geogram.dir/points/principal_axes.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/CVT.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/CVT.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/RVD.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/RVD.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/RVD_callback.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/RVD_callback.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/RVD_mesh_builder.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/RVD_mesh_builder.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/convex_cell.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/convex_cell.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/generic_RVD_cell.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/generic_RVD_cell.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/generic_RVD_polygon.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/generic_RVD_polygon.cpp.o.d"
+  "CMakeFiles/geogram.dir/voronoi/integration_simplex.cpp.o"
+  "CMakeFiles/geogram.dir/voronoi/integration_simplex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/geogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
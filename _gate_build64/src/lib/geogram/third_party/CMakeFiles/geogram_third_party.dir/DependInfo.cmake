@@ -0,0 +1,80 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/geogram/third_party/LM7/libmeshb7.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/LM7/libmeshb7.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/LM7/libmeshb7.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lapi.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lapi.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lapi.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lauxlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lauxlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lauxlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lbaselib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lbaselib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lbaselib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lbitlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lbitlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lbitlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lcode.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lcode.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lcode.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lcorolib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lcorolib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lcorolib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lctype.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lctype.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lctype.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ldblib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldblib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldblib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ldebug.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldebug.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldebug.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ldo.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldo.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldo.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ldump.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldump.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ldump.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lfunc.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lfunc.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lfunc.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lgc.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lgc.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lgc.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/linit.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/linit.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/linit.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/liolib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/liolib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/liolib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/llex.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/llex.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/llex.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lmathlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lmathlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lmathlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lmem.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lmem.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lmem.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/loadlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/loadlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/loadlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lobject.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lobject.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lobject.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lopcodes.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lopcodes.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lopcodes.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/loslib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/loslib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/loslib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lparser.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lparser.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lparser.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lstate.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstate.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstate.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lstring.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstring.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstring.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lstrlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstrlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lstrlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ltable.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltable.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltable.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ltablib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltablib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltablib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/ltm.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltm.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/ltm.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lundump.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lundump.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lundump.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lutf8lib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lutf8lib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lutf8lib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lvm.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lvm.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lvm.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/lua/lzio.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lzio.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/lua/lzio.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/rply/rply.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/rply/rply.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/rply/rply.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/triangle/triangle.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/triangle/triangle.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/triangle/triangle.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/adler32.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/adler32.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/adler32.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/compress.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/compress.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/compress.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/crc32.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/crc32.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/crc32.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/deflate.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/deflate.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/deflate.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/gzclose.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzclose.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzclose.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/gzlib.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzlib.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzlib.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/gzread.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzread.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzread.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/gzwrite.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzwrite.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/gzwrite.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/inffast.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inffast.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inffast.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/inflate.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inflate.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inflate.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/inftrees.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inftrees.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/inftrees.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/trees.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/trees.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/trees.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/uncompr.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/uncompr.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/uncompr.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/zlib/zutil.c" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/zutil.c.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/zlib/zutil.c.o.d"
+  "/root/repo/src/lib/geogram/third_party/HLBFGS/HLBFGS.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/HLBFGS/HLBFGS_BLAS.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS_BLAS.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS_BLAS.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/HLBFGS/ICFS.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/ICFS.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/ICFS.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/HLBFGS/LineSearch.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/LineSearch.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/LineSearch.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/HLBFGS/Lite_Sparse_Matrix.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/Lite_Sparse_Matrix.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/HLBFGS/Lite_Sparse_Matrix.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/PoissonRecon/Factor.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/Factor.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/Factor.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/PoissonRecon/Geometry.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/Geometry.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/Geometry.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/PoissonRecon/MarchingCubes.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/MarchingCubes.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/MarchingCubes.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/PoissonRecon/poisson_geogram.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/poisson_geogram.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/PoissonRecon/poisson_geogram.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/gzstream/gzstream.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/gzstream/gzstream.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/gzstream/gzstream.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/tetgen/tetgen.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/tetgen/tetgen.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/tetgen/tetgen.cpp.o.d"
+  "/root/repo/src/lib/geogram/third_party/xatlas/xatlas.cpp" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/xatlas/xatlas.cpp.o" "gcc" "src/lib/geogram/third_party/CMakeFiles/geogram_third_party.dir/xatlas/xatlas.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,131 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS_BLAS.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/HLBFGS_BLAS.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/ICFS.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/ICFS.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/LineSearch.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/LineSearch.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/Lite_Sparse_Matrix.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/HLBFGS/Lite_Sparse_Matrix.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/LM7/libmeshb7.c.o"
+  "CMakeFiles/geogram_third_party.dir/LM7/libmeshb7.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/Factor.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/Factor.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/Geometry.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/Geometry.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/MarchingCubes.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/MarchingCubes.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/poisson_geogram.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/PoissonRecon/poisson_geogram.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/gzstream/gzstream.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/gzstream/gzstream.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lapi.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lapi.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lauxlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lauxlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lbaselib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lbaselib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lbitlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lbitlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lcode.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lcode.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lcorolib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lcorolib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lctype.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lctype.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ldblib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ldblib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ldebug.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ldebug.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ldo.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ldo.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ldump.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ldump.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lfunc.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lfunc.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lgc.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lgc.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/linit.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/linit.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/liolib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/liolib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/llex.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/llex.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lmathlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lmathlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lmem.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lmem.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/loadlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/loadlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lobject.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lobject.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lopcodes.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lopcodes.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/loslib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/loslib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lparser.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lparser.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lstate.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lstate.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lstring.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lstring.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lstrlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lstrlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ltable.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ltable.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ltablib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ltablib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/ltm.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/ltm.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lundump.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lundump.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lutf8lib.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lutf8lib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lvm.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lvm.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/lua/lzio.c.o"
+  "CMakeFiles/geogram_third_party.dir/lua/lzio.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/rply/rply.c.o"
+  "CMakeFiles/geogram_third_party.dir/rply/rply.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/tetgen/tetgen.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/tetgen/tetgen.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/triangle/triangle.c.o"
+  "CMakeFiles/geogram_third_party.dir/triangle/triangle.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/xatlas/xatlas.cpp.o"
+  "CMakeFiles/geogram_third_party.dir/xatlas/xatlas.cpp.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/adler32.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/adler32.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/compress.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/compress.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/crc32.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/crc32.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/deflate.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/deflate.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzclose.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzclose.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzlib.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzlib.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzread.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzread.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzwrite.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/gzwrite.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/inffast.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/inffast.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/inflate.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/inflate.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/inftrees.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/inftrees.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/trees.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/trees.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/uncompr.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/uncompr.c.o.d"
+  "CMakeFiles/geogram_third_party.dir/zlib/zutil.c.o"
+  "CMakeFiles/geogram_third_party.dir/zlib/zutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/geogram_third_party.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+
+#ifndef GEOGRAM_BASIC_VERSION
+#define GEOGRAM_BASIC_VERSION
+
+#define VORPALINE_VERSION_MAJOR "1"
+#define VORPALINE_VERSION_MINOR "7"
+#define VORPALINE_VERSION_PATCH "3"
+#define VORPALINE_VERSION "1.7.3"
+#define VORPALINE_BUILD_NUMBER ""
+#define VORPALINE_BUILD_DATE "2026-10-18 15:29:38"
+#define VORPALINE_SVN_REVISION ""
+
+#endif
+
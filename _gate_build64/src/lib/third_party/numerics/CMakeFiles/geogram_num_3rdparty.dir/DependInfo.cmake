@@ -0,0 +1,720 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cgetv0.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cgetv0.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cgetv0.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cnaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cnapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cnaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cnaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cneigh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneigh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneigh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cneupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cngets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cngets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cngets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/csortc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/csortc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/csortc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/cstatn.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cstatn.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cstatn.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dgetv0.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dgetv0.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dgetv0.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dlaqrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dlaqrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dlaqrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnaupe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dnconv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnconv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnconv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dneigh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneigh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneigh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dneupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dngets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dngets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dngets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsconv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsconv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsconv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dseigt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseigt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseigt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsesrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsesrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsesrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dseupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsgets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsgets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsgets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsortc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dsortr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dstatn.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstatn.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstatn.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dstats.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstats.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstats.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/dstqrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstqrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstqrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sgetv0.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sgetv0.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sgetv0.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/slaqrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/slaqrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/slaqrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snaupe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/snconv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snconv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snconv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sneigh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneigh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneigh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sneupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sngets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sngets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sngets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssconv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssconv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssconv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sseigt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseigt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseigt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssesrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssesrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssesrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sseupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssgets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssgets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssgets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssortc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/ssortr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sstatn.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstatn.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstatn.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sstats.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstats.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstats.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/sstqrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstqrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstqrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zgetv0.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zgetv0.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zgetv0.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/znaitr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaitr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaitr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/znapps.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znapps.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znapps.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/znaup2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaup2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaup2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/znaupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zneigh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneigh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneigh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zneupd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneupd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneupd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zngets.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zngets.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zngets.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zsortc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zsortc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zsortc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK/zstatn.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zstatn.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zstatn.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/cmout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cmout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cmout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/cvout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cvout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cvout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/dmout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dmout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dmout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/dvout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dvout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dvout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/icnteq.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icnteq.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icnteq.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/icopy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icopy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icopy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/iset.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iset.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iset.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/iswap.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iswap.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iswap.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/ivout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/ivout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/ivout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/second.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/second.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/second.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/smout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/smout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/smout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/svout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/svout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/svout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/zmout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zmout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zmout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/ARPACK_UTIL/zvout.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zvout.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zvout.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/caxpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/caxpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/caxpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ccopy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ccopy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ccopy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cdotc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cdotu.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotu.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotu.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cgbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cgemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cgemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cgerc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgerc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgerc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cgeru.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgeru.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgeru.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cher.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cher2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cher2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cherk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cherk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cherk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chpr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/chpr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/crotg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/crotg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/crotg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/csrot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csrot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csrot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/csscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/cswap.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cswap.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cswap.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/csymm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csymm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csymm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/csyr2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyr2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyr2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/csyrk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyrk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyrk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctbsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctpsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctrmm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctrmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctrsm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ctrsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dasum.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dasum.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dasum.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/daxpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/daxpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/daxpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dcabs1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcabs1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcabs1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dcopy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcopy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcopy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ddot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ddot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ddot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dgbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dgemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dgemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dger.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dger.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dger.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dnrm2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dnrm2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dnrm2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/drot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/drotg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/drotm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/drotmg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotmg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotmg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsdot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsdot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsdot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dspmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dspr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dspr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dswap.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dswap.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dswap.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsymm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsymv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsyr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsyr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsyr2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dsyrk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyrk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyrk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtbsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtpsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtrmm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtrmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtrsm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dtrsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dzasum.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dzasum.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dzasum.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/dznrm2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dznrm2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dznrm2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/icamax.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/icamax.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/icamax.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/idamax.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/idamax.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/idamax.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/isamax.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/isamax.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/isamax.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/izamax.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/izamax.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/izamax.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/lsame.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/lsame.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/lsame.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sasum.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sasum.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sasum.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/saxpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/saxpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/saxpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/scabs1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scabs1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scabs1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/scasum.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scasum.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scasum.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/scnrm2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scnrm2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scnrm2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/scopy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scopy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scopy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sdot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sdsdot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdsdot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdsdot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sgbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sgemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sgemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sger.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sger.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sger.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/snrm2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/snrm2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/snrm2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/srot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/srotg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/srotm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/srotmg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotmg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotmg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sspmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sspr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sspr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/sswap.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sswap.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sswap.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssymm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssymv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssyr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssyr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssyr2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ssyrk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyrk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyrk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/stbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/stbsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/stpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/stpsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/strmm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/strmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/strsm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/strsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/xerbla.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/xerbla_array.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla_array.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla_array.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zaxpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zaxpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zaxpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zcopy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zcopy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zcopy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zdotc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zdotu.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotu.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotu.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zdrot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdrot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdrot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zdscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zgbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zgemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zgemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zgerc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgerc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgerc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zgeru.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgeru.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgeru.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhemm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhemv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zher.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zher2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zher2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zherk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zherk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zherk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhpr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zhpr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zrotg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zrotg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zrotg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zscal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zscal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zscal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zswap.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zswap.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zswap.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zsymm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsymm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsymm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zsyr2k.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyr2k.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyr2k.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/zsyrk.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyrk.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyrk.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztbmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztbsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztpmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztpsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztrmm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztrmv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztrsm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CBLAS/ztrsv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/cgeqr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cgeqr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cgeqr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clacn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clacpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/cladiv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cladiv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cladiv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clahqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clahqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clahqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clange.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clange.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clange.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clanhs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clanhs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clanhs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clarf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clarfg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clarfp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clarnv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarnv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarnv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clartg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clartg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clartg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clascl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clascl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clascl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/claset.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/claset.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/claset.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/classq.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/classq.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/classq.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/clatrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clatrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clatrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/crot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/crot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/crot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ctrevc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrevc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrevc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ctrexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ctrsen.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsen.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsen.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ctrsyl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsyl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsyl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/cunm2r.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cunm2r.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cunm2r.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dgeqr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dgeqr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dgeqr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/disnan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/disnan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/disnan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlabad.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlabad.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlabad.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlacn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlacpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dladiv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dladiv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dladiv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlae2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlae2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlae2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaev2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaev2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaev2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlahqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlahqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlahqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaisnan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaisnan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaisnan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaln2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaln2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaln2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlamch.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlamch.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlamch.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlange.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlange.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlange.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlanhs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanhs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanhs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlanst.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanst.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanst.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlanv2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanv2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanv2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlapy2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlapy3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlarf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlarfg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlarfp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlarfx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlarnv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarnv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarnv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlartg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlartg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlartg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaruv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaruv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaruv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlascl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlascl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlascl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlaset.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaset.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaset.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlasr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlasrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlassq.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlassq.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlassq.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dlasy2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasy2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasy2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dorm2r.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dorm2r.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dorm2r.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dsteqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dsteqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dsteqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dtrevc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrevc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrevc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dtrexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dtrsen.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsen.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsen.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dtrsyl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsyl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsyl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dummy_argc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dummy_argc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dummy_argc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/dzsum1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dzsum1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dzsum1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/icmax1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/icmax1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/icmax1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilaclc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilaclr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/iladlc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/iladlr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilaslc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilaslr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilazlc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ilazlr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/izmax1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/izmax1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/izmax1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/scsum1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/scsum1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/scsum1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/sgeqr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sgeqr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sgeqr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/sisnan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sisnan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sisnan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slabad.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slabad.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slabad.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slacn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slacpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/sladiv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sladiv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sladiv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slae2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slae2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slae2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaev2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaev2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaev2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slahqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slahqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slahqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaisnan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaisnan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaisnan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaln2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaln2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaln2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slamch.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slamch.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slamch.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slange.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slange.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slange.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slanhs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanhs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanhs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slanst.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanst.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanst.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slanv2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanv2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanv2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slapy2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slapy3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slarf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slarfg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slarfp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slarfx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slarnv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarnv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarnv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slartg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slartg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slartg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaruv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaruv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaruv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slascl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slascl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slascl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slaset.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaset.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaset.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slasr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slasrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slassq.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slassq.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slassq.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/slasy2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasy2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasy2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/sorm2r.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sorm2r.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sorm2r.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ssteqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ssteqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ssteqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/strevc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strevc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strevc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/strexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/strsen.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsen.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsen.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/strsyl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsyl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsyl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zgeqr2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zgeqr2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zgeqr2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlacn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlacpy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacpy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacpy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zladiv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zladiv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zladiv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlahqr.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlahqr.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlahqr.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlange.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlange.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlange.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlanhs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlanhs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlanhs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlarf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlarfg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlarfp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlarnv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarnv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarnv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlartg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlartg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlartg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlascl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlascl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlascl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlaset.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlaset.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlaset.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlassq.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlassq.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlassq.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zlatrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlatrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlatrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zrot.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zrot.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zrot.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ztrevc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrevc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrevc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ztrexc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrexc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrexc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ztrsen.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsen.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsen.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/ztrsyl.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsyl.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsyl.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/CLAPACK/zunm2r.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zunm2r.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zunm2r.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/abort_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/abort_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/abort_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/backspac.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/backspac.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/backspac.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_cos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_cos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_cos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_div.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_div.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_div.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_exp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_exp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_exp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_log.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_log.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_log.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_sin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/c_sqrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sqrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sqrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/cabs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/cabs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/cabs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/close.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/close.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/close.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/ctype.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ctype.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ctype.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_acos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_acos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_acos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_asin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_asin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_asin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_atan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_atn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_cnjg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cnjg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cnjg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_cos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_cosh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cosh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cosh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_dim.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_dim.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_dim.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_exp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_exp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_exp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_imag.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_imag.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_imag.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_int.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_int.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_int.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_lg10.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_lg10.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_lg10.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_log.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_log.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_log.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_mod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_mod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_mod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_nint.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_nint.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_nint.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_prod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_prod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_prod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_sign.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sign.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sign.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_sin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_sinh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sinh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sinh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_sqrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sqrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sqrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_tan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/d_tanh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tanh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tanh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/derf_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derf_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derf_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/derfc_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derfc_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derfc_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/dfe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dfe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dfe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/dolio.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dolio.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dolio.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/dtime_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dtime_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dtime_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/due.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/due.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/due.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/ef1asc_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1asc_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1asc_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/ef1cmc_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1cmc_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1cmc_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/endfile.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/endfile.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/endfile.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/erf_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erf_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erf_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/erfc_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erfc_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erfc_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/err.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/err.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/err.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/etime_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/etime_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/etime_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/exit_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/exit_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/exit_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/f77_aloc.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77_aloc.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77_aloc.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/f77vers.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77vers.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77vers.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/fmt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/fmtlib.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmtlib.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmtlib.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/ftell_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ftell_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ftell_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/getarg_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getarg_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getarg_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/getenv_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getenv_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getenv_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_dim.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dim.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dim.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_dnnt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dnnt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dnnt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_indx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_indx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_indx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_len.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_len.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_len.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_mod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_mod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_mod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_nint.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_nint.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_nint.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/h_sign.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_sign.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_sign.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/hl_ge.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_ge.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_ge.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/hl_gt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_gt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_gt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/hl_le.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_le.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_le.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/hl_lt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_lt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_lt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i77vers.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i77vers.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i77vers.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_ceiling.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_ceiling.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_ceiling.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_dim.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dim.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dim.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_dnnt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dnnt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dnnt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_indx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_indx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_indx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_len.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_len_trim.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len_trim.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len_trim.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_mod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_mod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_mod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_nint.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_nint.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_nint.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/i_sign.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_sign.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_sign.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/iargc_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iargc_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iargc_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/iio.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iio.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iio.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/ilnw.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ilnw.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ilnw.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/inquire.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/inquire.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/inquire.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/l_ge.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_ge.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_ge.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/l_gt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_gt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_gt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/l_le.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_le.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_le.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/l_lt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_lt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_lt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/lbitbits.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitbits.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitbits.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/lbitshft.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitshft.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitshft.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/lread.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lread.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lread.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/lwrite.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lwrite.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lwrite.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/missing_erf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/missing_erf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/missing_erf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/open.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/open.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/open.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_ci.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ci.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ci.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_dd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_dd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_dd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_di.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_di.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_di.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_hh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_hh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_hh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_ii.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ii.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ii.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_ri.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ri.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ri.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_zi.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zi.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zi.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/pow_zz.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zz.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zz.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_acos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_acos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_acos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_asin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_asin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_asin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_atan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_atn2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atn2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atn2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_cnjg.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cnjg.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cnjg.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_cos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_cosh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cosh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cosh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_dim.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_dim.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_dim.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_exp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_exp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_exp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_imag.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_imag.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_imag.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_int.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_int.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_int.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_lg10.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_lg10.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_lg10.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_log.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_log.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_log.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_mod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_mod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_mod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_nint.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_nint.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_nint.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_sign.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sign.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sign.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_sin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_sinh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sinh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sinh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_sqrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sqrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sqrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_tan.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tan.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tan.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/r_tanh.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tanh.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tanh.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/rdfmt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rdfmt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rdfmt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/rewind.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rewind.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rewind.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/rsfe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsfe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsfe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/rsli.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsli.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsli.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/rsne.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsne.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsne.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_cat.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cat.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cat.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_cmp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cmp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cmp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_copy.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_copy.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_copy.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_paus.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_paus.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_paus.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_rnge.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_rnge.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_rnge.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/s_stop.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_stop.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_stop.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/sfe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sfe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sfe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/sig_die.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sig_die.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sig_die.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/signal_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signal_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signal_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/signbit.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signbit.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signbit.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/sue.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sue.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sue.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/system_.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/system_.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/system_.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/typesize.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/typesize.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/typesize.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/uio.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uio.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uio.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/uninit.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uninit.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uninit.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/util.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/util.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/util.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/wref.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wref.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wref.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/wrtfmt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wrtfmt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wrtfmt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/wsfe.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsfe.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsfe.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/wsle.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsle.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsle.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/wsne.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsne.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsne.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/xwsne.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/xwsne.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/xwsne.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_abs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_abs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_abs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_cos.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_cos.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_cos.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_div.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_div.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_div.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_exp.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_exp.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_exp.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_log.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_log.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_log.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_sin.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sin.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sin.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/LIBF2C/z_sqrt.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sqrt.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sqrt.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ccolumn_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ccolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ccopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cdiagonal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cdiagonal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cdiagonal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgscon.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgscon.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgscon.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgsequ.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsequ.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsequ.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgsisx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsisx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsisx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgsitrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsitrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsitrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgsrfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsrfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsrfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgssv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgssvx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssvx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssvx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgstrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cgstrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/clacon2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clacon2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clacon2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/clangs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clangs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clangs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/claqgs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/claqgs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/claqgs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cldperm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cldperm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cldperm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cmemory.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmemory.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmemory.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cmyblas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmyblas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmyblas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/colamd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/colamd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/colamd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cpanel_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cpivotgrowth.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotgrowth.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotgrowth.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cpruneL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpruneL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpruneL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/creadhb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadhb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadhb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/creadrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/creadtriple.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadtriple.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadtriple.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/csnode_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/csnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/csp_blas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/csp_blas3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/cutil.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cutil.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cutil.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dcolumn_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dcolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dcomplex.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcomplex.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcomplex.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dcopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ddiagonal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ddiagonal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ddiagonal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgscon.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgscon.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgscon.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgsequ.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsequ.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsequ.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgsisx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsisx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsisx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgsitrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsitrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsitrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgsrfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsrfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsrfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgssv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgssvx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssvx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssvx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgstrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dgstrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dlacon2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlacon2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlacon2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dlangs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlangs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlangs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dlaqgs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlaqgs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlaqgs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dldperm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dldperm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dldperm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dmach.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmach.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmach.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dmemory.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmemory.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmemory.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dmyblas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmyblas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmyblas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dpanel_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dpivotgrowth.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotgrowth.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotgrowth.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dpruneL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpruneL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpruneL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dreadhb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadhb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadhb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dreadrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dreadtriple.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadtriple.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadtriple.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dsnode_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dsnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dsp_blas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dsp_blas3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dutil.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dutil.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dutil.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/dzsum1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dzsum1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dzsum1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/get_perm_c.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/get_perm_c.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/get_perm_c.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/heap_relax_snode.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/heap_relax_snode.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/heap_relax_snode.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/icmax1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/icmax1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/icmax1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_ccolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_ccopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_cdrop_row.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cdrop_row.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cdrop_row.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_cpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_cpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_csnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_csnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_csnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_dcolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_dcopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_ddrop_row.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ddrop_row.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ddrop_row.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_dpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_dpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_dsnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dsnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dsnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_heap_relax_snode.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_heap_relax_snode.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_heap_relax_snode.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_relax_snode.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_relax_snode.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_relax_snode.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_scolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_scopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_sdrop_row.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_sdrop_row.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_sdrop_row.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_spanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_spivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_ssnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ssnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ssnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zcolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zcopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zdrop_row.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zdrop_row.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zdrop_row.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ilu_zsnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zsnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zsnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/input_error.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/input_error.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/input_error.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/izmax1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/izmax1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/izmax1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/mark_relax.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mark_relax.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mark_relax.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/mc64ad.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mc64ad.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mc64ad.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/memory.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/memory.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/memory.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/mmd.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mmd.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mmd.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/qselect.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/qselect.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/qselect.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/relax_snode.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/relax_snode.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/relax_snode.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/scolumn_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/scolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/scomplex.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scomplex.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scomplex.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/scopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/scsum1.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scsum1.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scsum1.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sdiagonal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sdiagonal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sdiagonal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgscon.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgscon.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgscon.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgsequ.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsequ.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsequ.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgsisx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsisx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsisx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgsitrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsitrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsitrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgsrfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsrfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsrfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgssv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgssvx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssvx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssvx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgstrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sgstrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/slacon2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slacon2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slacon2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/slangs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slangs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slangs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/slaqgs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slaqgs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slaqgs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sldperm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sldperm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sldperm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/smach.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smach.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smach.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/smemory.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smemory.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smemory.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/smyblas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smyblas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smyblas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sp_coletree.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_coletree.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_coletree.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sp_ienv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_ienv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_ienv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sp_preorder.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_preorder.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_preorder.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/spanel_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/spanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/spivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/spivotgrowth.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotgrowth.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotgrowth.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/spruneL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spruneL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spruneL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sreadhb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadhb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadhb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sreadrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sreadtriple.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadtriple.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadtriple.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ssnode_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ssnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ssp_blas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/ssp_blas3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/superlu_timer.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/superlu_timer.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/superlu_timer.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/sutil.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sutil.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sutil.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/util.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/util.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/util.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zcolumn_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zcolumn_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zcopy_to_ucol.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcopy_to_ucol.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcopy_to_ucol.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zdiagonal.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zdiagonal.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zdiagonal.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgscon.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgscon.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgscon.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgsequ.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsequ.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsequ.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgsisx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsisx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsisx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgsitrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsitrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsitrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgsrfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsrfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsrfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgssv.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssv.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssv.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgssvx.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssvx.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssvx.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgstrf.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrf.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrf.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zgstrs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zlacon2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlacon2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlacon2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zlangs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlangs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlangs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zlaqgs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlaqgs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlaqgs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zldperm.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zldperm.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zldperm.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zmemory.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmemory.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmemory.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zmyblas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmyblas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmyblas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zpanel_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zpanel_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zpivotL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zpivotgrowth.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotgrowth.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotgrowth.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zpruneL.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpruneL.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpruneL.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zreadhb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadhb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadhb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zreadrb.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadrb.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadrb.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zreadtriple.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadtriple.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadtriple.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zsnode_bmod.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_bmod.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_bmod.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zsnode_dfs.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_dfs.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_dfs.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zsp_blas2.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas2.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas2.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zsp_blas3.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas3.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas3.c.o.d"
+  "/root/repo/src/lib/third_party/numerics/SUPERLU/zutil.c" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zutil.c.o" "gcc" "src/lib/third_party/numerics/CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,1413 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libgeogram_num_3rdparty.a"
+  "../../../../lib/libgeogram_num_3rdparty.pdb"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cgetv0.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cgetv0.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cnaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneigh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneigh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cneupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cngets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cngets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/csortc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/csortc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cstatn.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/cstatn.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dgetv0.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dgetv0.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dlaqrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dlaqrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnaupe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnconv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dnconv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneigh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneigh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dneupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dngets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dngets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsconv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsconv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseigt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseigt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsesrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsesrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dseupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsgets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsgets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dsortr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstatn.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstatn.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstats.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstats.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstqrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/dstqrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sgetv0.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sgetv0.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/slaqrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/slaqrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snaupe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snconv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/snconv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneigh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneigh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sneupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sngets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sngets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssconv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssconv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseigt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseigt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssesrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssesrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sseupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssgets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssgets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/ssortr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstatn.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstatn.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstats.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstats.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstqrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/sstqrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zgetv0.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zgetv0.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaitr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaitr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znapps.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znapps.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaup2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaup2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/znaupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneigh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneigh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneupd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zneupd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zngets.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zngets.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zsortc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zsortc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zstatn.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK/zstatn.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cmout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cmout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cvout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/cvout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dmout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dmout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dvout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/dvout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icnteq.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icnteq.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icopy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/icopy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iset.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iset.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iswap.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/iswap.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/ivout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/ivout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/second.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/second.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/smout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/smout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/svout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/svout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zmout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zmout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zvout.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/ARPACK_UTIL/zvout.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/caxpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/caxpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ccopy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ccopy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotu.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cdotu.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgerc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgerc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgeru.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cgeru.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cher2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cherk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cherk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/chpr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/crotg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/crotg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csrot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csrot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cswap.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/cswap.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csymm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csymm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyr2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyr2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyrk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/csyrk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctbsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctpsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ctrsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dasum.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dasum.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/daxpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/daxpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcabs1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcabs1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcopy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dcopy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ddot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ddot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dgemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dger.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dger.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dnrm2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dnrm2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotmg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/drotmg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsdot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsdot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dspr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dswap.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dswap.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsymv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyr2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyrk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dsyrk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtbsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtpsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dtrsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dzasum.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dzasum.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dznrm2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/dznrm2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/icamax.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/icamax.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/idamax.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/idamax.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/isamax.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/isamax.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/izamax.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/izamax.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/lsame.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/lsame.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sasum.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sasum.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/saxpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/saxpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scabs1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scabs1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scasum.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scasum.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scnrm2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scnrm2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scopy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/scopy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdsdot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sdsdot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sgemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sger.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sger.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/snrm2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/snrm2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotmg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/srotmg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sspr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sswap.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/sswap.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssymv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyr2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyrk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ssyrk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stbsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/stpsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/strsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla_array.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/xerbla_array.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zaxpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zaxpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zcopy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zcopy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotu.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdotu.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdrot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdrot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zdscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgerc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgerc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgeru.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zgeru.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhemv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zher2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zherk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zherk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zhpr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zrotg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zrotg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zscal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zscal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zswap.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zswap.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsymm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsymm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyr2k.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyr2k.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyrk.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/zsyrk.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztbsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztpsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrmv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CBLAS/ztrsv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cgeqr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cgeqr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clacpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cladiv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cladiv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clahqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clahqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clange.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clange.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clanhs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clanhs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarfp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarnv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clarnv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clartg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clartg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clascl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clascl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/claset.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/claset.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/classq.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/classq.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clatrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/clatrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/crot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/crot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrevc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrevc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsen.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsen.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsyl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ctrsyl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cunm2r.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/cunm2r.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dgeqr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dgeqr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/disnan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/disnan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlabad.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlabad.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlacpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dladiv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dladiv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlae2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlae2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaev2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaev2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlahqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlahqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaisnan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaisnan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaln2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaln2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlamch.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlamch.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlange.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlange.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanhs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanhs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanst.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanst.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanv2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlanv2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlapy3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarfx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarnv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlarnv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlartg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlartg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaruv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaruv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlascl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlascl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaset.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlaset.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlassq.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlassq.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasy2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dlasy2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dorm2r.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dorm2r.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dsteqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dsteqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrevc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrevc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsen.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsen.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsyl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dtrsyl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dummy_argc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dummy_argc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dzsum1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/dzsum1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/icmax1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/icmax1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaclr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/iladlr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilaslr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ilazlr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/izmax1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/izmax1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/scsum1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/scsum1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sgeqr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sgeqr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sisnan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sisnan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slabad.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slabad.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slacpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sladiv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sladiv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slae2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slae2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaev2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaev2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slahqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slahqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaisnan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaisnan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaln2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaln2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slamch.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slamch.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slange.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slange.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanhs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanhs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanst.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanst.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanv2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slanv2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slapy3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarfx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarnv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slarnv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slartg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slartg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaruv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaruv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slascl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slascl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaset.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slaset.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slassq.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slassq.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasy2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/slasy2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sorm2r.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/sorm2r.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ssteqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ssteqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strevc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strevc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsen.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsen.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsyl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/strsyl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zgeqr2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zgeqr2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacpy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlacpy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zladiv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zladiv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlahqr.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlahqr.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlange.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlange.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlanhs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlanhs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarfp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarnv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlarnv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlartg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlartg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlascl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlascl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlaset.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlaset.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlassq.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlassq.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlatrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zlatrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zrot.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zrot.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrevc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrevc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrexc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrexc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsen.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsen.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsyl.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/ztrsyl.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zunm2r.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/CLAPACK/zunm2r.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/abort_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/abort_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/backspac.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/backspac.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_cos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_cos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_div.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_div.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_exp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_exp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_log.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_log.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sqrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/c_sqrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/cabs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/cabs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/close.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/close.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ctype.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ctype.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_acos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_acos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_asin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_asin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_atn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cnjg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cnjg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cosh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_cosh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_dim.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_dim.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_exp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_exp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_imag.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_imag.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_int.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_int.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_lg10.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_lg10.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_log.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_log.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_mod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_mod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_nint.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_nint.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_prod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_prod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sign.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sign.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sinh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sinh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sqrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_sqrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tanh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/d_tanh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derf_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derf_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derfc_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/derfc_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dfe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dfe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dolio.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dolio.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dtime_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/dtime_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/due.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/due.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1asc_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1asc_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1cmc_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ef1cmc_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/endfile.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/endfile.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erf_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erf_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erfc_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/erfc_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/err.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/err.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/etime_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/etime_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/exit_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/exit_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77_aloc.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77_aloc.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77vers.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/f77vers.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmtlib.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/fmtlib.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ftell_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ftell_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getarg_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getarg_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getenv_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/getenv_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dim.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dim.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dnnt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_dnnt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_indx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_indx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_len.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_len.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_mod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_mod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_nint.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_nint.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_sign.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/h_sign.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_ge.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_ge.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_gt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_gt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_le.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_le.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_lt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/hl_lt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i77vers.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i77vers.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_ceiling.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_ceiling.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dim.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dim.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dnnt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_dnnt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_indx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_indx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len_trim.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_len_trim.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_mod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_mod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_nint.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_nint.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_sign.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/i_sign.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iargc_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iargc_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iio.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/iio.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ilnw.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/ilnw.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/inquire.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/inquire.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_ge.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_ge.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_gt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_gt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_le.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_le.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_lt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/l_lt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitbits.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitbits.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitshft.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lbitshft.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lread.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lread.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lwrite.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/lwrite.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/missing_erf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/missing_erf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/open.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/open.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ci.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ci.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_dd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_dd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_di.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_di.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_hh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_hh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ii.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ii.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ri.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_ri.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zi.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zi.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zz.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/pow_zz.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_acos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_acos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_asin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_asin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atn2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_atn2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cnjg.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cnjg.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cosh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_cosh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_dim.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_dim.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_exp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_exp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_imag.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_imag.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_int.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_int.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_lg10.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_lg10.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_log.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_log.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_mod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_mod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_nint.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_nint.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sign.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sign.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sinh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sinh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sqrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_sqrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tan.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tan.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tanh.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/r_tanh.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rdfmt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rdfmt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rewind.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rewind.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsfe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsfe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsli.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsli.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsne.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/rsne.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cat.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cat.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cmp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_cmp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_copy.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_copy.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_paus.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_paus.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_rnge.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_rnge.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_stop.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/s_stop.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sfe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sfe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sig_die.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sig_die.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signal_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signal_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signbit.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/signbit.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sue.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/sue.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/system_.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/system_.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/typesize.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/typesize.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uio.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uio.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uninit.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/uninit.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/util.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/util.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wref.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wref.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wrtfmt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wrtfmt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsfe.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsfe.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsle.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsle.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsne.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/wsne.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/xwsne.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/xwsne.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_abs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_abs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_cos.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_cos.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_div.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_div.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_exp.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_exp.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_log.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_log.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sin.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sin.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sqrt.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/LIBF2C/z_sqrt.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ccopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cdiagonal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cdiagonal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgscon.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgscon.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsequ.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsequ.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsisx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsisx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsitrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsitrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsrfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgsrfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssvx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgssvx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cgstrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clacon2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clacon2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clangs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/clangs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/claqgs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/claqgs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cldperm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cldperm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmemory.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmemory.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmyblas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cmyblas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/colamd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/colamd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotgrowth.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpivotgrowth.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpruneL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cpruneL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadhb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadhb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadtriple.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/creadtriple.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/csp_blas3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cutil.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/cutil.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcomplex.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcomplex.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dcopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ddiagonal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ddiagonal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgscon.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgscon.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsequ.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsequ.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsisx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsisx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsitrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsitrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsrfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgsrfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssvx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgssvx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dgstrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlacon2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlacon2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlangs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlangs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlaqgs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dlaqgs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dldperm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dldperm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmach.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmach.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmemory.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmemory.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmyblas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dmyblas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotgrowth.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpivotgrowth.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpruneL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dpruneL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadhb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadhb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadtriple.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dreadtriple.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dsp_blas3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dutil.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dutil.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dzsum1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/dzsum1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/get_perm_c.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/get_perm_c.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/heap_relax_snode.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/heap_relax_snode.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/icmax1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/icmax1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ccopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cdrop_row.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cdrop_row.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_cpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_csnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_csnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dcopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ddrop_row.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ddrop_row.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dsnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_dsnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_heap_relax_snode.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_heap_relax_snode.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_relax_snode.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_relax_snode.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_scopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_sdrop_row.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_sdrop_row.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_spivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ssnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_ssnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zcopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zdrop_row.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zdrop_row.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zsnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ilu_zsnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/input_error.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/input_error.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/izmax1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/izmax1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mark_relax.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mark_relax.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mc64ad.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mc64ad.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/memory.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/memory.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mmd.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/mmd.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/qselect.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/qselect.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/relax_snode.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/relax_snode.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scomplex.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scomplex.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scsum1.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/scsum1.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sdiagonal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sdiagonal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgscon.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgscon.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsequ.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsequ.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsisx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsisx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsitrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsitrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsrfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgsrfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssvx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgssvx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sgstrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slacon2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slacon2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slangs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slangs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slaqgs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/slaqgs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sldperm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sldperm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smach.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smach.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smemory.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smemory.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smyblas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/smyblas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_coletree.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_coletree.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_ienv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_ienv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_preorder.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sp_preorder.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotgrowth.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spivotgrowth.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spruneL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/spruneL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadhb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadhb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadtriple.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sreadtriple.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/ssp_blas3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/superlu_timer.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/superlu_timer.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sutil.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/sutil.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/util.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/util.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcolumn_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcopy_to_ucol.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zcopy_to_ucol.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zdiagonal.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zdiagonal.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgscon.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgscon.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsequ.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsequ.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsisx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsisx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsitrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsitrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsrfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgsrfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssv.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssv.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssvx.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgssvx.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrf.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrf.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zgstrs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlacon2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlacon2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlangs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlangs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlaqgs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zlaqgs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zldperm.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zldperm.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmemory.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmemory.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmyblas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zmyblas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpanel_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotgrowth.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpivotgrowth.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpruneL.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zpruneL.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadhb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadhb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadrb.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadrb.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadtriple.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zreadtriple.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_bmod.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_bmod.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_dfs.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsnode_dfs.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas2.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas2.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas3.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zsp_blas3.c.o.d"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zutil.c.o"
+  "CMakeFiles/geogram_num_3rdparty.dir/SUPERLU/zutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/geogram_num_3rdparty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libgeogram_num_3rdparty.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench_load"
+  "../../../bin/bench_load.pdb"
+  "CMakeFiles/bench_load.dir/main.cpp.o"
+  "CMakeFiles/bench_load.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench_spatial_sort"
+  "../../../bin/bench_spatial_sort.pdb"
+  "CMakeFiles/bench_spatial_sort.dir/main.cpp.o"
+  "CMakeFiles/bench_spatial_sort.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_spatial_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_HLBFGS"
+  "../../../bin/test_HLBFGS.pdb"
+  "CMakeFiles/test_HLBFGS.dir/main.cpp.o"
+  "CMakeFiles/test_HLBFGS.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_HLBFGS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_RVC"
+  "../../../bin/test_RVC.pdb"
+  "CMakeFiles/test_RVC.dir/main.cpp.o"
+  "CMakeFiles/test_RVC.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_RVC.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
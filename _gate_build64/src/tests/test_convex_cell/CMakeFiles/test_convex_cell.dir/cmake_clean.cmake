@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_convex_cell"
+  "../../../bin/test_convex_cell.pdb"
+  "CMakeFiles/test_convex_cell.dir/main.cpp.o"
+  "CMakeFiles/test_convex_cell.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convex_cell.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
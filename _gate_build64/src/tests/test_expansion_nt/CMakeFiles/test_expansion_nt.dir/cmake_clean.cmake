@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_expansion_nt"
+  "../../../bin/test_expansion_nt.pdb"
+  "CMakeFiles/test_expansion_nt.dir/main.cpp.o"
+  "CMakeFiles/test_expansion_nt.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_expansion_nt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_locks"
+  "../../../bin/test_locks.pdb"
+  "CMakeFiles/test_locks.dir/main.cpp.o"
+  "CMakeFiles/test_locks.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_locks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
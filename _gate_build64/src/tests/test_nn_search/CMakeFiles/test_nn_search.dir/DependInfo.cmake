@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tests/test_nn_search/main.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/main.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/main.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/nn_search_ANN.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/nn_search_ANN.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/nn_search_ANN.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/ANN.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/ANN.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/ANN.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/bd_fix_rad_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_fix_rad_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_fix_rad_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/bd_pr_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_pr_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_pr_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/bd_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/bd_tree.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_tree.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/bd_tree.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/brute.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/brute.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/brute.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_dump.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_dump.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_dump.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_fix_rad_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_fix_rad_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_fix_rad_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_pr_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_pr_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_pr_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_search.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_search.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_search.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_split.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_split.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_split.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_tree.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_tree.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_tree.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/kd_util.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_util.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/kd_util.cpp.o.d"
+  "/root/repo/src/tests/test_nn_search/third_party/ANN/perf.cpp" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/perf.cpp.o" "gcc" "src/tests/test_nn_search/CMakeFiles/test_nn_search.dir/third_party/ANN/perf.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build64/src/lib/geogram/CMakeFiles/geogram.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_nn_search"
+  "../../../bin/test_nn_search.pdb"
+  "CMakeFiles/test_nn_search.dir/main.cpp.o"
+  "CMakeFiles/test_nn_search.dir/main.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/nn_search_ANN.cpp.o"
+  "CMakeFiles/test_nn_search.dir/nn_search_ANN.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/ANN.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/ANN.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_fix_rad_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_fix_rad_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_pr_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_pr_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_tree.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/bd_tree.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/brute.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/brute.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_dump.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_dump.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_fix_rad_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_fix_rad_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_pr_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_pr_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_search.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_search.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_split.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_split.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_tree.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_tree.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_util.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/kd_util.cpp.o.d"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/perf.cpp.o"
+  "CMakeFiles/test_nn_search.dir/third_party/ANN/perf.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_nn_search.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+#!/bin/sh
+# Wrapper for the RobotFramework editor
+
+scriptdir=`dirname "$0"`
+. "$scriptdir/testenv.sh" || exit 1
+exec ride.py $args
+
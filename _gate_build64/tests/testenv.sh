@@ -0,0 +1,34 @@
+#!/bin/sh
+#
+#      \\V (O |R |P /A |L |I |N |E 
+# (C) Bruno Levy, INRIA - ALICE, 2012,2013
+#
+#   Confidential - proprietary software
+#
+
+export VORPALINE_BUILD_CONFIG="Release"
+export VORPALINE_SOURCE_DIR="/root/repo"
+export VORPALINE_BUILD_DIR="/root/repo/_gate_build64"
+export VORPALINE_BIN_DIR="/root/repo/_gate_build64/bin"
+export VORPALINE_LIB_DIR="/root/repo/_gate_build64/lib"
+
+args=
+while [ -n "$1" ]; do
+    case "$1" in
+        --with-*=*)
+            var=`echo "$1" | sed 's/--with-\([^=]*\)=\(.*\)$/VORPALINE_WITH_\U\1\E=\2/'`
+            export "$var"
+            shift
+            ;;
+        --with-*)
+            var=`echo "$1" | sed 's/--with-\(.*\)$/VORPALINE_WITH_\U\1=1/'`
+            export "$var"
+            shift
+            ;;
+        *)
+            args="$args $1"
+            shift;
+            ;;
+    esac
+done
+
@@ -60,6 +60,18 @@ if(GEOGRAM_WITH_LUA)
    add_definitions(-DGEOGRAM_WITH_LUA)
 endif()
 
+# 64-bit indices. Client code needs to be compiled with the same
+# definition (it is exported in geogram.pc).
+if(GEOGRAM_WITH_GARGANTUA)
+   add_definitions(-DGARGANTUA)
+   set(GEOGRAM_PC_CFLAGS "-DGARGANTUA")
+endif()
+
+# Statistics on exact predicates (PCK::get_stats()), for profiling.
+if(GEOGRAM_WITH_PREDICATE_STATS)
+   add_definitions(-DGEOGRAM_WITH_PREDICATE_STATS)
+endif()
+
 # This test is there to keep CMake happy about unused variable CMAKE_BUILD_TYPE
 if(CMAKE_BUILD_TYPE STREQUAL "")
 endif()
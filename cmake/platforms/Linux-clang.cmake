@@ -44,6 +44,12 @@ add_flags(CMAKE_C_FLAGS -Wno-unknown-warning-option)
 add_flags(CMAKE_CXX_FLAGS -msse3)
 add_flags(CMAKE_C_FLAGS -msse3)
 
+# Activate AVX2 instruction set
+if(GEOGRAM_WITH_AVX2)
+   add_flags(CMAKE_CXX_FLAGS -mavx2)
+   add_flags(CMAKE_C_FLAGS -mavx2)
+endif()
+
 # C++11 standard
 add_flags(CMAKE_CXX_FLAGS -Qunused-arguments -std=c++11 -Wno-c++98-compat)
 
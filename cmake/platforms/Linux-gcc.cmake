@@ -44,8 +44,10 @@ add_flags(CMAKE_CXX_FLAGS -frounding-math -ffp-contract=off)
 add_flags(CMAKE_C_FLAGS -frounding-math -ffp-contract=off)
 
 # Activate AVX2 instruction set
-# add_flags(CMAKE_CXX_FLAGS -mavx2)
-# add_flags(CMAKE_C_FLAGS -mavx2)
+if(GEOGRAM_WITH_AVX2)
+   add_flags(CMAKE_CXX_FLAGS -mavx2)
+   add_flags(CMAKE_C_FLAGS -mavx2)
+endif()
 
 # Activate c++ 2011
 add_flags(CMAKE_CXX_FLAGS -std=c++11)
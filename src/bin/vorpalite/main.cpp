@@ -154,7 +154,18 @@ namespace {
             double radius = CmdLine::get_arg_percent(
                 "co3ne:radius", bbox_diag
             );
-            Co3Ne_smooth_and_reconstruct(M_in, nb_neigh, Psmooth_iter, radius);
+            index_t tile_points = CmdLine::get_arg_uint("co3ne:tile_points");
+            if(tile_points != 0) {
+                double margin = 
+                    radius * CmdLine::get_arg_double("co3ne:tile_margin");
+                Co3Ne_smooth_and_reconstruct_tiled(
+                    M_in, nb_neigh, Psmooth_iter, radius, tile_points, margin
+                );
+            } else {
+                Co3Ne_smooth_and_reconstruct(
+                    M_in, nb_neigh, Psmooth_iter, radius
+                );
+            }
         }
     }
 
@@ -321,6 +332,12 @@ namespace {
                 if(CmdLine::get_arg_bool("post:isect")) {
                     mesh_remove_intersections(M_out);
                 }
+                index_t nb_facets = CmdLine::get_arg_uint(
+                    "post:decimate_facets"
+                );
+                if(nb_facets != 0 && M_out.facets.nb() > nb_facets) {
+                    mesh_decimate_quadric(M_out, nb_facets);
+                }
             }
             orient_normals(M_out);
             if(CmdLine::get_arg_bool("post:compute_normals")) {
@@ -624,7 +641,8 @@ int main(int argc, char** argv) {
                 dim,
                 CmdLine::get_arg_uint("opt:nb_Lloyd_iter"),
                 CmdLine::get_arg_uint("opt:nb_Newton_iter"),
-                CmdLine::get_arg_uint("opt:Newton_m")
+                CmdLine::get_arg_uint("opt:Newton_m"),
+                CmdLine::get_arg_bool("remesh:multilevel")
             );
         }
 
@@ -62,6 +62,32 @@ namespace {
 
     using namespace GEO;
 
+    /**
+     * \brief Computes the one sided Hausdorff distance between two 
+     *  meshes.
+     * \param[in] M1 , M2 the two meshes
+     * \param[in] sampling_step the sampling step, used if 
+     *  \p tolerance is zero
+     * \param[in] tolerance if non-zero, the distance is bounded
+     *  up to this tolerance instead of being sampled
+     * \return the distance, or its upper bound if \p tolerance is
+     *  non-zero
+     */
+    double one_sided_distance(
+        Mesh& M1, Mesh& M2, double sampling_step, double tolerance
+    ) {
+        if(tolerance == 0.0) {
+            return mesh_one_sided_Hausdorff_distance(
+                M1, M2, sampling_step
+            );
+        }
+        double lower_bound, upper_bound;
+        mesh_one_sided_Hausdorff_distance_bounds(
+            M1, M2, tolerance, lower_bound, upper_bound
+        );
+        return upper_bound;
+    }
+
     /**
      * \return false if distance is greater than 5%
      *  of bbox radius.
@@ -74,6 +100,9 @@ namespace {
         double sampling_step = CmdLine::get_arg_percent(
             "stat:sampling_step", bbox_diag
         );
+        double tolerance = CmdLine::get_arg_percent(
+            "stat:tolerance", bbox_diag
+        );
 
         double sym_dist = 0.0, sym_dist_percent = 0.0;
 
@@ -81,8 +110,8 @@ namespace {
             Stopwatch W("M1->M2");
             Logger::out("Hausdorff") << "Computing Hausdorff distance M1->M2..."
                 << std::endl;
-            double dist = mesh_one_sided_Hausdorff_distance(
-                M1, M2, sampling_step
+            double dist = one_sided_distance(
+                M1, M2, sampling_step, tolerance
             );
             sym_dist = std::max(sym_dist, dist);
             double dist_percent = dist / bbox_diag * 100.0;
@@ -96,8 +125,8 @@ namespace {
             Stopwatch W("M2->M1");
             Logger::out("Hausdorff") << "Computing Hausdorff distance M2->M1..."
                 << std::endl;
-            double dist = mesh_one_sided_Hausdorff_distance(
-                M2, M1, sampling_step
+            double dist = one_sided_distance(
+                M2, M1, sampling_step, tolerance
             );
             sym_dist = std::max(sym_dist, dist);
             double dist_percent = dist / bbox_diag * 100.0;
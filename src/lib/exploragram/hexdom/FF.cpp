@@ -209,7 +209,7 @@ namespace {
         }
     }
 
-    void compute_gradient_cb2(unsigned int N, double* x, double& f, double* g) {
+    void compute_gradient_cb2(index_t N, double* x, double& f, double* g) {
         mat3 mEx = mat3_from_coeffs( 0, 0, 0, 0, 0, -1, 0, 1, 0 );
         mat3 mEy = mat3_from_coeffs(0, 0, 1, 0, 0, 0, -1, 0, 0 );
         mat3 mEz = mat3_from_coeffs(0, -1, 0, 1, 0, 0, 0, 0, 0 );
@@ -0,0 +1,412 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/basic/attribute_codecs.h>
+#include <geogram/basic/memory.h>
+#include <geogram/basic/assert.h>
+#include <geogram/third_party/zlib/zlib.h>
+
+#include <string.h>
+#include <algorithm>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Size of the blocks compressed independently by deflate().
+     * \details Keeps the sizes representable by zlib's uLong on all
+     *  platforms.
+     */
+    const size_t DEFLATE_BLOCK_SIZE = size_t(1) << 26;
+
+    /**
+     * \brief Size of the sample used by select_codec() to compare
+     *  the encoded and raw data.
+     */
+    const size_t SAMPLE_SIZE = size_t(1) << 20;
+
+    /**
+     * \brief Number of chunks the sample used by select_codec()
+     *  is made of.
+     */
+    const size_t SAMPLE_NB_CHUNKS = 16;
+
+    /**
+     * \brief Appends an unsigned integer to a byte stream using a
+     *  variable-length encoding (7 bits per byte, high bit set if more
+     *  bytes follow).
+     * \param[in] x the integer
+     * \param[in,out] out the byte stream
+     */
+    inline void write_varint(
+        Numeric::uint64 x, std::vector<Numeric::uint8>& out
+    ) {
+        while(x >= 0x80) {
+            out.push_back(Numeric::uint8(x | 0x80));
+            x >>= 7;
+        }
+        out.push_back(Numeric::uint8(x));
+    }
+
+    /**
+     * \brief Reads an unsigned integer written by write_varint().
+     * \param[in,out] in the current position in the byte stream
+     * \param[in] end one position past the end of the byte stream
+     * \param[out] x the integer
+     * \retval true on success
+     * \retval false if the stream is truncated or corrupted
+     */
+    inline bool read_varint(
+        const Numeric::uint8*& in, const Numeric::uint8* end,
+        Numeric::uint64& x
+    ) {
+        x = 0;
+        for(index_t shift=0; shift<64; shift += 7) {
+            if(in == end) {
+                return false;
+            }
+            Numeric::uint8 b = *in;
+            ++in;
+            x |= Numeric::uint64(b & 0x7f) << shift;
+            if((b & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * \brief Encodes integers as the zigzag varint of their difference
+     *  with the same component of the previous item.
+     * \tparam UINT the unsigned integer type of the scalars
+     * \tparam INT the signed integer type with the same size as \p UINT
+     * \param[in] data , nb the scalars
+     * \param[in] stride number of scalars per item
+     * \param[out] out the encoded data
+     */
+    template <class UINT, class INT> void encode_delta_varint(
+        const Numeric::uint8* data, size_t nb, size_t stride,
+        std::vector<Numeric::uint8>& out
+    ) {
+        std::vector<UINT> prev(stride, UINT(0));
+        out.clear();
+        out.reserve(nb + nb/2);
+        for(size_t i=0; i<nb; ++i) {
+            UINT x;
+            memcpy(&x, data + i*sizeof(UINT), sizeof(UINT));
+            UINT& p = prev[i % stride];
+            UINT d = UINT(x - p);
+            p = x;
+            // zigzag: small negative differences give small codes
+            UINT z = UINT(
+                UINT(d << 1) ^ UINT(INT(d) >> (sizeof(UINT)*8-1))
+            );
+            write_varint(Numeric::uint64(z), out);
+        }
+    }
+
+    /**
+     * \brief Decodes integers encoded by encode_delta_varint().
+     * \tparam UINT the unsigned integer type of the scalars
+     * \param[in] in , in_size the encoded data
+     * \param[out] data , nb where to store the scalars
+     * \param[in] stride number of scalars per item
+     * \retval true on success
+     * \retval false if the encoded data is corrupted
+     */
+    template <class UINT> bool decode_delta_varint(
+        const Numeric::uint8* in, size_t in_size,
+        Numeric::uint8* data, size_t nb, size_t stride
+    ) {
+        const Numeric::uint8* end = in + in_size;
+        std::vector<UINT> prev(stride, UINT(0));
+        for(size_t i=0; i<nb; ++i) {
+            Numeric::uint64 z64;
+            if(!read_varint(in, end, z64)) {
+                return false;
+            }
+            UINT z = UINT(z64);
+            UINT d = UINT((z >> 1) ^ UINT(UINT(0) - UINT(z & 1)));
+            UINT& p = prev[i % stride];
+            p = UINT(p + d);
+            memcpy(data + i*sizeof(UINT), &p, sizeof(UINT));
+        }
+        return (in == end);
+    }
+}
+
+namespace GEO {
+
+    namespace AttributeCodec {
+
+        Codec codec_for_type(
+            const std::string& element_type, size_t element_size,
+            size_t& scalar_size
+        ) {
+            scalar_size = element_size;
+            if(
+                element_type == "index_t" ||
+                element_type == "signed_index_t" ||
+                element_type == "int" ||
+                element_type == "unsigned int"
+            ) {
+                if(element_size == 4 || element_size == 8) {
+                    return CODEC_DELTA_VARINT;
+                }
+            } else if(
+                element_type == "float" ||
+                element_type == "double"
+            ) {
+                if(element_size == 4 || element_size == 8) {
+                    return CODEC_BYTE_SHUFFLE;
+                }
+            } else if(
+                element_type == "vec2" ||
+                element_type == "vec3"
+            ) {
+                scalar_size = sizeof(double);
+                return CODEC_BYTE_SHUFFLE;
+            }
+            scalar_size = 1;
+            return CODEC_NONE;
+        }
+
+        void encode(
+            Codec codec, size_t scalar_size, size_t stride,
+            const void* data, size_t nb_bytes,
+            std::vector<Numeric::uint8>& out
+        ) {
+            const Numeric::uint8* in = (const Numeric::uint8*)(data);
+            switch(codec) {
+            case CODEC_DELTA_VARINT: {
+                geo_assert(nb_bytes % scalar_size == 0);
+                size_t nb = nb_bytes / scalar_size;
+                if(scalar_size == 4) {
+                    encode_delta_varint<Numeric::uint32, Numeric::int32>(
+                        in, nb, stride, out
+                    );
+                } else {
+                    geo_assert(scalar_size == 8);
+                    encode_delta_varint<Numeric::uint64, Numeric::int64>(
+                        in, nb, stride, out
+                    );
+                }
+            } break;
+            case CODEC_BYTE_SHUFFLE: {
+                geo_assert(nb_bytes % (scalar_size * stride) == 0);
+                size_t nb_items = nb_bytes / (scalar_size * stride);
+                out.resize(nb_bytes);
+                for(size_t c=0; c<stride; ++c) {
+                    for(size_t b=0; b<scalar_size; ++b) {
+                        Numeric::uint8* plane =
+                            out.data() + (c*scalar_size+b)*nb_items;
+                        const Numeric::uint8* from = in + c*scalar_size + b;
+                        for(size_t i=0; i<nb_items; ++i) {
+                            plane[i] = from[i*stride*scalar_size];
+                        }
+                    }
+                }
+            } break;
+            case CODEC_NONE: {
+                out.assign(in, in + nb_bytes);
+            } break;
+            }
+        }
+
+        bool decode(
+            Codec codec, size_t scalar_size, size_t stride,
+            const Numeric::uint8* in, size_t in_size,
+            void* data, size_t nb_bytes
+        ) {
+            Numeric::uint8* out = (Numeric::uint8*)(data);
+            if(
+                codec != CODEC_NONE &&
+                (scalar_size == 0 || nb_bytes % scalar_size != 0)
+            ) {
+                return false;
+            }
+            switch(codec) {
+            case CODEC_DELTA_VARINT: {
+                if(stride == 0) {
+                    return false;
+                }
+                size_t nb = nb_bytes / scalar_size;
+                if(scalar_size == 4) {
+                    return decode_delta_varint<Numeric::uint32>(
+                        in, in_size, out, nb, stride
+                    );
+                } else if(scalar_size == 8) {
+                    return decode_delta_varint<Numeric::uint64>(
+                        in, in_size, out, nb, stride
+                    );
+                }
+                return false;
+            }
+            case CODEC_BYTE_SHUFFLE: {
+                if(
+                    in_size != nb_bytes || stride == 0 ||
+                    nb_bytes % (scalar_size * stride) != 0
+                ) {
+                    return false;
+                }
+                size_t nb_items = nb_bytes / (scalar_size * stride);
+                for(size_t c=0; c<stride; ++c) {
+                    for(size_t b=0; b<scalar_size; ++b) {
+                        const Numeric::uint8* plane =
+                            in + (c*scalar_size+b)*nb_items;
+                        Numeric::uint8* to = out + c*scalar_size + b;
+                        for(size_t i=0; i<nb_items; ++i) {
+                            to[i*stride*scalar_size] = plane[i];
+                        }
+                    }
+                }
+                return true;
+            }
+            case CODEC_NONE: {
+                if(in_size != nb_bytes) {
+                    return false;
+                }
+                Memory::copy(out, in, nb_bytes);
+                return true;
+            }
+            }
+            return false;
+        }
+
+        Codec select_codec(
+            Codec codec, size_t scalar_size, size_t stride,
+            const void* data, size_t nb_bytes
+        ) {
+            if(codec == CODEC_NONE || nb_bytes == 0) {
+                return CODEC_NONE;
+            }
+            size_t item_size = scalar_size * stride;
+            size_t nb_items = nb_bytes / item_size;
+            size_t chunk_items = std::max(
+                SAMPLE_SIZE / (SAMPLE_NB_CHUNKS * item_size), size_t(1)
+            );
+            const Numeric::uint8* in = (const Numeric::uint8*)(data);
+            std::vector<Numeric::uint8> raw;
+            if(nb_items <= chunk_items * SAMPLE_NB_CHUNKS) {
+                raw.assign(in, in + nb_bytes);
+            } else {
+                // Chunks evenly spread over the data, since the beginning
+                // alone is not always representative (e.g. the first
+                // cells of a mesh are often better ordered)
+                for(size_t c=0; c<SAMPLE_NB_CHUNKS; ++c) {
+                    const Numeric::uint8* chunk =
+                        in + (c * (nb_items / SAMPLE_NB_CHUNKS)) * item_size;
+                    raw.insert(
+                        raw.end(), chunk, chunk + chunk_items * item_size
+                    );
+                }
+            }
+            std::vector<Numeric::uint8> encoded;
+            encode(codec, scalar_size, stride, raw.data(), raw.size(), encoded);
+            std::vector<Numeric::uint8> raw_z;
+            std::vector<Numeric::uint8> encoded_z;
+            deflate(raw, raw_z);
+            deflate(encoded, encoded_z);
+            return (encoded_z.size() < raw_z.size()) ? codec : CODEC_NONE;
+        }
+
+        void deflate(
+            const std::vector<Numeric::uint8>& in,
+            std::vector<Numeric::uint8>& out,
+            int level
+        ) {
+            out.clear();
+            for(size_t b=0; b<in.size(); b += DEFLATE_BLOCK_SIZE) {
+                size_t raw_size = std::min(DEFLATE_BLOCK_SIZE, in.size()-b);
+                uLongf comp_size = compressBound(uLong(raw_size));
+                size_t header = out.size();
+                out.resize(header + 2*sizeof(Numeric::uint32) + comp_size);
+                int result = compress2(
+                    out.data() + header + 2*sizeof(Numeric::uint32),
+                    &comp_size, in.data() + b, uLong(raw_size), level
+                );
+                geo_assert(result == Z_OK);
+                Numeric::uint32 sizes[2] = {
+                    Numeric::uint32(raw_size), Numeric::uint32(comp_size)
+                };
+                memcpy(out.data() + header, sizes, sizeof(sizes));
+                out.resize(header + 2*sizeof(Numeric::uint32) + comp_size);
+            }
+            out.shrink_to_fit();
+        }
+
+        bool inflate(
+            const std::vector<Numeric::uint8>& in,
+            std::vector<Numeric::uint8>& out
+        ) {
+            out.clear();
+            size_t pos = 0;
+            while(pos < in.size()) {
+                Numeric::uint32 sizes[2];
+                if(pos + sizeof(sizes) > in.size()) {
+                    return false;
+                }
+                memcpy(sizes, in.data() + pos, sizeof(sizes));
+                pos += sizeof(sizes);
+                if(pos + sizes[1] > in.size()) {
+                    return false;
+                }
+                size_t offset = out.size();
+                out.resize(offset + sizes[0]);
+                uLongf raw_size = uLongf(sizes[0]);
+                int result = uncompress(
+                    out.data() + offset, &raw_size,
+                    in.data() + pos, uLong(sizes[1])
+                );
+                if(result != Z_OK || raw_size != uLongf(sizes[0])) {
+                    return false;
+                }
+                pos += sizes[1];
+            }
+            return true;
+        }
+    }
+}
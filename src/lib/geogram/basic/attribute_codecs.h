@@ -0,0 +1,190 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#ifndef GEOGRAM_BASIC_ATTRIBUTE_CODECS
+#define GEOGRAM_BASIC_ATTRIBUTE_CODECS
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/numeric.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * \file geogram/basic/attribute_codecs.h
+ * \brief Typed encodings for attribute data, used to store cold
+ *  attributes in compressed form and by the .geogram writer.
+ */
+
+namespace GEO {
+
+    /**
+     * \brief Typed encodings for attribute data.
+     * \details Attribute data is seen as an array of scalars (of 4 or 8
+     *  bytes), with a fixed number of scalars per item. The encodings
+     *  do not compress anything by themselves, they transform the data
+     *  into a byte stream that deflate compresses much better than the
+     *  raw array.
+     */
+    namespace AttributeCodec {
+
+        /**
+         * \brief The encodings.
+         */
+        enum Codec {
+            /** \brief Raw bytes */
+            CODEC_NONE = 0,
+            /**
+             * \brief For integers: difference with the same component
+             *  of the previous item, zigzag and variable-length encoded
+             */
+            CODEC_DELTA_VARINT = 1,
+            /**
+             * \brief For floating point numbers: bytes are grouped by
+             *  component and significance (all the first bytes of the
+             *  first component, then all the second bytes...) so that
+             *  exponents and high mantissa bits are contiguous
+             */
+            CODEC_BYTE_SHUFFLE = 2
+        };
+
+        /**
+         * \brief Finds the encoding to be used for an attribute type.
+         * \param[in] element_type the name of the element type, as
+         *  registered with geo_register_attribute_type
+         *  (e.g. "index_t", "double", "vec3")
+         * \param[in] element_size the size of an element, in bytes
+         * \param[out] scalar_size the size of the scalars the elements
+         *  are made of, in bytes
+         * \return the codec to be used for \p element_type, or
+         *  CODEC_NONE if the type has no specific encoding
+         */
+        Codec GEOGRAM_API codec_for_type(
+            const std::string& element_type, size_t element_size,
+            size_t& scalar_size
+        );
+
+        /**
+         * \brief Tests whether an encoding makes attribute data more
+         *  compressible.
+         * \details Depending on the data, the transformed stream does
+         *  not always compress better than the raw one (for instance,
+         *  coordinates with many repeated values are better compressed
+         *  raw). The test is done on a sample of the data.
+         * \param[in] codec , scalar_size , stride the encoding
+         *  parameters, as in encode()
+         * \param[in] data a pointer to the data
+         * \param[in] nb_bytes size of the data, in bytes
+         * \return \p codec if it makes the data more compressible,
+         *  CODEC_NONE otherwise
+         */
+        Codec GEOGRAM_API select_codec(
+            Codec codec, size_t scalar_size, size_t stride,
+            const void* data, size_t nb_bytes
+        );
+
+        /**
+         * \brief Encodes attribute data.
+         * \param[in] codec the encoding
+         * \param[in] scalar_size the size of a scalar, in bytes (4 or 8
+         *  for CODEC_DELTA_VARINT and CODEC_BYTE_SHUFFLE)
+         * \param[in] stride number of scalars per item
+         * \param[in] data a pointer to the data
+         * \param[in] nb_bytes size of the data, in bytes, multiple
+         *  of \p scalar_size
+         * \param[out] out the encoded data
+         */
+        void GEOGRAM_API encode(
+            Codec codec, size_t scalar_size, size_t stride,
+            const void* data, size_t nb_bytes,
+            std::vector<Numeric::uint8>& out
+        );
+
+        /**
+         * \brief Decodes attribute data.
+         * \param[in] codec , scalar_size , stride the parameters
+         *  used to encode the data
+         * \param[in] in a pointer to the encoded data
+         * \param[in] in_size size of the encoded data, in bytes
+         * \param[out] data where to store the decoded data
+         * \param[in] nb_bytes size of the decoded data, in bytes
+         * \retval true on success
+         * \retval false if the encoded data is corrupted
+         */
+        bool GEOGRAM_API decode(
+            Codec codec, size_t scalar_size, size_t stride,
+            const Numeric::uint8* in, size_t in_size,
+            void* data, size_t nb_bytes
+        );
+
+        /**
+         * \brief Compresses a byte stream with deflate.
+         * \details The stream is compressed by blocks, so that
+         *  streams larger than 4GB are supported.
+         * \param[in] in the byte stream
+         * \param[out] out the compressed stream
+         * \param[in] level compression level, in [1..9]
+         */
+        void GEOGRAM_API deflate(
+            const std::vector<Numeric::uint8>& in,
+            std::vector<Numeric::uint8>& out,
+            int level = 1
+        );
+
+        /**
+         * \brief Uncompresses a byte stream compressed with deflate().
+         * \param[in] in the compressed stream
+         * \param[out] out the byte stream
+         * \retval true on success
+         * \retval false if the compressed stream is corrupted
+         */
+        bool GEOGRAM_API inflate(
+            const std::vector<Numeric::uint8>& in,
+            std::vector<Numeric::uint8>& out
+        );
+    }
+}
+
+#endif
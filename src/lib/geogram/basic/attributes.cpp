@@ -44,11 +44,131 @@
  */
 
 #include <geogram/basic/attributes.h>
+#include <geogram/basic/attribute_codecs.h>
 #include <geogram/basic/permutation.h>
 #include <geogram/basic/string.h>
 #include <geogram/basic/geometry.h>
 #include <algorithm>
 
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Minimum number of items for a store to be processed
+     *  in parallel rather than simultaneously with the other stores.
+     */
+    const index_t MIN_PARALLEL_STORE_SIZE = 16384;
+
+    /**
+     * \brief Gets the codec used to compress the data of a cold
+     *  AttributeStore.
+     * \param[in] store the AttributeStore
+     * \param[out] scalar_size the size of the scalars in the elements
+     * \return the codec that corresponds to the element type
+     */
+    AttributeCodec::Codec cold_codec(
+        const AttributeStore* store, size_t& scalar_size
+    ) {
+        std::string element_type;
+        if(
+            AttributeStore::element_typeid_name_is_known(
+                store->element_typeid_name()
+            )
+        ) {
+            element_type =
+                AttributeStore::element_type_name_by_element_typeid_name(
+                    store->element_typeid_name()
+                );
+        }
+        return AttributeCodec::codec_for_type(
+            element_type, store->element_size(), scalar_size
+        );
+    }
+
+    /**
+     * \brief Decodes the compressed data of a cold AttributeStore.
+     * \param[in] store the AttributeStore
+     * \param[in] codec the codec used to encode the data
+     * \param[in] compressed the encoded and deflated data
+     * \param[out] to where to write the decoded data
+     * \param[in] nb_bytes the size of the decoded data
+     * \retval true if the data could be decoded
+     * \retval false otherwise
+     */
+    bool decode_cold_data(
+        const AttributeStore* store, AttributeCodec::Codec codec,
+        const std::vector<Numeric::uint8>& compressed,
+        Memory::pointer to, size_t nb_bytes
+    ) {
+        size_t scalar_size;
+        cold_codec(store, scalar_size);
+        std::vector<Numeric::uint8> encoded;
+        return AttributeCodec::inflate(compressed, encoded) &&
+            AttributeCodec::decode(
+                codec, scalar_size,
+                store->element_size() * store->dimension() / scalar_size,
+                encoded.data(), encoded.size(), to, nb_bytes
+            );
+    }
+
+    /**
+     * \brief Decodes the items of a cold AttributeStore.
+     * \details Item i is the encoded item map->items[i] (or i if \p map
+     *  is null) if i < nb_kept and this index is not index_t(-1).
+     *  The other items are zero.
+     * \param[in] store the AttributeStore
+     * \param[in] codec the codec used to encode the data
+     * \param[in] compressed the encoded and deflated data
+     * \param[in] nb_encoded the number of encoded items
+     * \param[in] nb_kept the number of items that may have an
+     *  encoded source
+     * \param[in] map the pending reordering of the items, or nullptr
+     * \param[in] nb_items the number of items to decode
+     * \param[out] to where to write the nb_items decoded items, 
+     *  initialized with zeroes
+     */
+    void decode_cold_items(
+        const AttributeStore* store, AttributeCodec::Codec codec,
+        const std::vector<Numeric::uint8>& compressed,
+        index_t nb_encoded, index_t nb_kept, const AttributeColdMap* map,
+        index_t nb_items, Memory::pointer to
+    ) {
+        nb_kept = std::min(nb_kept, nb_items);
+        if(nb_encoded == 0 || nb_kept == 0) {
+            return;
+        }
+        size_t item_size = store->element_size() * store->dimension();
+        if(map == nullptr && nb_encoded <= nb_items) {
+            bool OK = decode_cold_data(
+                store, codec, compressed, to, item_size * size_t(nb_encoded)
+            );
+            geo_assert(OK);
+            // Items removed then re-created by resize_cold() are zero.
+            Memory::clear(
+                to + item_size * nb_kept,
+                item_size * size_t(nb_encoded - nb_kept)
+            );
+            return;
+        }
+        std::vector<Numeric::uint8> decoded(item_size * size_t(nb_encoded));
+        bool OK = decode_cold_data(
+            store, codec, compressed, decoded.data(), decoded.size()
+        );
+        geo_assert(OK);
+        for(index_t i=0; i<nb_kept; ++i) {
+            index_t j = (map == nullptr) ? i : map->items[i];
+            if(j != index_t(-1)) {
+                geo_debug_assert(j < nb_encoded);
+                Memory::copy(
+                    to + item_size * i, decoded.data() + item_size * j,
+                    item_size
+                );
+            }
+        }
+    }
+}
+
 namespace GEO {
 
     void AttributeStoreObserver::register_me(AttributeStore* store) {
@@ -84,7 +204,12 @@ namespace GEO {
         cached_base_addr_(nullptr),
         cached_size_(0),
 	cached_capacity_(0),
-        lock_(GEOGRAM_SPINLOCK_INIT)
+        lock_(GEOGRAM_SPINLOCK_INIT),
+        cold_(false),
+        cold_size_(0),
+        cold_nb_encoded_(0),
+        cold_nb_kept_(0),
+        cold_codec_(0)
     {
     }
     
@@ -117,6 +242,10 @@ namespace GEO {
 
     void AttributeStore::register_observer(AttributeStoreObserver* observer) {
         Process::acquire_spinlock(lock_);
+        // Cold attributes are decompressed when bound
+        if(cold_) {
+            make_hot();
+        }
         geo_assert(observers_.find(observer) == observers_.end());
         observers_.insert(observer);
         observer->notify(cached_base_addr_, cached_size_, dimension_);
@@ -134,8 +263,15 @@ namespace GEO {
     void AttributeStore::apply_permutation(
         const vector<index_t>& permutation
     ) {
+        if(cold_) {
+            AttributeColdMapCache cache;
+            apply_permutation_cold(permutation, cache);
+            return;
+        }
         geo_debug_assert(permutation.size() <= cached_size_);
-        Permutation::apply(
+        // Large stores are permuted in parallel (sequentially if called
+        // from a parallel section, see AttributesManager).
+        Permutation::parallel_apply(
             cached_base_addr_, permutation, element_size_ * dimension_
         );
     }
@@ -143,6 +279,11 @@ namespace GEO {
     void AttributeStore::compress(
         const vector<index_t>& old2new
     ) {
+        if(cold_) {
+            AttributeColdMapCache cache;
+            compress_cold(old2new, cache);
+            return;
+        }
         geo_debug_assert(old2new.size() <= cached_size_);
         index_t item_size = element_size_ * dimension_;
         for(index_t i=0; i<old2new.size(); ++i) {
@@ -160,10 +301,170 @@ namespace GEO {
     }
 
     void AttributeStore::zero() {
+        if(cold_) {
+            zero_cold();
+            return;
+        }
         Memory::clear(
             cached_base_addr_, element_size_ * dimension_ * cached_size_
         );
     }
+
+    bool AttributeStore::make_cold() {
+        if(cold_) {
+            return true;
+        }
+        if(has_observers()) {
+            return false;
+        }
+        index_t nb_items = cached_size_;
+        size_t nb_bytes =
+            size_t(element_size_) * size_t(dimension_) * size_t(nb_items);
+        size_t scalar_size;
+        AttributeCodec::Codec codec = cold_codec(this, scalar_size);
+        codec = AttributeCodec::select_codec(
+            codec, scalar_size,
+            size_t(element_size_) * size_t(dimension_) / scalar_size,
+            cached_base_addr_, nb_bytes
+        );
+        std::vector<Numeric::uint8> encoded;
+        AttributeCodec::encode(
+            codec, scalar_size,
+            size_t(element_size_) * size_t(dimension_) / scalar_size,
+            cached_base_addr_, nb_bytes, encoded
+        );
+        std::vector<Numeric::uint8> compressed;
+        AttributeCodec::deflate(encoded, compressed);
+        clear(false);
+        cold_data_.swap(compressed);
+        cold_size_ = nb_items;
+        cold_nb_encoded_ = nb_items;
+        cold_nb_kept_ = nb_items;
+        cold_codec_ = index_t(codec);
+        cold_ = true;
+        return true;
+    }
+
+    void AttributeStore::make_hot() {
+        if(!cold_) {
+            return;
+        }
+        std::vector<Numeric::uint8> compressed;
+        compressed.swap(cold_data_);
+        AttributeColdMap_var map = cold_map_;
+        index_t nb_items = cold_size_;
+        index_t nb_encoded = cold_nb_encoded_;
+        index_t nb_kept = cold_nb_kept_;
+        cold_ = false;
+        cold_size_ = 0;
+        cold_nb_encoded_ = 0;
+        cold_nb_kept_ = 0;
+        cold_map_.reset();
+        resize(nb_items);
+        Memory::clear(
+            cached_base_addr_,
+            size_t(element_size_) * size_t(dimension_) * size_t(nb_items)
+        );
+        decode_cold_items(
+            this, AttributeCodec::Codec(cold_codec_), compressed,
+            nb_encoded, nb_kept, map.get(), nb_items, cached_base_addr_
+        );
+    }
+
+    void AttributeStore::copy_data(std::vector<Numeric::uint8>& bytes) const {
+        size_t item_size = size_t(element_size_) * size_t(dimension_);
+        if(!cold_) {
+            bytes.assign(
+                cached_base_addr_,
+                cached_base_addr_ + item_size * size_t(cached_size_)
+            );
+            return;
+        }
+        bytes.assign(item_size * size_t(cold_size_), 0);
+        decode_cold_items(
+            this, AttributeCodec::Codec(cold_codec_), cold_data_,
+            cold_nb_encoded_, cold_nb_kept_, cold_map_.get(),
+            cold_size_, bytes.data()
+        );
+    }
+
+    void AttributeStore::update_cold_map(
+        AttributeColdMapCache& cache,
+        std::function<void(AttributeColdMap&)> op
+    ) {
+        geo_debug_assert(cold_);
+        auto key = std::make_pair(cold_map_.get(), cold_nb_kept_);
+        auto it = cache.find(key);
+        if(it == cache.end()) {
+            AttributeColdMap_var result = new AttributeColdMap;
+            result->items.resize(cold_size_);
+            for(index_t i=0; i<cold_size_; ++i) {
+                result->items[i] = cold_item_source(i);
+            }
+            op(*result);
+            it = cache.insert(
+                std::make_pair(key, std::make_pair(cold_map_, result))
+            ).first;
+        }
+        cold_map_ = it->second.second;
+        cold_nb_kept_ = cold_size_;
+    }
+
+    void AttributeStore::apply_permutation_cold(
+        const vector<index_t>& permutation, AttributeColdMapCache& cache
+    ) {
+        geo_debug_assert(permutation.size() <= cold_size_);
+        update_cold_map(
+            cache,
+            [&permutation](AttributeColdMap& map) {
+                vector<index_t> items(map.items);
+                for(index_t i=0; i<permutation.size(); ++i) {
+                    map.items[i] = items[permutation[i]];
+                }
+            }
+        );
+    }
+
+    void AttributeStore::compress_cold(
+        const vector<index_t>& old2new, AttributeColdMapCache& cache
+    ) {
+        geo_debug_assert(old2new.size() <= cold_size_);
+        update_cold_map(
+            cache,
+            [&old2new](AttributeColdMap& map) {
+                for(index_t i=0; i<old2new.size(); ++i) {
+                    index_t j = old2new[i];
+                    if(j == index_t(-1) || j == i) {
+                        continue;
+                    }
+                    geo_debug_assert(j <= i);
+                    map.items[j] = map.items[i];
+                }
+            }
+        );
+    }
+
+    void AttributeStore::zero_cold() {
+        geo_debug_assert(cold_);
+        cold_data_.clear();
+        cold_nb_encoded_ = 0;
+        cold_nb_kept_ = 0;
+        cold_map_.reset();
+    }
+
+    void AttributeStore::copy_item_cold(index_t to, index_t from) {
+        geo_debug_assert(cold_);
+        geo_debug_assert(from < cold_size_);
+        geo_debug_assert(to < cold_size_);
+        if(
+            cold_map_.is_null() || cold_map_->is_shared() ||
+            cold_nb_kept_ != cold_size_
+        ) {
+            AttributeColdMapCache cache;
+            update_cold_map(cache, [](AttributeColdMap&) {});
+        }
+        cold_map_->items[to] = cold_map_->items[from];
+    }
     
     /*************************************************************************/
 
@@ -178,6 +479,7 @@ namespace GEO {
         if(new_size == size_) {
             return;
         }
+	// Cold attributes stay cold, their compressed data is not changed.
 	for(auto& cur : attributes_) {
 	    cur.second->resize(new_size);
 	}
@@ -189,7 +491,9 @@ namespace GEO {
             return;
         }
 	for(auto& cur : attributes_) {
-	    cur.second->reserve(new_capacity);
+            if(!cur.second->is_cold()) {
+                cur.second->reserve(new_capacity);
+            }
 	}
         capacity_ = new_capacity;
     }
@@ -197,17 +501,56 @@ namespace GEO {
     void AttributesManager::apply_permutation(
         const vector<index_t>& permutation
     ) {
+	// Each hot store is permuted by its (virtual) apply_permutation()
+	// function, that does not modify the permutation. Large stores
+	// are permuted one after the other, each one in parallel, small
+	// stores are distributed among the threads. Cold stores are not
+	// decompressed, the permutation is composed with their pending
+	// reordering, once for all the stores that share it.
+	vector<AttributeStore*> hot_stores;
+        AttributeColdMapCache cache;
 	for(auto& cur : attributes_) {
-	    cur.second->apply_permutation(permutation);	    
+            if(cur.second->is_cold()) {
+                cur.second->apply_permutation_cold(permutation, cache);
+                continue;
+            }
+	    hot_stores.push_back(cur.second);
 	}
+        if(permutation.size() >= MIN_PARALLEL_STORE_SIZE) {
+            for(AttributeStore* store : hot_stores) {
+                store->apply_permutation(permutation);
+            }
+            return;
+        }
+	parallel_for(
+	    0, hot_stores.size(),
+	    [&hot_stores, &permutation](index_t i) {
+		hot_stores[i]->apply_permutation(permutation);
+	    }
+	);
     }
 
     void AttributesManager::compress(
         const vector<index_t>& old2new
     ) {
+	// The hot stores are compressed in parallel, each one by its
+	// (virtual) compress() function. Cold stores are not decompressed,
+	// as in apply_permutation().
+	vector<AttributeStore*> hot_stores;
+        AttributeColdMapCache cache;
 	for(auto& cur : attributes_) {
-	    cur.second->compress(old2new);	    
+            if(cur.second->is_cold()) {
+                cur.second->compress_cold(old2new, cache);
+                continue;
+            }
+	    hot_stores.push_back(cur.second);
 	}
+	parallel_for(
+	    0, hot_stores.size(),
+	    [&hot_stores, &old2new](index_t i) {
+		hot_stores[i]->compress(old2new);
+	    }
+	);
     }
     
     
@@ -216,6 +559,10 @@ namespace GEO {
     ) {
         geo_assert(find_attribute_store(name) == nullptr);
         attributes_[name] = as;
+        if(as->is_cold()) {
+            geo_assert(as->size() == size_);
+            return;
+        }
 	as->reserve(capacity_);
         as->resize(size_);
     }
@@ -286,6 +633,10 @@ namespace GEO {
 
     void AttributesManager::zero() {
 	for(auto& cur : attributes_) {
+            if(cur.second->is_cold()) {
+                cur.second->zero_cold();
+                continue;
+            }
 	    cur.second->zero();
 	}
     }
@@ -57,7 +57,9 @@
 #include <map>
 #include <typeinfo>
 #include <set>
+#include <vector>
 #include <type_traits>
+#include <algorithm>
 
 /**
  * \file geogram/basic/attributes.h
@@ -191,6 +193,37 @@ namespace GEO {
      *  an AttributeStoreCreator.
      */
     typedef SmartPointer<AttributeStoreCreator> AttributeStoreCreator_var;
+
+    /**
+     * \brief Pending reordering of the items of a cold AttributeStore.
+     * \details Item i of the decompressed data is the encoded item
+     *  items[i], or has the default value if items[i] is index_t(-1).
+     *  Permuting or compressing cold AttributeStores only updates this
+     *  map, the compressed data is not changed. The AttributesManager
+     *  shares the same map between its cold AttributeStores.
+     */
+    struct AttributeColdMap : public Counted {
+        vector<index_t> items;
+    };
+
+    /**
+     * \brief An automatic reference-counted pointer to
+     *  an AttributeColdMap.
+     */
+    typedef SmartPointer<AttributeColdMap> AttributeColdMap_var;
+
+    /**
+     * \brief Maps the initial AttributeColdMap and number of kept items
+     *  of cold AttributeStores to the result of an operation.
+     * \details Used by the AttributesManager to apply an operation only
+     *  once to all the cold AttributeStores that have the same
+     *  AttributeColdMap. The initial map is referenced as well, so that
+     *  its address is not reused while the cache exists.
+     */
+    typedef std::map<
+        std::pair<const AttributeColdMap*, index_t>,
+        std::pair<AttributeColdMap_var, AttributeColdMap_var>
+    > AttributeColdMapCache;
     
     /**
      * \brief Notifies a set of AttributeStoreObservers 
@@ -241,7 +274,7 @@ namespace GEO {
          * \return the number of items
          */
         index_t size() const {
-            return cached_size_;
+            return cold_ ? cold_size_ : cached_size_;
         }
 
 	/**
@@ -255,6 +288,7 @@ namespace GEO {
 	
         /**
          * \brief Resizes this AttributeStore
+         * \details A cold AttributeStore stays cold, see resize_cold().
          * \param[in] new_size new number of items
          */
         virtual void resize(index_t new_size) = 0;
@@ -314,9 +348,9 @@ namespace GEO {
          * data = data2 ;
          * \endcode
          * But it is done in-place.
-         * \param[in] permutation the permutation.
-         *  It is temporarily changed during execution of the
-         *  function, but identical to the input on exit.
+         * \param[in] permutation the permutation. It is not modified,
+         *  because the AttributesManager permutes its stores in
+         *  parallel with the same permutation.
          * \note This function uses memcpy(). If required, it
          *  can be overloaded in derived classes.
          */
@@ -364,8 +398,14 @@ namespace GEO {
          * \brief Copies an item
          * \param[in] to index of the destination item
          * \param[in] from index of the source item
+         * \note If this AttributeStore is cold, it stays cold, the copy
+         *  is recorded in its AttributeColdMap.
          */
         void copy_item(index_t to, index_t from) {
+            if(cold_) {
+                copy_item_cold(to, from);
+                return;
+            }
             geo_debug_assert(from < cached_size_);
             geo_debug_assert(to < cached_size_);
             index_t item_size = element_size_ * dimension_;            
@@ -379,18 +419,85 @@ namespace GEO {
         /**
          * \brief Gets a pointer to the stored data.
          * \return A pointer to the memory block
+         * \note If this AttributeStore is cold, it is decompressed
          */
         void* data() {
+            if(cold_) {
+                make_hot();
+            }
             return cached_base_addr_;
         }
 
         /**
          * \brief Gets a pointer to the stored data.
          * \return A const pointer to the memory block
+         * \note If this AttributeStore is cold, it is decompressed,
+         *  although this function is const (the data does not change,
+         *  only its representation). Thus calling it on a cold
+         *  AttributeStore is not thread-safe. To read a cold
+         *  AttributeStore without decompressing it in place, use
+         *  copy_data().
          */
         const void* data() const {
+            if(cold_) {
+                const_cast<AttributeStore*>(this)->make_hot();
+            }
             return cached_base_addr_;
         }
+
+        /**
+         * \brief Copies the stored data into a buffer.
+         * \details If this AttributeStore is cold, its data is
+         *  decompressed into \p bytes, and this AttributeStore
+         *  stays cold. Items created by resizing a cold AttributeStore
+         *  are zero.
+         * \param[out] bytes the size() items, element_size() times
+         *  dimension() bytes each
+         */
+        void copy_data(std::vector<Numeric::uint8>& bytes) const;
+
+        /**
+         * \brief Compresses the data of this AttributeStore in memory.
+         * \details Cold attributes (that are not accessed often) can be
+         *  kept compressed to save memory. The data is transformed by
+         *  the AttributeCodec that corresponds to the element type
+         *  (delta + varint for indices, byte shuffle for floating point
+         *  numbers), then compressed with deflate. It is decompressed
+         *  automatically as soon as an Attribute is bound to it, its
+         *  data is accessed through data() (including the const
+         *  version), or its dimension is changed. Resizing, permuting,
+         *  compressing, zeroing and copying items keep it cold: the
+         *  compressed data is not changed, the operations are recorded
+         *  in an AttributeColdMap applied when it is decompressed.
+         * \retval true if this AttributeStore is cold
+         * \retval false if it could not be compressed, because an
+         *  Attribute is bound to it
+         */
+        bool make_cold();
+
+        /**
+         * \brief Decompresses the data of this AttributeStore.
+         * \details Does nothing if this AttributeStore is not cold.
+         * \see make_cold()
+         */
+        void make_hot();
+
+        /**
+         * \brief Tests whether this AttributeStore is cold.
+         * \see make_cold()
+         */
+        bool is_cold() const {
+            return cold_;
+        }
+
+        /**
+         * \brief Gets the memory used by the compressed data.
+         * \return the size of the compressed data in bytes, or 0 if
+         *  this AttributeStore is not cold
+         */
+        size_t cold_nb_bytes() const {
+            return cold_data_.size();
+        }
         
         /**
          * \brief Gets the element size.
@@ -542,6 +649,97 @@ namespace GEO {
          */
         void unregister_observer(AttributeStoreObserver* observer);
 
+        /**
+         * \brief Resizes a cold AttributeStore without decompressing it.
+         * \details The compressed data is kept as is. When the
+         *  AttributeStore is decompressed, the items that were
+         *  removed or added by the resizes get the default value.
+         * \param[in] new_size new number of items
+         * \pre is_cold()
+         */
+        void resize_cold(index_t new_size) {
+            geo_debug_assert(cold_);
+            cold_size_ = new_size;
+            cold_nb_kept_ = std::min(cold_nb_kept_, new_size);
+        }
+
+    public:
+        /**
+         * \brief Applies a permutation to a cold AttributeStore without
+         *  decompressing it.
+         * \param[in] permutation the permutation
+         * \param[in,out] cache the results of the same permutation
+         *  applied to other cold AttributeStores
+         * \pre is_cold()
+         */
+        void apply_permutation_cold(
+            const vector<index_t>& permutation, AttributeColdMapCache& cache
+        );
+
+        /**
+         * \brief Compresses a cold AttributeStore without
+         *  decompressing it.
+         * \param[in] old2new the index mapping to be applied
+         * \param[in,out] cache the results of the same mapping
+         *  applied to other cold AttributeStores
+         * \pre is_cold()
+         */
+        void compress_cold(
+            const vector<index_t>& old2new, AttributeColdMapCache& cache
+        );
+
+        /**
+         * \brief Zeroes a cold AttributeStore.
+         * \details The compressed data is released, the AttributeStore
+         *  stays cold.
+         * \pre is_cold()
+         */
+        void zero_cold();
+
+    protected:
+        /**
+         * \brief Copies an item of a cold AttributeStore without
+         *  decompressing it.
+         * \details The first call makes a private copy of the
+         *  AttributeColdMap, then each call is in constant time.
+         * \param[in] to index of the destination item
+         * \param[in] from index of the source item
+         * \pre is_cold()
+         */
+        void copy_item_cold(index_t to, index_t from);
+
+        /**
+         * \brief Gets the encoded item of a cold AttributeStore that
+         *  corresponds to an item.
+         * \param[in] i the index of the item
+         * \return the index of the encoded item, or index_t(-1) if
+         *  item \p i has the default value
+         * \pre is_cold()
+         */
+        index_t cold_item_source(index_t i) const {
+            if(i >= cold_nb_kept_) {
+                return index_t(-1);
+            }
+            return cold_map_.is_null() ? i : cold_map_->items[i];
+        }
+
+        /**
+         * \brief Replaces the AttributeColdMap of a cold AttributeStore
+         *  by the result of an operation.
+         * \details The operation is computed only if it was not
+         *  already applied to another cold AttributeStore with the same
+         *  AttributeColdMap.
+         * \param[in,out] cache the results of the operation applied to
+         *  other cold AttributeStores
+         * \param[in] op computes the new map from the previous one,
+         *  given as a function of the item index (see
+         *  cold_item_source())
+         */
+        void update_cold_map(
+            AttributeColdMapCache& cache,
+            std::function<void(AttributeColdMap&)> op
+        );
+
         
     protected:
         index_t element_size_;
@@ -551,6 +749,13 @@ namespace GEO {
 	index_t cached_capacity_;
         std::set<AttributeStoreObserver*> observers_;
         Process::spinlock lock_;
+        bool cold_;
+        index_t cold_size_;
+        index_t cold_nb_encoded_;
+        index_t cold_nb_kept_;
+        index_t cold_codec_;
+        std::vector<Numeric::uint8> cold_data_;
+        AttributeColdMap_var cold_map_;
 
         static std::map<std::string, AttributeStoreCreator_var>
             type_name_to_creator_;
@@ -585,6 +790,10 @@ namespace GEO {
         }
 
         virtual void resize(index_t new_size) {
+            if(cold_) {
+                resize_cold(new_size);
+                return;
+            }
             store_.resize(new_size*dimension_);
             notify(
                 store_.empty() ? nullptr : Memory::pointer(store_.data()),
@@ -594,7 +803,7 @@ namespace GEO {
         }
 
 	virtual void reserve(index_t new_capacity) {
-	    if(new_capacity > capacity()) {
+	    if(!cold_ && new_capacity > capacity()) {
 		store_.reserve(new_capacity*dimension_);
 		cached_capacity_ = new_capacity;
 		notify(
@@ -611,6 +820,13 @@ namespace GEO {
             } else {
                 store_.clear();
             }
+            cold_ = false;
+            cold_size_ = 0;
+            cold_nb_encoded_ = 0;
+            cold_nb_kept_ = 0;
+            cold_codec_ = 0;
+            cold_data_.clear();
+            cold_map_.reset();
             notify(nullptr, 0, dimension_);
         }
 
@@ -619,6 +835,9 @@ namespace GEO {
             if(dim == dimension()) {
                 return;
             }
+            if(cold_) {
+                make_hot();
+            }
             vector<T> new_store(size()*dim);
 	    new_store.reserve(capacity()*dim);
             index_t copy_dim = std::min(dim, dimension());
@@ -646,6 +865,16 @@ namespace GEO {
         virtual AttributeStore* clone() const {
             TypedAttributeStore<T>* result =
                 new TypedAttributeStore<T>(dimension());
+            if(cold_) {
+                result->cold_ = true;
+                result->cold_size_ = cold_size_;
+                result->cold_nb_encoded_ = cold_nb_encoded_;
+                result->cold_nb_kept_ = cold_nb_kept_;
+                result->cold_codec_ = cold_codec_;
+                result->cold_data_ = cold_data_;
+                result->cold_map_ = cold_map_;
+                return result;
+            }
             result->resize(size());
             result->store_ = store_;
             return result;
@@ -841,8 +1070,8 @@ namespace GEO {
          * \retval true if an attribute with the specified name exists
          * \retval false otherwise
          */
-        bool is_defined(const std::string& name) {
-            return (find_attribute_store(name) != nullptr);
+        bool is_defined(const std::string& name) const {
+            return (attributes_.find(name) != attributes_.end());
         }
         
         /**
@@ -870,9 +1099,7 @@ namespace GEO {
          * data = data2 ;
          * \endcode
          * But it is done in-place.
-         * \param[in] permutation the permutation.
-         *  It is temporarily changed during execution of the
-         *  function, but identical to the input on exit.
+         * \param[in] permutation the permutation. It is not modified.
          */
         void apply_permutation(
             const vector<index_t>& permutation
@@ -172,6 +172,10 @@ namespace {
             "remesh:RVC_centroids", true,
             "Use centroids of restricted Voronoi cells", ARG_ADVANCED
         );
+        declare_arg(
+            "remesh:multilevel", false,
+            "Optimize points from coarse to fine", ARG_ADVANCED
+        );
         declare_arg(
             "remesh:refine", false,
             "Insert points to lower Hausdorff distance", ARG_ADVANCED
@@ -255,6 +259,10 @@ namespace {
         declare_arg(
             "post:isect", false, "Tentatively remove self-intersections"
         );
+        declare_arg(
+            "post:decimate_facets", 0,
+            "Decimate to this nb. of facets (quadric error, 0 = off)"
+        );
         declare_arg(
             "post:compute_normals", false, "Compute normals"
         );
@@ -348,6 +356,11 @@ namespace {
             "sys:compression_level", 3,
             "Compression level for created .geogram files, in [0..9]"
         );
+        declare_arg(
+            "sys:geofile_codecs", false,
+            "Encode attributes in created .geogram files (smaller files,"
+            " not readable by older versions)"
+        );
         declare_arg(
             "sys:lowmem", false,
             "Reduces RAM consumption (but slower)"
@@ -462,6 +475,14 @@ namespace {
             "co3ne:use_normals", true,
             "Use existing normal attached to data if available"
         );
+        declare_arg(
+            "co3ne:tile_points", 0,
+            "Reconstruct by tiles of this nb. of points (0: no tiles)"
+        );
+        declare_arg(
+            "co3ne:tile_margin", 3.0,
+            "Overlap between tiles (relative to co3ne:radius)"
+        );
 
         // For now, in co3ne import arg group -> todo: create new import func
         declare_arg_group("poisson", "Reconstruction", ARG_ADVANCED);
@@ -480,6 +501,10 @@ namespace {
             "stat:sampling_step", 0.5,
             "For Hausdorff distance"
         );
+        declare_arg_percent(
+            "stat:tolerance", 0.0,
+            "Hausdorff distance bounds tolerance (0 = use sampling)"
+        );
     }
 
     /**
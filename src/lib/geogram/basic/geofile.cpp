@@ -44,10 +44,12 @@
  */
 
 #include <geogram/basic/geofile.h>
+#include <geogram/basic/attribute_codecs.h>
 #include <geogram/basic/string.h>
 #include <geogram/basic/logger.h>
 #include <geogram/third_party/pstdint.h>
 #include <ctype.h>
+#include <algorithm>
 
 /* Using portable printf modifier for 64 bit ints from pstdint.h */
 #include <geogram/third_party/pstdint.h> 
@@ -94,7 +96,56 @@ namespace {
         }
         return result;
     }
+
+    /**
+     * \brief Maximum number of bytes transferred by a single call
+     *  to gzread() or gzwrite() (that use 32 bits sizes).
+     */
+    const size_t MAX_GZ_BLOCK = size_t(1) << 30;
     
+    /**
+     * \brief Reads a block of data from a compressed file.
+     * \details Large blocks are read with several calls to gzread().
+     * \param[in] file the file
+     * \param[out] addr where to store the data
+     * \param[in] size number of bytes to read
+     * \return the number of bytes actually read
+     */
+    size_t gzread_large(gzFile file, void* addr, size_t size) {
+        size_t result = 0;
+        GEO::Memory::pointer ptr = GEO::Memory::pointer(addr);
+        while(result < size) {
+            size_t block = std::min(size - result, MAX_GZ_BLOCK);
+            int check = gzread(file, ptr + result, unsigned(block));
+            if(check <= 0) {
+                break;
+            }
+            result += size_t(check);
+        }
+        return result;
+    }
+
+    /**
+     * \brief Writes a block of data to a compressed file.
+     * \details Large blocks are written with several calls to gzwrite().
+     * \param[in] file the file
+     * \param[in] addr the address of the data
+     * \param[in] size number of bytes to write
+     * \return the number of bytes actually written
+     */
+    size_t gzwrite_large(gzFile file, const void* addr, size_t size) {
+        size_t result = 0;
+        GEO::Memory::pointer ptr = GEO::Memory::pointer(addr);
+        while(result < size) {
+            size_t block = std::min(size - result, MAX_GZ_BLOCK);
+            int check = gzwrite(file, ptr + result, unsigned(block));
+            if(check <= 0) {
+                break;
+            }
+            result += size_t(check);
+        }
+        return result;
+    }
 }
 
 namespace GEO {
@@ -345,6 +396,30 @@ namespace GEO {
         }
     }
 
+    index_t GeoFile::read_nb_items() {
+        Numeric::uint32 x = Numeric::uint32(read_int());
+        if(x != NB_ITEMS_64) {
+            return index_t(x);
+        }
+        size_t result = read_size();
+        if(Numeric::uint64(result) > Numeric::uint64(index_t(-1))) {
+            throw GeoFileException(
+                "Number of items does not fit in 32 bits, "
+                "recompile geogram with GEOGRAM_WITH_GARGANTUA"
+            );
+        }
+        return index_t(result);
+    }
+
+    void GeoFile::write_nb_items(index_t x, const char* comment) {
+        if(Numeric::uint64(x) < Numeric::uint64(NB_ITEMS_64)) {
+            write_int(x, comment);
+        } else {
+            write_int(NB_ITEMS_64, comment);
+            write_size(size_t(x));
+        }
+    }
+    
     std::string GeoFile::read_chunk_class() {
         std::string result;
         if(ascii_) {
@@ -416,7 +491,7 @@ namespace GEO {
     size_t GeoFile::string_array_size(
         const std::vector<std::string>& strings
     ) const {
-        size_t result = sizeof(index_t);
+        size_t result = sizeof(Numeric::uint32);
         for(index_t i=0; i<strings.size(); ++i) {
             result += string_size(strings[i]);
         }
@@ -433,7 +508,9 @@ namespace GEO {
         const std::string& filename
     ) : GeoFile(filename),
         current_attribute_set_(nullptr),
-        current_attribute_(nullptr)
+        current_attribute_(nullptr),
+        current_attribute_codec_(AttributeCodec::CODEC_NONE),
+        current_attribute_scalar_size_(1)
     {
         if(ascii_) {
             ascii_file_ = fopen(filename.c_str(), "rb");
@@ -485,7 +562,7 @@ namespace GEO {
         
         if(current_chunk_class_ == "ATTS") {
             std::string attribute_set_name = read_string();
-            index_t nb_items = read_int();
+            index_t nb_items = read_nb_items();
             check_chunk_size();
             
             if(find_attribute_set(attribute_set_name) != nullptr) {
@@ -499,12 +576,23 @@ namespace GEO {
             geo_assert(current_attribute_set_ != nullptr);
             current_attribute_ = nullptr;
             current_comment_ = "";
-        } else if(current_chunk_class_ == "ATTR") {
+        } else if(
+            current_chunk_class_ == "ATTR" || current_chunk_class_ == "ATTC"
+        ) {
             std::string attribute_set_name = read_string();
             std::string attribute_name = read_string();
             std::string element_type = read_string();
             index_t element_size = read_int();
             index_t dimension = read_int();
+            current_attribute_codec_ = AttributeCodec::CODEC_NONE;
+            current_attribute_scalar_size_ = 1;
+            if(current_chunk_class_ == "ATTC") {
+                // Encoded attributes are seen as normal attributes
+                // by client code, decoding is done by read_attribute().
+                current_chunk_class_ = "ATTR";
+                current_attribute_codec_ = read_int();
+                current_attribute_scalar_size_ = read_int();
+            }
             current_attribute_set_ = find_attribute_set(attribute_set_name);
             if(current_attribute_set_->find_attribute(attribute_name) != nullptr) {
                 throw GeoFileException(
@@ -571,8 +659,34 @@ namespace GEO {
             size_t(current_attribute_->element_size) *
             size_t(current_attribute_->dimension) *
             size_t(current_attribute_set_->nb_items);
-        int check = gzread(file_, addr, index_t(size));
-        if(size_t(check) != size) {
+        if(current_attribute_codec_ != AttributeCodec::CODEC_NONE) {
+            size_t encoded_size = size_t(
+                current_chunk_file_pos_ + current_chunk_size_ - gztell(file_)
+            );
+            std::vector<Numeric::uint8> encoded(encoded_size);
+            size_t check = gzread_large(file_, encoded.data(), encoded_size);
+            size_t scalar_size = size_t(current_attribute_scalar_size_);
+            if(
+                check != encoded_size ||
+                scalar_size == 0 ||
+                !AttributeCodec::decode(
+                    AttributeCodec::Codec(current_attribute_codec_),
+                    scalar_size,
+                    size_t(current_attribute_->element_size) *
+                    size_t(current_attribute_->dimension) / scalar_size,
+                    encoded.data(), encoded_size, addr, size
+                )
+            ) {
+                throw GeoFileException(
+                    "Could not decode attribute " + current_attribute_->name +
+                    " in set " + current_attribute_set_->name
+                );
+            }
+            check_chunk_size();
+            return;
+        }
+        size_t check = gzread_large(file_, addr, size);
+        if(check != size) {
             throw GeoFileException(
                 "Could not read attribute " + current_attribute_->name +
                 " in set " + current_attribute_set_->name +
@@ -612,7 +726,8 @@ namespace GEO {
 
     OutputGeoFile::OutputGeoFile(
         const std::string& filename, index_t compression_level
-    ) : GeoFile(filename) {
+    ) : GeoFile(filename),
+        attribute_codecs_(false) {
 
         if(ascii_) {
             ascii_file_ = fopen(filename.c_str(), "wb");
@@ -664,11 +779,11 @@ namespace GEO {
         write_chunk_header(
             "ATTS",
             string_size(attribute_set_name) +
-            sizeof(index_t)
+            nb_items_size(nb_items)
         );
         
         write_string(attribute_set_name, "the name of this attribute set");
-        write_int(nb_items, "the number of items in this attribute set");
+        write_nb_items(nb_items, "the number of items in this attribute set");
 
         check_chunk_size();
     }
@@ -691,14 +806,36 @@ namespace GEO {
             element_size * dimension *
             attribute_sets_[attribute_set_name].nb_items;
 
+        // Attribute encodings (binary files only)
+        size_t scalar_size = 1;
+        AttributeCodec::Codec codec = AttributeCodec::CODEC_NONE;
+        std::vector<Numeric::uint8> encoded;
+        if(attribute_codecs_ && !ascii_) {
+            codec = AttributeCodec::codec_for_type(
+                element_type, element_size, scalar_size
+            );
+            codec = AttributeCodec::select_codec(
+                codec, scalar_size, element_size * dimension / scalar_size,
+                data, data_size
+            );
+        }
+        if(codec != AttributeCodec::CODEC_NONE) {
+            AttributeCodec::encode(
+                codec, scalar_size, element_size * dimension / scalar_size,
+                data, data_size, encoded
+            );
+        }
+
         write_chunk_header(
-            "ATTR",
+            (codec == AttributeCodec::CODEC_NONE) ? "ATTR" : "ATTC",
             string_size(attribute_set_name) +
             string_size(attribute_name) +
             string_size(element_type) +
-            sizeof(index_t) +
-            sizeof(index_t) +
-            data_size
+            sizeof(Numeric::uint32) +
+            sizeof(Numeric::uint32) +
+            ((codec == AttributeCodec::CODEC_NONE) ?
+             data_size :
+             2*sizeof(Numeric::uint32) + encoded.size())
         );
         
         write_string(
@@ -710,7 +847,16 @@ namespace GEO {
         write_int(index_t(element_size), "the size of an element (in bytes)");
         write_int(dimension, "the number of elements per item");
 
-        if(ascii_) {
+        if(codec != AttributeCodec::CODEC_NONE) {
+            write_int(index_t(codec));
+            write_int(index_t(scalar_size));
+            size_t check = gzwrite_large(
+                file_, encoded.data(), encoded.size()
+            );
+            if(check != encoded.size()) {
+                throw GeoFileException("Could not write attribute data");
+            }
+        } else if(ascii_) {
             AsciiAttributeSerializer write_attribute_func =
                 ascii_attribute_write_[element_type];
             if(write_attribute_func == nullptr) {
@@ -723,8 +869,8 @@ namespace GEO {
                 throw GeoFileException("Could not write attribute data");                
             }
         } else {
-            int check = gzwrite(file_, data, index_t(data_size));
-            if(size_t(check) != data_size) {
+            size_t check = gzwrite_large(file_, data, data_size);
+            if(check != data_size) {
                 throw GeoFileException("Could not write attribute data");
             }
         }
@@ -243,6 +243,50 @@ namespace GEO {
         return true;
     }
 
+#ifndef GARGANTUA
+    /**
+     * \brief Reads an ASCII attribute from a file.
+     * \details Template specialization for 32-bit index_t. Indices
+     *  are parsed as 64-bit integers, so that files written by a geogram
+     *  compiled with GEOGRAM_WITH_GARGANTUA can be read as long as
+     *  all indices fit in 32 bits. The 64-bit NO_INDEX value (-1) is
+     *  mapped to its 32-bit counterpart.
+     * \param[in] file the input file, obtained through fopen()
+     * \param[out] base_addr an array with sufficient space for
+     *  storing nb_elements of type index_t
+     * \param[in] nb_elements the number of elements to be read
+     * \retval true on success
+     * \retval false otherwise
+     */
+    template <> inline bool read_ascii_attribute<index_t>(
+        FILE* file, Memory::pointer base_addr, index_t nb_elements
+    ) {
+        index_t* attrib = reinterpret_cast<index_t*>(base_addr);
+        for(index_t i=0; i<nb_elements; ++i) {
+            std::string buff;
+            int res;
+            while(char(res = fgetc(file)) != '\n') {
+                if(res == EOF) {
+                    return false;
+                }
+                buff.push_back(char(res));
+            }
+            Numeric::uint64 val;
+            if(!String::from_string(buff.c_str(),val)) {
+                return false;
+            }
+            if(val == Numeric::uint64(-1)) {
+                attrib[i] = index_t(-1);
+            } else if(val > Numeric::uint64(index_t(-1))) {
+                return false;
+            } else {
+                attrib[i] = index_t(val);
+            }
+        }
+        return true;
+    }
+#endif
+
     /**************************************************************/
     
     /**
@@ -269,6 +313,10 @@ namespace GEO {
      *    a mesh, each mesh element type (vertices, edges, facets...) 
      *    corresponds to a property set.
      *   - PROP (Property): a property attached to Property Set.
+     *   - ATTC (Encoded attribute): same as an attribute, with the data
+     *    transformed by an AttributeCodec before compression. It is
+     *    only written if OutputGeoFile::set_attribute_codecs() was
+     *    called, and InputGeoFile presents it as a normal attribute.
      *   - SPTR (Separator): marks the boundaries between multiple objects
      *    stored in the same GeoFile
      */
@@ -551,6 +599,45 @@ namespace GEO {
          */
         void write_size(size_t x);
 
+        /**
+         * \brief Reads a number of items from the file.
+         * \details A number of items is stored as an unsigned 32 bits
+         *  integer, or as 0xffffffff followed by an unsigned 64 bits 
+         *  integer if it does not fit in 32 bits. Throws a GeoFileException
+         *  if it does not fit in an index_t (geogram needs to be compiled
+         *  with GEOGRAM_WITH_GARGANTUA to read such a file).
+         * \return the read number of items
+         */
+        index_t read_nb_items();
+
+        /**
+         * \brief Writes a number of items into the file.
+         * \param[in] x the number of items
+         * \param[in] comment an optional comment string, written to
+         *  ASCII geofiles
+         * \see read_nb_items()
+         */
+        void write_nb_items(index_t x, const char* comment = nullptr);
+
+        /**
+         * \brief Gets the size in bytes used by a number of items in
+         *  the file.
+         * \param[in] x the number of items
+         * \return the size in bytes used to store \p x in the file
+         * \see read_nb_items()
+         */
+        static size_t nb_items_size(index_t x) {
+            return (Numeric::uint64(x) < Numeric::uint64(NB_ITEMS_64)) ?
+                sizeof(Numeric::uint32) :
+                sizeof(Numeric::uint32) + sizeof(Numeric::uint64);
+        }
+
+        /**
+         * \brief Marker that indicates that a number of items is 
+         *  stored in 64 bits.
+         */
+        static const Numeric::uint32 NB_ITEMS_64 = 0xffffffffu;
+
         /**
          * \brief Reads a chunk class from the file.
          * \details A chunk class is a 4 characters string.
@@ -594,7 +681,7 @@ namespace GEO {
          *  file.
          */
         size_t string_size(const std::string& s) const {
-            return sizeof(index_t) + s.length();
+            return sizeof(Numeric::uint32) + s.length();
         }
 
         /**
@@ -752,6 +839,8 @@ namespace GEO {
         AttributeSetInfo* current_attribute_set_;
         AttributeInfo* current_attribute_;
         std::string current_comment_;
+        index_t current_attribute_codec_;
+        index_t current_attribute_scalar_size_;
 
     private:        
         /**
@@ -780,6 +869,20 @@ namespace GEO {
          */
         OutputGeoFile(const std::string& filename, index_t compression_level=3);
 
+        /**
+         * \brief Enables or disables attribute encodings.
+         * \details If enabled, attributes of integer and floating point
+         *  types are transformed by an AttributeCodec before compression,
+         *  which makes the files smaller. The encoded attributes are
+         *  stored in ATTC chunks, that cannot be read by versions of
+         *  geogram anterior to their introduction. Disabled by default.
+         * \param[in] x true to enable attribute encodings, false
+         *  otherwise
+         */
+        void set_attribute_codecs(bool x) {
+            attribute_codecs_ = x;
+        }
+
         /**
          * \brief Writes a new attribute set to the file.
          * \param[in] name a const reference to the name of 
@@ -836,6 +939,9 @@ namespace GEO {
          */
         void write_separator();
         
+    protected:
+        bool attribute_codecs_;
+
     private:
         /**
          * \brief Forbids copy.
@@ -330,22 +330,25 @@ namespace GEO {
         }
 
         /**
-         * \brief Generates a random point in a nd triangle.
+         * \brief Generates a random point in a nd triangle from two 
+         *  given random numbers.
          * \details Uses Greg Turk's second method
          *  (see article in Graphic Gems).
          * \param[in] p1 first vertex of the triangle
          * \param[in] p2 second vertex of the triangle
          * \param[in] p3 third vertex of the triangle
-         * \return a random point in triangle ( \p p1, \p p2, \p p3 )
+         * \param[in] l1 , l2 two random numbers uniformly distributed
+         *  in [0,1]
+         * \return a point in triangle ( \p p1, \p p2, \p p3 ), uniformly
+         *  distributed if \p l1 and \p l2 are
          * \tparam VEC the class used to represent the vertices
          *  of the triangle
          */
         template <class VEC>
         inline VEC random_point_in_triangle(
-            const VEC& p1, const VEC& p2, const VEC& p3
+            const VEC& p1, const VEC& p2, const VEC& p3,
+            double l1, double l2
         ) {
-            double l1 = Numeric::random_float64();
-            double l2 = Numeric::random_float64();
             if(l1 + l2 > 1.0) {
                 l1 = 1.0 - l1;
                 l2 = 1.0 - l2;
@@ -355,24 +358,46 @@ namespace GEO {
         }
 
         /**
-         * \brief Generates a random point in a nd tetrahedron.
+         * \brief Generates a random point in a nd triangle.
+         * \details Uses Greg Turk's second method
+         *  (see article in Graphic Gems).
+         * \param[in] p1 first vertex of the triangle
+         * \param[in] p2 second vertex of the triangle
+         * \param[in] p3 third vertex of the triangle
+         * \return a random point in triangle ( \p p1, \p p2, \p p3 )
+         * \tparam VEC the class used to represent the vertices
+         *  of the triangle
+         */
+        template <class VEC>
+        inline VEC random_point_in_triangle(
+            const VEC& p1, const VEC& p2, const VEC& p3
+        ) {
+            double l1 = Numeric::random_float64();
+            double l2 = Numeric::random_float64();
+            return random_point_in_triangle(p1, p2, p3, l1, l2);
+        }
+
+        /**
+         * \brief Generates a random point in a nd tetrahedron from three
+         *  given random numbers.
          * \details Uses Greg Turk's second method
          *  (see article in Graphic Gems).
          * \param[in] p1 first vertex of the triangle
          * \param[in] p2 second vertex of the triangle
          * \param[in] p3 third vertex of the triangle
          * \param[in] p4 fourth vertex of the triangle
-         * \return a random point in tetrahedron ( \p p1, \p p2, \p p3, \p p4)
+         * \param[in] s , t , u three random numbers uniformly distributed
+         *  in [0,1]
+         * \return a point in tetrahedron ( \p p1, \p p2, \p p3, \p p4),
+         *  uniformly distributed if \p s, \p t and \p u are
          * \tparam VEC the class used to represent the vertices
          *  of the triangle
          */
         template <class VEC>
         inline VEC random_point_in_tetra(
-            const VEC& p1, const VEC& p2, const VEC& p3, const VEC& p4
+            const VEC& p1, const VEC& p2, const VEC& p3, const VEC& p4,
+            double s, double t, double u
         ) {
-            double s = Numeric::random_float64();
-            double t = Numeric::random_float64();
-            double u = Numeric::random_float64();
             if(s + t > 1.0) {
                 s = 1.0 - s;
                 t = 1.0 - t;
@@ -390,6 +415,28 @@ namespace GEO {
             return a * p1 + s * p2 + t * p3 + u * p4;
         }
 
+        /**
+         * \brief Generates a random point in a nd tetrahedron.
+         * \details Uses Greg Turk's second method
+         *  (see article in Graphic Gems).
+         * \param[in] p1 first vertex of the triangle
+         * \param[in] p2 second vertex of the triangle
+         * \param[in] p3 third vertex of the triangle
+         * \param[in] p4 fourth vertex of the triangle
+         * \return a random point in tetrahedron ( \p p1, \p p2, \p p3, \p p4)
+         * \tparam VEC the class used to represent the vertices
+         *  of the triangle
+         */
+        template <class VEC>
+        inline VEC random_point_in_tetra(
+            const VEC& p1, const VEC& p2, const VEC& p3, const VEC& p4
+        ) {
+            double s = Numeric::random_float64();
+            double t = Numeric::random_float64();
+            double u = Numeric::random_float64();
+            return random_point_in_tetra(p1, p2, p3, p4, s, t, u);
+        }
+
         /**
          * \brief Computes the point closest to a given point in a nd segment
          * \param[in] point the query point
@@ -182,6 +182,39 @@ namespace GEO {
          */
         float64 GEOGRAM_API random_float64();
 
+        /**
+         * \brief Counter-based random number generator.
+         * \details The returned value only depends on \p seed and 
+         *  \p counter (it uses the SplitMix64 mixing function). Since
+         *  there is no internal state, it can be used concurrently by
+         *  several threads, and the i-th number of a stream can be 
+         *  generated without generating the previous ones. Parallel
+         *  algorithms that use counter i for item i are reproducible
+         *  independently of the number of threads.
+         * \param[in] seed identifies the stream
+         * \param[in] counter index of the number in the stream
+         * \return a 64 bits pseudo-random integer
+         */
+        inline uint64 random_uint64(uint64 seed, uint64 counter) {
+            uint64 z = seed * 0xd1b54a32d192ed03ull +
+                (counter + 1) * 0x9e3779b97f4a7c15ull;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        /**
+         * \brief Counter-based random number generator.
+         * \details \see random_uint64(uint64,uint64)
+         * \param[in] seed identifies the stream
+         * \param[in] counter index of the number in the stream
+         * \return a 64 bits float in [0,1)
+         */
+        inline float64 random_float64(uint64 seed, uint64 counter) {
+            return float64(random_uint64(seed, counter) >> 11) *
+                (1.0 / 9007199254740992.0);
+        }
+
         /**
          * \brief Limits helper class that extends std::numeric_limits
          * \details LimitsHelper extends std::numeric_limits to provide
@@ -0,0 +1,444 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/basic/permutation.h>
+#include <geogram/basic/process.h>
+#include <cstring>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Below this number of elements, permutations are
+     *  applied sequentially.
+     */
+    const index_t MIN_PARALLEL_PERMUTATION_SIZE = 16384;
+
+    /**
+     * \brief Maximum number of elements moved by a piece of a cycle.
+     * \details Longer cycles are split into pieces, applied in parallel.
+     *  For a random permutation, most of the elements are in a few
+     *  giant cycles, that would be applied sequentially otherwise.
+     */
+    const index_t MAX_PIECE_SIZE = 4096;
+
+    /**
+     * \brief Indicates that a piece is a complete cycle.
+     */
+    const index_t NO_PIECE = index_t(-1);
+
+    /**
+     * \brief A piece of a cycle of a permutation.
+     * \details A piece moves the elements at the \p length positions
+     *  of the cycle that start at position \p first.
+     */
+    struct PermutationPiece {
+        /** \brief the first position of the piece */
+        index_t first;
+
+        /** \brief the number of positions in the piece */
+        index_t length;
+
+        /**
+         * \brief the index of the next piece of the same cycle,
+         *  or NO_PIECE if the piece is a complete cycle
+         */
+        index_t next;
+
+        /**
+         * \brief the index of the element of the scratch buffer
+         *  where the value at position \p first is saved, if the piece
+         *  is not a complete cycle
+         */
+        index_t slot;
+    };
+
+    /**
+     * \brief A contiguous range of pieces to be applied to an array.
+     */
+    struct PermutationTask {
+        index_t array;
+        index_t pieces_begin;
+        index_t pieces_end;
+    };
+
+    /**
+     * \brief Applies a range of pieces of a permutation to an array.
+     * \details Does not modify the permutation, so that several
+     *  threads can use it simultaneously, on disjoint pieces
+     *  or on different arrays. Each piece that is not a complete
+     *  cycle takes the value of the position that follows it from
+     *  the scratch buffer, where it was saved before the next piece
+     *  overwrites it.
+     * \param[in,out] data the array to be permuted
+     * \param[in] elemsize the size of the elements of \p data, in bytes
+     * \param[in] permutation the permutation
+     * \param[in] pieces the pieces of the cycles of the permutation
+     * \param[in] scratch the saved first values of the pieces that
+     *  are not complete cycles
+     * \param[in] b , e the range of pieces to be applied
+     */
+    void apply_pieces(
+        Memory::pointer data, index_t elemsize,
+        const vector<index_t>& permutation,
+        const vector<PermutationPiece>& pieces,
+        Memory::pointer scratch,
+        index_t b, index_t e
+    ) {
+        Memory::byte* temp = static_cast<Memory::byte*>(alloca(elemsize));
+        for(index_t p=b; p<e; ++p) {
+            const PermutationPiece& piece = pieces[p];
+            index_t i = piece.first;
+            const Memory::byte* last_value = temp;
+            if(piece.next == NO_PIECE) {
+                Memory::copy(temp, data + size_t(i) * elemsize, elemsize);
+            } else {
+                last_value =
+                    scratch + size_t(pieces[piece.next].slot) * elemsize;
+            }
+            for(index_t k=1; k<piece.length; ++k) {
+                index_t j = permutation[i];
+                Memory::copy(
+                    data + size_t(i) * elemsize,
+                    data + size_t(j) * elemsize,
+                    elemsize
+                );
+                i = j;
+            }
+            Memory::copy(data + size_t(i) * elemsize, last_value, elemsize);
+        }
+    }
+}
+
+namespace GEO {
+
+    namespace Permutation {
+
+        void apply_without_marks(
+            void* data, const vector<index_t>& permutation,
+            index_t elemsize
+        ) {
+            Memory::pointer pdata = Memory::pointer(data);
+            geo_debug_assert(is_valid(permutation));
+            index_t N = permutation.size();
+            std::vector<bool> visited(N, false);
+            Memory::byte* temp = static_cast<Memory::byte*>(alloca(elemsize));
+            for(index_t k = 0; k < N; k++) {
+                if(visited[k]) {
+                    continue;
+                }
+                visited[k] = true;
+                index_t i = k;
+                index_t j = permutation[k];
+                if(j == k) {
+                    continue;
+                }
+                Memory::copy(temp, pdata + size_t(i) * elemsize, elemsize);
+                while(j != k) {
+                    Memory::copy(
+                        pdata + size_t(i) * elemsize,
+                        pdata + size_t(j) * elemsize,
+                        elemsize
+                    );
+                    visited[j] = true;
+                    i = j;
+                    j = permutation[j];
+                }
+                Memory::copy(pdata + size_t(i) * elemsize, temp, elemsize);
+            }
+        }
+
+        void parallel_apply(
+            const vector<void*>& data, const vector<index_t>& elemsize,
+            const vector<index_t>& permutation
+        ) {
+            geo_assert(data.size() == elemsize.size());
+            geo_debug_assert(is_valid(permutation));
+            index_t N = permutation.size();
+
+            if(
+                Process::maximum_concurrent_threads() == 1 ||
+                Process::is_running_threads() ||
+                N < MIN_PARALLEL_PERMUTATION_SIZE
+            ) {
+                for(index_t a=0; a<data.size(); ++a) {
+                    apply_without_marks(data[a], permutation, elemsize[a]);
+                }
+                return;
+            }
+
+            // Step 1: find the (non-trivial) cycles of the permutation,
+            // split the long ones into pieces, and compute the cumulated
+            // lengths of the pieces, used to balance the work.
+            vector<PermutationPiece> pieces;
+            vector<index_t> pieces_end;
+            index_t nb_slots = 0;
+            index_t nb_moved = 0;
+            std::vector<bool> visited(N, false);
+            for(index_t k = 0; k < N; ++k) {
+                if(visited[k]) {
+                    continue;
+                }
+                visited[k] = true;
+                index_t j = permutation[k];
+                if(j == k) {
+                    continue;
+                }
+                index_t cycle_begin = pieces.size();
+                PermutationPiece piece;
+                piece.first = k;
+                piece.length = 1;
+                piece.next = NO_PIECE;
+                piece.slot = NO_PIECE;
+                while(j != k) {
+                    visited[j] = true;
+                    if(piece.length == MAX_PIECE_SIZE) {
+                        nb_moved += piece.length;
+                        pieces.push_back(piece);
+                        pieces_end.push_back(nb_moved);
+                        piece.first = j;
+                        piece.length = 0;
+                    }
+                    ++piece.length;
+                    j = permutation[j];
+                }
+                nb_moved += piece.length;
+                pieces.push_back(piece);
+                pieces_end.push_back(nb_moved);
+                // Link the pieces of a split cycle, each one gets a slot
+                // in the scratch buffer for its first value.
+                index_t cycle_end = pieces.size();
+                if(cycle_end - cycle_begin > 1) {
+                    for(index_t p=cycle_begin; p<cycle_end; ++p) {
+                        pieces[p].next = (p+1 == cycle_end) ?
+                            cycle_begin : p+1;
+                        pieces[p].slot = nb_slots;
+                        ++nb_slots;
+                    }
+                }
+            }
+
+            if(pieces.size() == 0) {
+                return;
+            }
+
+            // Step 2: split the work into tasks, each task applies
+            // a range of pieces to one of the arrays.
+            double total_work = 0.0;
+            for(index_t a=0; a<data.size(); ++a) {
+                total_work += double(nb_moved) * double(elemsize[a]);
+            }
+            double task_work =
+                total_work / double(4 * Process::maximum_concurrent_threads());
+
+            vector<PermutationTask> tasks;
+            for(index_t a=0; a<data.size(); ++a) {
+                index_t task_size = std::max(
+                    index_t(1), index_t(task_work / double(elemsize[a]))
+                );
+                index_t b = 0;
+                while(b < pieces.size()) {
+                    index_t first_pos = (b == 0) ? 0 : pieces_end[b-1];
+                    index_t e = b+1;
+                    while(
+                        e < pieces.size() &&
+                        pieces_end[e] - first_pos <= task_size
+                    ) {
+                        ++e;
+                    }
+                    PermutationTask task;
+                    task.array = a;
+                    task.pieces_begin = b;
+                    task.pieces_end = e;
+                    tasks.push_back(task);
+                    b = e;
+                }
+            }
+
+            // Step 3: save the first value of the pieces of the split
+            // cycles, that are overwritten by the previous piece. The
+            // scratch buffer has one element per piece (at most one per
+            // MAX_PIECE_SIZE moved elements, plus one per split cycle).
+            vector<size_t> scratch_offset(data.size()+1, 0);
+            for(index_t a=0; a<data.size(); ++a) {
+                scratch_offset[a+1] =
+                    scratch_offset[a] + size_t(nb_slots) * elemsize[a];
+            }
+            std::vector<Memory::byte> scratch(scratch_offset[data.size()]);
+            if(nb_slots != 0) {
+                parallel_for_slice(
+                    0, index_t(pieces.size()),
+                    [&](index_t from, index_t to) {
+                        for(index_t p=from; p<to; ++p) {
+                            const PermutationPiece& piece = pieces[p];
+                            if(piece.next == NO_PIECE) {
+                                continue;
+                            }
+                            for(index_t a=0; a<data.size(); ++a) {
+                                Memory::copy(
+                                    scratch.data() + scratch_offset[a] +
+                                    size_t(piece.slot) * elemsize[a],
+                                    Memory::pointer(data[a]) +
+                                    size_t(piece.first) * elemsize[a],
+                                    elemsize[a]
+                                );
+                            }
+                        }
+                    }
+                );
+            }
+
+            // Step 4: apply the pieces in parallel.
+            parallel_for(
+                0, index_t(tasks.size()),
+                [&](index_t t) {
+                    const PermutationTask& task = tasks[t];
+                    apply_pieces(
+                        Memory::pointer(data[task.array]),
+                        elemsize[task.array],
+                        permutation, pieces,
+                        scratch.data() + scratch_offset[task.array],
+                        task.pieces_begin, task.pieces_end
+                    );
+                },
+                1, true // interleaved, for better load balancing
+            );
+        }
+
+        void parallel_compress(
+            const vector<void*>& data, const vector<index_t>& elemsize,
+            const vector<index_t>& old2new
+        ) {
+            geo_assert(data.size() == elemsize.size());
+
+            index_t N = old2new.size();
+
+            if(
+                Process::maximum_concurrent_threads() == 1 ||
+                N < MIN_PARALLEL_PERMUTATION_SIZE
+            ) {
+                // Each run of consecutive kept elements is moved
+                // with a single memmove().
+                index_t i = 0;
+                while(i < N) {
+                    index_t j = old2new[i];
+                    if(j == index_t(-1) || j == i) {
+                        ++i;
+                        continue;
+                    }
+                    geo_debug_assert(j < i);
+                    index_t e = i+1;
+                    while(e < N && old2new[e] == j + (e - i)) {
+                        ++e;
+                    }
+                    for(index_t a=0; a<data.size(); ++a) {
+                        Memory::pointer base = Memory::pointer(data[a]);
+                        size_t size = elemsize[a];
+                        ::memmove(
+                            base + size_t(j) * size,
+                            base + size_t(i) * size,
+                            size_t(e - i) * size
+                        );
+                    }
+                    i = e;
+                }
+                return;
+            }
+
+            // The elements to be moved, in increasing order. Their
+            // destinations are contiguous, starting from first_dest.
+            vector<index_t> moved;
+            index_t first_dest = 0;
+            for(index_t i=0; i<N; ++i) {
+                index_t j = old2new[i];
+                if(j == index_t(-1) || j == i) {
+                    continue;
+                }
+                geo_debug_assert(j < i);
+                if(moved.size() == 0) {
+                    first_dest = j;
+                }
+                geo_debug_assert(j == first_dest + moved.size());
+                moved.push_back(i);
+            }
+
+            if(moved.size() == 0) {
+                return;
+            }
+
+            // Arrays are processed one at a time, so that the
+            // temporary buffer is not larger than the largest array.
+            vector<Memory::byte> temp;
+            for(index_t a=0; a<data.size(); ++a) {
+                Memory::pointer base = Memory::pointer(data[a]);
+                size_t size = elemsize[a];
+                temp.resize(size * moved.size());
+                parallel_for_slice(
+                    0, moved.size(),
+                    [&](index_t b, index_t e) {
+                        for(index_t k=b; k<e; ++k) {
+                            Memory::copy(
+                                temp.data() + size_t(k) * size,
+                                base + size_t(moved[k]) * size,
+                                size
+                            );
+                        }
+                    }
+                );
+                parallel_for_slice(
+                    0, moved.size(),
+                    [&](index_t b, index_t e) {
+                        Memory::copy(
+                            base + (size_t(first_dest) + b) * size,
+                            temp.data() + size_t(b) * size,
+                            size_t(e - b) * size
+                        );
+                    }
+                );
+            }
+        }
+    }
+}
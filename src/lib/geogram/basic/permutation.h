@@ -195,6 +195,24 @@ namespace GEO {
             }
         }
 
+        /**
+         * \brief Applies a permutation in-place, without changing it.
+         * \details Does the same thing as
+         *  apply(void*, const vector<index_t>&, index_t), but
+         *  the visited elements are stored in a separate bit vector
+         *  instead of being marked in \p permutation. Thus several
+         *  threads can apply the same permutation to different arrays
+         *  simultaneously.
+         * \param[in,out] data an array of \c permutation.size() elements to
+         *  permute
+         * \param[in] permutation the permutation
+         * \param[in] elemsize size of the vector elements
+         */
+        void GEOGRAM_API apply_without_marks(
+            void* data, const vector<index_t>& permutation,
+            index_t elemsize
+        );
+
         /**
          * \brief Applies a permutation in-place.
          * Permutes the first \p N elements of vector \p data using
@@ -300,6 +318,84 @@ namespace GEO {
             }
         }
 
+        /**
+         * \brief Applies a permutation in-place to several arrays,
+         *  in parallel.
+         * \details This is equivalent to calling apply() on each array.
+         *  The cycles of the permutation are computed once, and the long
+         *  ones are split into pieces of bounded length, so that a
+         *  permutation with a single giant cycle is also applied in
+         *  parallel. Then the arrays and the pieces are distributed
+         *  among the threads. Each piece is followed in-place (no copy
+         *  of the arrays is made), the additional memory is the list of
+         *  pieces and one element per piece of a split cycle.
+         * \param[in] data the arrays to be permuted, each array
+         *  has at least \c permutation.size() elements
+         * \param[in] elemsize the size of the elements of each array,
+         *  in bytes
+         * \param[in] permutation the permutation. It is not modified,
+         *  thus several threads can use it simultaneously.
+         */
+        void GEOGRAM_API parallel_apply(
+            const vector<void*>& data, const vector<index_t>& elemsize,
+            const vector<index_t>& permutation
+        );
+
+        /**
+         * \brief Applies a permutation in-place to an array, in parallel.
+         * \see parallel_apply(const vector<void*>&, const vector<index_t>&,
+         *   const vector<index_t>&)
+         * \param[in,out] data an array of \c permutation.size() elements to
+         *  permute
+         * \param[in] permutation the permutation.
+         * \param[in] elemsize size of the elements
+         */
+        inline void parallel_apply(
+            void* data, const vector<index_t>& permutation, index_t elemsize
+        ) {
+            parallel_apply(
+                vector<void*>(1, data), vector<index_t>(1, elemsize),
+                permutation
+            );
+        }
+
+        /**
+         * \brief Removes elements in-place from several arrays,
+         *  in parallel.
+         * \details The elements that are kept are moved to their new
+         *  position, elements that are before the first removed one are
+         *  not touched. The moved elements of each array are gathered
+         *  in parallel into a temporary buffer, then copied back.
+         * \param[in] data the arrays to be compressed, each array
+         *  has at least \c old2new.size() elements
+         * \param[in] elemsize the size of the elements of each array,
+         *  in bytes
+         * \param[in] old2new the new index of each element, or
+         *  index_t(-1) if the element is removed. The new indices
+         *  of the kept elements are 0,1,2... in increasing order.
+         */
+        void GEOGRAM_API parallel_compress(
+            const vector<void*>& data, const vector<index_t>& elemsize,
+            const vector<index_t>& old2new
+        );
+
+        /**
+         * \brief Removes elements in-place from an array, in parallel.
+         * \see parallel_compress(const vector<void*>&,
+         *   const vector<index_t>&, const vector<index_t>&)
+         * \param[in,out] data an array of \c old2new.size() elements
+         * \param[in] old2new the new index of each element, or
+         *  index_t(-1) if the element is removed.
+         * \param[in] elemsize size of the elements
+         */
+        inline void parallel_compress(
+            void* data, const vector<index_t>& old2new, index_t elemsize
+        ) {
+            parallel_compress(
+                vector<void*>(1, data), vector<index_t>(1, elemsize),
+                old2new
+            );
+        }
     }
 }
 
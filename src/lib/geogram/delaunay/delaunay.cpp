@@ -252,6 +252,31 @@ namespace GEO {
         }
     }
 
+#ifdef GARGANTUA
+    void Delaunay::set_arrays(
+        index_t nb_cells,
+        const int* cell_to_v, const int* cell_to_cell
+    ) {
+        converted_cell_to_v_.resize(nb_cells * cell_v_stride_);
+        for(index_t i = 0; i < converted_cell_to_v_.size(); ++i) {
+            converted_cell_to_v_[i] = signed_index_t(cell_to_v[i]);
+        }
+        if(cell_to_cell != nullptr) {
+            converted_cell_to_cell_.resize(nb_cells * cell_neigh_stride_);
+            for(index_t i = 0; i < converted_cell_to_cell_.size(); ++i) {
+                converted_cell_to_cell_[i] = signed_index_t(cell_to_cell[i]);
+            }
+        } else {
+            converted_cell_to_cell_.clear();
+        }
+        set_arrays(
+            nb_cells,
+            converted_cell_to_v_.data(),
+            cell_to_cell == nullptr ? nullptr : converted_cell_to_cell_.data()
+        );
+    }
+#endif
+    
     bool Delaunay::supports_constraints() const {
         return false;
     }
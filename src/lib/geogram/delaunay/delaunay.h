@@ -677,6 +677,23 @@ namespace GEO {
             const signed_index_t* cell_to_v, const signed_index_t* cell_to_cell
         );
 
+#ifdef GARGANTUA
+        /**
+         * \brief Sets the arrays that represent the combinatorics
+         *  of this Delaunay from 32 bits arrays.
+         * \details Used by the wrappers around external libraries
+         *  (tetgen, triangle) that use 32 bits indices. The arrays
+         *  are converted into 64 bits arrays stored in this Delaunay.
+         * \param[in] nb_cells number of cells
+         * \param[in] cell_to_v the cell-to-vertex incidence array
+         * \param[in] cell_to_cell the cell-to-cell adjacency array
+         */
+        void set_arrays(
+            index_t nb_cells,
+            const int* cell_to_v, const int* cell_to_cell
+        );
+#endif
+
         /**
          * \brief Stores for each vertex v a cell incident to v.
          */
@@ -750,6 +767,10 @@ namespace GEO {
         index_t nb_cells_;
         const signed_index_t* cell_to_v_;
         const signed_index_t* cell_to_cell_;
+#ifdef GARGANTUA
+        vector<signed_index_t> converted_cell_to_v_;
+        vector<signed_index_t> converted_cell_to_cell_;
+#endif
         vector<signed_index_t> v_to_cell_;
         vector<signed_index_t> cicl_;
         bool is_locked_;
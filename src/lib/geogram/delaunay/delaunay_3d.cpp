@@ -563,6 +563,10 @@ namespace GEO {
             pv[1] = vertex_ptr(finite_tet_vertex(t,1));
             pv[2] = vertex_ptr(finite_tet_vertex(t,2));
             pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+
+            // Orientations of p relative to the facets of t, evaluated
+            // on demand, in walk order.
+            PCK::TetFacetsOrient3d orient_facet(pv, p);
             
             // Start from a random facet
             index_t f0 = index_t(Numeric::random_int32()) % 4;
@@ -599,15 +603,12 @@ namespace GEO {
                 // convention as in CGAL).
                 // This is equivalent to tet_facet_point_orient3d(t,f,p)
                 // (but less costly, saves a couple of lookups)
-                const double* pv_bkp = pv[f];
-                pv[f] = p;
-                orient[f] = PCK::orient_3d(pv[0], pv[1], pv[2], pv[3]);
+                orient[f] = orient_facet(f);
 
                 //   If the orientation is not negative, then we cannot
                 // walk towards t_next, and examine the next candidate
                 // (or exit the loop if they are exhausted).
                 if(orient[f] != NEGATIVE) {
-                    pv[f] = pv_bkp;
                     continue;
                 }
 
@@ -1165,6 +1165,10 @@ namespace GEO {
                  pv[1] = vertex_ptr(finite_tet_vertex(t,1));
                  pv[2] = vertex_ptr(finite_tet_vertex(t,2));
                  pv[3] = vertex_ptr(finite_tet_vertex(t,3));
+
+                 // Orientations of p relative to the facets of t, evaluated
+                 // on demand, in walk order.
+                 PCK::TetFacetsOrient3d orient_facet(pv, p);
                  
                  // Start from a random facet
                  index_t f0 = thread_safe_random_4();
@@ -1199,15 +1203,12 @@ namespace GEO {
                      // convention as in CGAL).
                      // This is equivalent to tet_facet_point_orient3d(t,f,p)
                      // (but less costly, saves a couple of lookups)
-                     const double* pv_bkp = pv[f];
-                     pv[f] = p;
-                     orient[f] = PCK::orient_3d(pv[0], pv[1], pv[2], pv[3]);
+                     orient[f] = orient_facet(f);
                      
                      //   If the orientation is not negative, then we cannot
                      // walk towards t_next, and examine the next candidate
                      // (or exit the loop if they are exhausted).
                      if(orient[f] != NEGATIVE) {
-                         pv[f] = pv_bkp;
                          continue;
                      }
 
@@ -2693,6 +2694,18 @@ namespace GEO {
         }
         Delaunay::set_vertices(nb_vertices, vertices);
 
+#ifndef GARGANTUA
+        // Cells are referred to by signed 32 bits indices in
+        // cell_to_v_store_ and cell_to_cell_store_.
+        if(Numeric::uint64(nb_vertices) * 7 * 4 > Numeric::uint64(INT32_MAX)) {
+            Logger::err("PDEL") << "indices will overflow" << std::endl;
+            Logger::err("PDEL")
+                << "recompile geogram with GEOGRAM_WITH_GARGANTUA "
+                << "to activate 64 bits indices" << std::endl;
+            geo_assert_not_reached;
+        }
+#endif
+        
         index_t expected_tetra = nb_vertices * 7;
     
         // Allocate the tetrahedra
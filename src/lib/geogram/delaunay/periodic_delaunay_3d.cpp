@@ -119,16 +119,21 @@ namespace {
      *  of the integer.
      */
     inline index_t pop_count(index_t x) {
-	static_assert(
-	    sizeof(index_t) == 4, "Only supported with 32 bit indices"
-	);
 #if defined(GEO_COMPILER_GCC_FAMILY)
+#ifdef GARGANTUA
+	return index_t(__builtin_popcountll(x));
+#else	
 	return index_t(__builtin_popcount(x));
+#endif	
 #elif defined(GEO_COMPILER_MSVC)
+#ifdef GARGANTUA
+	return index_t(__popcnt64(x));
+#else	
 	return index_t(__popcnt(x));
+#endif	
 #else
 	int result = 0;
-	for(int b=0; b<32; ++b) {
+	for(index_t b=0; b<8*sizeof(index_t); ++b) {
 	    result += ((x & 1) != 0);
 	    x >>= 1;
 	}
@@ -326,6 +326,10 @@ namespace GEO {
 	index_t x_;
     };
 
+    // In GARGANTUA mode, index_t is Numeric::uint64 (already
+    // specialized above).
+#ifndef GARGANTUA
+    
     /**
      * \brief lua_to specialization for Numeric::uint64.
      */
@@ -344,6 +348,8 @@ namespace GEO {
 	Numeric::uint64 x_;
     };
 
+#endif
+
     /**
      * \brief lua_to specialization for Numeric::int64.
      */
@@ -501,6 +507,10 @@ namespace GEO {
 	lua_pushinteger(L,lua_Integer(x));
     }
 
+    // In GARGANTUA mode, index_t is Numeric::uint64 (already
+    // specialized above).
+#ifndef GARGANTUA
+    
     /**
      * \brief Specialization of lua_push() for Numeric::uint64.
      */
@@ -508,6 +518,8 @@ namespace GEO {
 	lua_pushinteger(L,lua_Integer(x));
     }
 
+#endif
+
     /**
      * \brief Specialization of lua_push() for Numeric::int64.
      */
@@ -48,12 +48,16 @@
 #include <geogram/basic/logger.h>
 #include <geogram/basic/algorithm.h>
 #include <geogram/basic/string.h>
+#include <geogram/basic/process.h>
+#include <geogram/mesh/mesh_incidence.h>
 
 namespace GEO {
 
     MeshSubElementsStore::MeshSubElementsStore(Mesh& mesh) :
         mesh_(mesh),
-        nb_(0) {
+        nb_(0),
+        timestamp_(0),
+        vertices_modified_(false) {
     }
 
     MeshSubElementsStore::~MeshSubElementsStore() {
@@ -64,11 +68,13 @@ namespace GEO {
     ) {
         attributes_.clear(keep_attributes, keep_memory);
         nb_ = 0;
+        touch();
     }
 
     void MeshSubElementsStore::resize_store(index_t new_size) {
         attributes_.resize(new_size);
         nb_ = new_size;
+        touch();
     }
     
     /*************************************************************************/
@@ -78,6 +84,57 @@ namespace GEO {
 
     MeshElements::~MeshElements() {
     }
+
+    void MeshElements::mark_for_deletion(const vector<index_t>& to_delete) {
+        if(to_delete.size() > marked_.size()) {
+            marked_.resize(to_delete.size(), 0);
+        }
+        for(index_t e=0; e<to_delete.size(); ++e) {
+            if(to_delete[e] != 0) {
+                marked_[e] = 1;
+            }
+        }
+    }
+
+    void MeshElements::get_marked_elements(
+        vector<index_t>& to_delete, index_t nb
+    ) {
+        geo_assert(marked_.size() <= nb);
+        to_delete.assign(nb, 0);
+        for(index_t e=0; e<marked_.size(); ++e) {
+            to_delete[e] = index_t(marked_[e]);
+        }
+        marked_.clear();
+    }
+
+    void MeshElements::permute_marked_elements(
+        const vector<index_t>& permutation
+    ) {
+        if(marked_.size() == 0) {
+            return;
+        }
+        marked_.resize(permutation.size(), 0);
+        Permutation::apply(
+            marked_.data(), permutation, index_t(sizeof(Numeric::uint8))
+        );
+    }
+
+    void MeshElements::compress_marked_elements(
+        const vector<index_t>& old2new
+    ) {
+        index_t new_size = 0;
+        for(index_t e=0; e<marked_.size(); ++e) {
+            index_t new_e = old2new[e];
+            if(new_e != index_t(-1) && marked_[e] != 0) {
+                // new_e <= e, thus marked_[new_e] is no longer used
+                marked_[new_e] = 1;
+                new_size = new_e+1;
+            } else if(new_e != index_t(-1)) {
+                marked_[new_e] = 0;
+            }
+        }
+        marked_.resize(new_size);
+    }
     
     /*************************************************************************/
     
@@ -138,6 +195,8 @@ namespace GEO {
     void MeshVertices::clear(bool keep_attributes, bool keep_memory) {
         bool singlep = single_precision();
         index_t dim = dimension();
+
+        clear_marked_elements();
         
         //   We need to unbind point attributes
         // because it is not correct to clear the
@@ -188,62 +247,66 @@ namespace GEO {
                 }
             }
             attributes_.compress(old2new);
+            compress_marked_elements(old2new);
             // cur now contains the new size.
             resize_store(cur);
-
-            for(index_t e=0; e<edges_.nb(); ++e) {
-                for(index_t lv=0; lv<2; ++lv) {
-                    index_t v = edges_.vertex(e,lv);
-                    v = old2new[v];
-                    edges_.set_vertex(e,lv,v);
-                }
-            }
-            
-            for(index_t c=0; c<facet_corners_.nb(); ++c) {
-                index_t v = facet_corners_.vertex(c);
-                v = old2new[v];
-                facet_corners_.set_vertex(c,v);
-            }
-
-            for(index_t c=0; c<cell_corners_.nb(); ++c) {
-                index_t v = cell_corners_.vertex(c);
-                // Cells can have padding
-                if(v == NO_VERTEX) {
-                    continue;
-                }
-                v = old2new[v];
-                cell_corners_.set_vertex(c,v);
-            }
+            update_vertex_indices(old2new);
         }
     }
 
+    void MeshVertices::delete_marked_elements(bool remove_isolated_vertices) {
+        vector<index_t> to_delete;
+        get_marked_elements(to_delete, nb());
+        delete_elements(to_delete, remove_isolated_vertices);
+    }
+
     void MeshVertices::permute_elements(vector<index_t>& permutation) {
         attributes_.apply_permutation(permutation);
+        permute_marked_elements(permutation);
+        touch();
         Permutation::invert(permutation);
+        update_vertex_indices(permutation);
+    }
+
+    void MeshVertices::update_vertex_indices(const vector<index_t>& old2new) {
+        parallel_for_slice(
+            0, edges_.nb(),
+            [this,&old2new](index_t from, index_t to) {
+                for(index_t e=from; e<to; ++e) {
+                    for(index_t lv=0; lv<2; ++lv) {
+                        index_t v = edges_.vertex(e,lv);
+                        v = old2new[v];
+                        edges_.set_vertex(e,lv,v);
+                    }
+                }
+            }
+        );
 
-        for(index_t e=0; e<edges_.nb(); ++e) {
-            for(index_t lv=0; lv<2; ++lv) {
-                index_t v = edges_.vertex(e,lv);
-                v = permutation[v];
-                edges_.set_vertex(e,lv,v);
+        parallel_for_slice(
+            0, facet_corners_.nb(),
+            [this,&old2new](index_t from, index_t to) {
+                for(index_t c=from; c<to; ++c) {
+                    index_t v = facet_corners_.vertex(c);
+                    v = old2new[v];
+                    facet_corners_.set_vertex(c,v);
+                }
             }
-        }
-        
-        for(index_t c=0; c<facet_corners_.nb(); ++c) {
-            index_t v = facet_corners_.vertex(c);
-            v = permutation[v];
-            facet_corners_.set_vertex(c,v);
-        }
+        );
 
-        for(index_t c=0; c<cell_corners_.nb(); ++c) {
-            index_t v = cell_corners_.vertex(c);
-            // Cells can have padding
-            if(v == NO_VERTEX) {
-                continue;
+        parallel_for_slice(
+            0, cell_corners_.nb(),
+            [this,&old2new](index_t from, index_t to) {
+                for(index_t c=from; c<to; ++c) {
+                    index_t v = cell_corners_.vertex(c);
+                    // Cells can have padding
+                    if(v == NO_VERTEX) {
+                        continue;
+                    }
+                    v = old2new[v];
+                    cell_corners_.set_vertex(c,v);
+                }
             }
-            v = permutation[v];
-            cell_corners_.set_vertex(c,v);
-        }
+        );
     }
 
     void MeshVertices::remove_isolated() {
@@ -319,6 +382,8 @@ namespace GEO {
     void MeshVertices::pop() {
         geo_debug_assert(nb() != 0);
         --nb_;
+        truncate_marked_elements(nb_);
+        touch();
     }
     
     /**************************************************************************/
@@ -353,26 +418,35 @@ namespace GEO {
                 edges_old2new[e] = NO_FACET;
             } else {
                 edges_old2new[e] = new_nb_edges;
-                if(new_nb_edges != e) {
-                    edge_vertex_[2*new_nb_edges]   = edge_vertex_[2*e];
-                    edge_vertex_[2*new_nb_edges+1] = edge_vertex_[2*e+1];
-                }
                 ++new_nb_edges;
             }
         }
 
+        Permutation::parallel_compress(
+            edge_vertex_.data(), edges_old2new, index_t(sizeof(index_t) * 2)
+        );
+
         // Manage facets store and attributes
         attributes().compress(edges_old2new);
+        compress_marked_elements(edges_old2new);
         resize_store(new_nb_edges);
 
         if(remove_isolated_vertices) {
             mesh_.vertices.remove_isolated();
         }
     }
+
+    void MeshEdges::delete_marked_elements(bool remove_isolated_vertices) {
+        vector<index_t> to_delete;
+        get_marked_elements(to_delete, nb());
+        delete_elements(to_delete, remove_isolated_vertices);
+    }
     
     void MeshEdges::permute_elements(vector<index_t>& permutation) {
         attributes_.apply_permutation(permutation);
-        Permutation::apply(
+        permute_marked_elements(permutation);
+        touch();
+        Permutation::parallel_apply(
             edge_vertex_.data(),
             permutation,
             index_t(sizeof(index_t) * 2)
@@ -380,12 +454,14 @@ namespace GEO {
     }
     
     void MeshEdges::clear(bool keep_attributes, bool keep_memory) {
+        clear_marked_elements();
         clear_store(keep_attributes, keep_memory);
     }
 
     void MeshEdges::pop() {
         geo_debug_assert(nb() != 0);
         resize_store(nb()-1);
+        truncate_marked_elements(nb());
     }
 
     void MeshEdges::clear_store(
@@ -468,6 +544,7 @@ namespace GEO {
     }
 
     void MeshFacets::clear(bool keep_attributes, bool keep_memory) {
+        clear_marked_elements();
         facet_corners_.clear_store(keep_attributes, keep_memory);
         clear_store(keep_attributes, keep_memory);
 	is_simplicial();
@@ -499,12 +576,9 @@ namespace GEO {
         index_t new_nb_facets = 0;
         index_t new_nb_corners = 0;
 
-        // If there are some corner attributes, we need
-        // to compute the index mapping for them.
-        vector<index_t> corners_old2new;
-        if(facet_corners_.attributes().nb() != 0) {
-            corners_old2new.resize(facet_corners_.nb(), index_t(-1));
-        }
+        // Index mapping for the corners, used to compress the
+        // corners arrays and the corner attributes.
+        vector<index_t> corners_old2new(facet_corners_.nb(), index_t(-1));
 
         for(index_t f = 0; f < nb(); ++f) {
             if(facets_old2new[f] != 0) {
@@ -515,15 +589,7 @@ namespace GEO {
                     facet_ptr_[new_nb_facets] = new_nb_corners;
                 }
                 for(index_t co = corners_begin(f); co != corners_end(f); ++co) {
-                    if(corners_old2new.size() != 0) {
-                        corners_old2new[co] = new_nb_corners;
-                    }
-                    if(co != new_nb_corners) {
-                        corner_vertex[new_nb_corners] =
-                            corner_vertex[co];
-                        corner_adjacent_facet[new_nb_corners] =
-                            corner_adjacent_facet[co];
-                    }
+                    corners_old2new[co] = new_nb_corners;
                     new_nb_corners++;
                 }
                 new_nb_facets++;
@@ -534,22 +600,34 @@ namespace GEO {
             facet_ptr_[new_nb_facets] = new_nb_corners;
         }
 
+        {
+            vector<void*> data;
+            data.push_back(corner_vertex.data());
+            data.push_back(corner_adjacent_facet.data());
+            vector<index_t> elemsize(2, index_t(sizeof(index_t)));
+            Permutation::parallel_compress(data, elemsize, corners_old2new);
+        }
+
         // Map adjacent facets indices
-        for(index_t c = 0; c < facet_corners_.nb(); ++c) {
-            index_t f = corner_adjacent_facet[c];
-            if(f != NO_FACET) {
-                corner_adjacent_facet[c] = facets_old2new[f];
+        parallel_for_slice(
+            0, new_nb_corners,
+            [&](index_t from, index_t to) {
+                for(index_t c = from; c < to; ++c) {
+                    index_t f = corner_adjacent_facet[c];
+                    if(f != NO_FACET) {
+                        corner_adjacent_facet[c] = facets_old2new[f];
+                    }
+                }
             }
-        }
+        );
 
         // Manage facets store and attributes
         attributes().compress(facets_old2new);
+        compress_marked_elements(facets_old2new);
         resize_store(new_nb_facets);
 
         // Manage corners store and attributes
-        if(corners_old2new.size() != 0) {
-            // corners index mapping is computed only if there
-            // were some corner attributes.
+        if(facet_corners_.attributes().nb() != 0) {
             facet_corners_.attributes().compress(corners_old2new);
         }
         facet_corners_.resize_store(new_nb_corners);
@@ -558,27 +636,54 @@ namespace GEO {
             mesh_.vertices.remove_isolated();
         }
     }
+
+    void MeshFacets::delete_marked_elements(bool remove_isolated_vertices) {
+        vector<index_t> to_delete;
+        get_marked_elements(to_delete, nb());
+        delete_elements(to_delete, remove_isolated_vertices);
+    }
         
     void MeshFacets::permute_elements(vector<index_t>& permutation) {
         attributes_.apply_permutation(permutation);
+        permute_marked_elements(permutation);
+        touch();
 
         vector<index_t>& corner_vertex = facet_corners_.corner_vertex_;
         vector<index_t>& corner_adjacent_facet =
             facet_corners_.corner_adjacent_facet_;
 
-        if(facet_corners_.attributes().nb() != 0) {
-            vector<index_t> facet_corners_permutation;
-            facet_corners_permutation.reserve(facet_corners_.nb());
-
+        // Corners of the new facet f start at new_facet_ptr[f]
+        vector<index_t> new_facet_ptr;
+        if(!is_simplicial_) {
+            new_facet_ptr.resize(nb()+1);
+            new_facet_ptr[0] = 0;
             for(index_t new_f=0; new_f<nb(); ++new_f) {
-                index_t old_f = permutation[new_f];
-                for(
-                    index_t old_c=corners_begin(old_f);
-                    old_c<corners_end(old_f); ++old_c) {
-                    facet_corners_permutation.push_back(old_c);
-                }
+                new_facet_ptr[new_f+1] =
+                    new_facet_ptr[new_f] + nb_vertices(permutation[new_f]);
             }
-            
+        }
+        
+        if(facet_corners_.attributes().nb() != 0) {
+            vector<index_t> facet_corners_permutation(
+                is_simplicial_ ? 3*nb() : new_facet_ptr[nb()]
+            );
+            parallel_for_slice(
+                0, nb(),
+                [&](index_t from, index_t to) {
+                    for(index_t new_f=from; new_f<to; ++new_f) {
+                        index_t old_f = permutation[new_f];
+                        index_t new_c = is_simplicial_ ?
+                            3*new_f : new_facet_ptr[new_f];
+                        for(
+                            index_t old_c=corners_begin(old_f);
+                            old_c<corners_end(old_f); ++old_c
+                        ) {
+                            facet_corners_permutation[new_c] = old_c;
+                            ++new_c;
+                        }
+                    }
+                }
+            );
             facet_corners_.attributes().apply_permutation(
                 facet_corners_permutation
             );
@@ -587,73 +692,50 @@ namespace GEO {
         if(is_simplicial_) {
             // If the surface is triangulated,
             // everything can be done in-place (great !!)
-            
-            Permutation::apply(
-                corner_vertex.data(),
-                permutation,
-                index_t(sizeof(index_t) * 3)
-            );
-
-            Permutation::apply(
-                corner_adjacent_facet.data(),
-                permutation,
-                index_t(sizeof(index_t) * 3)
-            );
-
-            Permutation::invert(permutation);
-                
-            for(index_t c = 0; c < corner_adjacent_facet.size(); ++c) {
-                if(corner_adjacent_facet[c] != NO_FACET) {
-                    corner_adjacent_facet[c] =
-                        permutation[corner_adjacent_facet[c]];
-                }
-            }
-            
+            vector<void*> data(2);
+            data[0] = corner_vertex.data();
+            data[1] = corner_adjacent_facet.data();
+            vector<index_t> elemsize(2, index_t(sizeof(index_t) * 3));
+            Permutation::parallel_apply(data, elemsize, permutation);
         } else {
-
-            {
-                vector<index_t> new_corner_vertex;
-                new_corner_vertex.reserve(corner_vertex.size());
-                vector<index_t> new_corner_adjacent_facet;
-                new_corner_adjacent_facet.reserve(corner_adjacent_facet.size());
-                vector<index_t> new_facet_ptr;
-                new_facet_ptr.reserve(nb()+1);
-
-                new_facet_ptr.push_back(0);
-                for(index_t new_f=0; new_f<nb(); ++new_f) {
-                    index_t old_f = permutation[new_f];
-                    for(
-                        index_t old_c = corners_begin(old_f);
-                        old_c < corners_end(old_f); ++old_c
-                    ) {
-                        new_corner_vertex.push_back(
-                            mesh_.facet_corners.vertex(old_c)
-                        );
-                        new_corner_adjacent_facet.push_back(
-                            mesh_.facet_corners.adjacent_facet(old_c)
-                        );
+            vector<index_t> new_corner_vertex(new_facet_ptr[nb()]);
+            vector<index_t> new_corner_adjacent_facet(new_facet_ptr[nb()]);
+            parallel_for_slice(
+                0, nb(),
+                [&](index_t from, index_t to) {
+                    for(index_t new_f=from; new_f<to; ++new_f) {
+                        index_t old_f = permutation[new_f];
+                        index_t new_c = new_facet_ptr[new_f];
+                        for(
+                            index_t old_c = corners_begin(old_f);
+                            old_c < corners_end(old_f); ++old_c
+                        ) {
+                            new_corner_vertex[new_c] = corner_vertex[old_c];
+                            new_corner_adjacent_facet[new_c] =
+                                corner_adjacent_facet[old_c];
+                            ++new_c;
+                        }
                     }
-                    new_facet_ptr.push_back(
-                        new_facet_ptr[new_facet_ptr.size()-1] +
-                        nb_vertices(old_f)
-                    );
                 }
+            );
+            corner_vertex.swap(new_corner_vertex);
+            corner_adjacent_facet.swap(new_corner_adjacent_facet);
+            facet_ptr_.swap(new_facet_ptr);
+        }
 
-                corner_vertex.swap(new_corner_vertex);
-                corner_adjacent_facet.swap(new_corner_adjacent_facet);
-                facet_ptr_.swap(new_facet_ptr);
-            }
-
+        Permutation::invert(permutation);
 
-            Permutation::invert(permutation);
-                
-            for(index_t c = 0; c < corner_adjacent_facet.size(); ++c) {
-                if(corner_adjacent_facet[c] != NO_FACET) {
-                    corner_adjacent_facet[c] =
-                        permutation[corner_adjacent_facet[c]];
+        parallel_for_slice(
+            0, corner_adjacent_facet.size(),
+            [&](index_t from, index_t to) {
+                for(index_t c = from; c < to; ++c) {
+                    if(corner_adjacent_facet[c] != NO_FACET) {
+                        corner_adjacent_facet[c] =
+                            permutation[corner_adjacent_facet[c]];
+                    }
                 }
             }
-        }
+        );
     }
 
     void MeshFacets::connect() {
@@ -683,39 +765,78 @@ namespace GEO {
         
         // compute c2f is needed
         if(!is_simplicial_) {
-            for(index_t f = 0; f < nb(); ++f) {
-                for(index_t c = corners_begin(f); c < corners_end(f); ++c) {
-                    c2f[c] = f;
+            parallel_for_slice(
+                0, nb(),
+                [this, &c2f](index_t from, index_t to) {
+                    for(index_t f = from; f < to; ++f) {
+                        for(
+                            index_t c = corners_begin(f);
+                            c < corners_end(f); ++c
+                        ) {
+                            c2f[c] = f;
+                        }
+                    }
                 }
-            }
+            );
         }
         
-        // Step 2: connect
-        for(index_t f1 = 0; f1 < nb(); ++f1) {
-            for(index_t c1 = corners_begin(f1); c1 < corners_end(f1); ++c1) {
-                if(facet_corners_.adjacent_facet(c1) == NO_FACET) {
-                    index_t v2 = facet_corners_.vertex(
-                        next_corner_around_facet(f1, c1)
-                    );
-                    //   Traverse all the corners c2 incident to v1, and
-                    // find among them the one that is opposite to c1
+        // Step 2: for each border corner c1, find the corner c3 of the
+        // opposite half-edge. It only depends on the chains, not on the
+        // adjacencies created in step 3, thus it is done in parallel.
+        vector<index_t> opposite_corner(facet_corners_.nb(), NO_CORNER);
+        parallel_for_slice(
+            0, nb(),
+            [this, &next_corner_around_vertex, &c2f, &opposite_corner](
+                index_t from, index_t to
+            ) {
+                for(index_t f1 = from; f1 < to; ++f1) {
                     for(
-                        index_t c2 = next_corner_around_vertex[c1];
-                        c2 != NO_CORNER; c2 = next_corner_around_vertex[c2]
+                        index_t c1 = corners_begin(f1);
+                        c1 < corners_end(f1); ++c1
                     ) {
-                        if(c2 != c1) {
-                            index_t f2 = is_simplicial_ ? c2/3 : c2f[c2];
-                            index_t c3 = prev_corner_around_facet(f2, c2);
-                            index_t v3 = facet_corners_.vertex(c3);
-                            if(v3 == v2) {
-                                facet_corners_.set_adjacent_facet(c1, f2);
-                                facet_corners_.set_adjacent_facet(c3, f1);
-                                break; 
+                        if(facet_corners_.adjacent_facet(c1) != NO_FACET) {
+                            continue;
+                        }
+                        index_t v2 = facet_corners_.vertex(
+                            next_corner_around_facet(f1, c1)
+                        );
+                        //   Traverse all the corners c2 incident to v1,
+                        // and find among them the one that is opposite
+                        // to c1
+                        for(
+                            index_t c2 = next_corner_around_vertex[c1];
+                            c2 != NO_CORNER;
+                            c2 = next_corner_around_vertex[c2]
+                        ) {
+                            if(c2 != c1) {
+                                index_t f2 = is_simplicial_ ? c2/3 : c2f[c2];
+                                index_t c3 = prev_corner_around_facet(f2, c2);
+                                index_t v3 = facet_corners_.vertex(c3);
+                                if(v3 == v2) {
+                                    opposite_corner[c1] = c3;
+                                    break; 
+                                }
                             }
                         }
                     }
                 }
             }
+        );
+        
+        // Step 3: connect, in the same order as a sequential traversal,
+        // so that non-manifold edges are connected the same way.
+        for(index_t f1 = 0; f1 < nb(); ++f1) {
+            for(index_t c1 = corners_begin(f1); c1 < corners_end(f1); ++c1) {
+                index_t c3 = opposite_corner[c1];
+                if(
+                    c3 != NO_CORNER &&
+                    facet_corners_.adjacent_facet(c1) == NO_FACET
+                ) {
+                    index_t f2 = is_simplicial_ ? c3/3 : c2f[c3];
+                    facet_corners_.set_adjacent_facet(c1, f2);
+                    facet_corners_.set_adjacent_facet(c3, f1);
+                }
+            }
         }
     }
 
@@ -824,6 +945,7 @@ namespace GEO {
             is_simplicial_ ? 3*(nb()-1) : facet_ptr_[nb()-1];
         resize_store(nb()-1);
         facet_corners_.resize_store(new_nb_corners);
+        truncate_marked_elements(nb());
     }
 
     
@@ -1032,6 +1154,7 @@ namespace GEO {
     }
 
     void MeshCells::clear(bool keep_attributes, bool keep_memory) {
+        clear_marked_elements();
         cell_corners_.clear_store(keep_attributes, keep_memory);
         cell_facets_.clear_store(keep_attributes, keep_memory);        
         clear_store(keep_attributes, keep_memory);
@@ -1062,15 +1185,11 @@ namespace GEO {
         index_t new_nb_cells = 0;
         index_t new_nb_corner_facets = 0;
 
-        // If there are some corners or facets
-        // attributes, we need to compute the index
-        // mapping for them.
-        vector<index_t> corner_facets_old2new;
-        if(
-            cell_corners_.attributes().nb() != 0 ||
-            cell_facets_.attributes().nb() != 0) {
-            corner_facets_old2new.resize(cell_corners_.nb(), index_t(-1));
-        }
+        // Index mapping for the corners and facets, used to compress
+        // the corners and facets arrays and their attributes.
+        vector<index_t> corner_facets_old2new(
+            cell_corners_.nb(), index_t(-1)
+        );
 
         for(index_t c=0; c<nb(); ++c) {
             if(cells_old2new[c] != 0) {
@@ -1093,15 +1212,7 @@ namespace GEO {
                 }
 
                 for(index_t cof=b; cof<e; ++cof) {
-                    if(corner_facets_old2new.size() != 0) {
-                        corner_facets_old2new[cof] = new_nb_corner_facets;
-                    }
-                    if(cof != new_nb_corner_facets) {
-                        corner_vertex[new_nb_corner_facets] =
-                            corner_vertex[cof];
-                        adjacent_cell[new_nb_corner_facets] =
-                            adjacent_cell[cof];
-                    }
+                    corner_facets_old2new[cof] = new_nb_corner_facets;
                     ++new_nb_corner_facets;
                 }
                 ++new_nb_cells;
@@ -1112,23 +1223,39 @@ namespace GEO {
             cell_ptr_[new_nb_cells] = new_nb_corner_facets;
         }
 
+        {
+            vector<void*> data;
+            data.push_back(corner_vertex.data());
+            data.push_back(adjacent_cell.data());
+            vector<index_t> elemsize(2, index_t(sizeof(index_t)));
+            Permutation::parallel_compress(
+                data, elemsize, corner_facets_old2new
+            );
+        }
+
         // Map adjacent cell indices
-        for(index_t f=0; f<cell_facets_.nb(); ++f) {
-            index_t c = adjacent_cell[f];
-            if(c != NO_CELL) {
-                adjacent_cell[f] = cells_old2new[c];
+        parallel_for_slice(
+            0, new_nb_corner_facets,
+            [&](index_t from, index_t to) {
+                for(index_t f = from; f < to; ++f) {
+                    index_t c = adjacent_cell[f];
+                    if(c != NO_CELL) {
+                        adjacent_cell[f] = cells_old2new[c];
+                    }
+                }
             }
-        }
+        );
         
         // Manage cell store and attributes
         attributes().compress(cells_old2new);
+        compress_marked_elements(cells_old2new);
         resize_store(new_nb_cells);
         
         // Manage corners/facets store and attributes
-        if(corner_facets_old2new.size() != 0) {
-            // Corner/facet index mapping is only computed
-            // if there ware some corner or facet attributes
+        if(cell_corners_.attributes().nb() != 0) {
             cell_corners_.attributes().compress(corner_facets_old2new);
+        }
+        if(cell_facets_.attributes().nb() != 0) {
             cell_facets_.attributes().compress(corner_facets_old2new);
         }
         cell_corners_.resize_store(new_nb_corner_facets);
@@ -1138,27 +1265,57 @@ namespace GEO {
             mesh_.vertices.remove_isolated();
         }
     }
-        
+
+    void MeshCells::delete_marked_elements(bool remove_isolated_vertices) {
+        vector<index_t> to_delete;
+        get_marked_elements(to_delete, nb());
+        delete_elements(to_delete, remove_isolated_vertices);
+    }
+
     void MeshCells::permute_elements(vector<index_t>& permutation) {
         attributes_.apply_permutation(permutation);
+        permute_marked_elements(permutation);
+        touch();
+
+        vector<index_t>& corner_vertex = cell_corners_.corner_vertex_;
+        vector<index_t>& facet_adjacent_cell = cell_facets_.adjacent_cell_;
+
+        // Corners and facets of the new cell c start at new_cell_ptr[c]
+        vector<index_t> new_cell_ptr;
+        if(!is_simplicial_) {
+            new_cell_ptr.resize(nb()+1);
+            new_cell_ptr[0] = 0;
+            for(index_t new_c=0; new_c<nb(); ++new_c) {
+                index_t old_c = permutation[new_c];
+                new_cell_ptr[new_c+1] = new_cell_ptr[new_c] +
+                    std::max(nb_vertices(old_c), nb_facets(old_c));
+            }
+        }
 
         if(
             cell_corners_.attributes().nb() != 0 ||
             cell_facets_.attributes().nb() != 0
         ) {
-            vector<index_t> cell_corner_facets_permutation;
-            cell_corner_facets_permutation.reserve(cell_corners_.nb());
-
-            for(index_t new_cell = 0; new_cell<nb(); ++new_cell) {
-                index_t old_cell = permutation[new_cell];
-                index_t cell_size =
-                    std::max(nb_vertices(old_cell), nb_facets(old_cell));
-                for(index_t i=0; i<cell_size; ++i) {
-		    cell_corner_facets_permutation.push_back(
-			corners_begin(old_cell)+i
-		    );
+            vector<index_t> cell_corner_facets_permutation(
+                is_simplicial_ ? 4*nb() : new_cell_ptr[nb()]
+            );
+            parallel_for_slice(
+                0, nb(),
+                [&](index_t from, index_t to) {
+                    for(index_t new_cell = from; new_cell<to; ++new_cell) {
+                        index_t old_cell = permutation[new_cell];
+                        index_t new_ptr = is_simplicial_ ?
+                            4*new_cell : new_cell_ptr[new_cell];
+                        index_t cell_size = std::max(
+                            nb_vertices(old_cell), nb_facets(old_cell)
+                        );
+                        for(index_t i=0; i<cell_size; ++i) {
+                            cell_corner_facets_permutation[new_ptr+i] =
+                                corners_begin(old_cell)+i;
+                        }
+                    }
                 }
-            }
+            );
             
             if(cell_corners_.attributes().nb() != 0) {
                 cell_corners_.attributes().apply_permutation(
@@ -1172,73 +1329,59 @@ namespace GEO {
             }
         }
 
-        vector<index_t>& corner_vertex = cell_corners_.corner_vertex_;
-        vector<index_t>& facet_adjacent_cell = cell_facets_.adjacent_cell_;
-        
         if(is_simplicial_) {
             // in-place permutation !
-            
-            Permutation::apply(
-                corner_vertex.data(),
-                permutation,
-                index_t(sizeof(index_t) * 4)
-            );
-
-            Permutation::apply(
-                facet_adjacent_cell.data(),
-                permutation,
-                index_t(sizeof(index_t) * 4)
-            );
-
-            Permutation::invert(permutation);
-
-            for(index_t f = 0; f < facet_adjacent_cell.size(); ++f) {
-                if(facet_adjacent_cell[f] != NO_CELL) {
-                    facet_adjacent_cell[f] =
-                        permutation[facet_adjacent_cell[f]];
-                }
-            }
+            vector<void*> data(2);
+            data[0] = corner_vertex.data();
+            data[1] = facet_adjacent_cell.data();
+            vector<index_t> elemsize(2, index_t(sizeof(index_t) * 4));
+            Permutation::parallel_apply(data, elemsize, permutation);
         } else {
             // we need to do some copies
-            
-            vector<index_t> new_cell_ptr(nb()+1);
             vector<index_t> new_corner_vertex(cell_corners_.nb());
             vector<index_t> new_facet_adjacent_cell(cell_facets_.nb());
-            
-            index_t new_ptr = 0;
-            for(index_t new_c=0; new_c<nb(); ++new_c) {
-                index_t old_c = permutation[new_c];
-                index_t old_ptr = cell_ptr_[old_c];
-                index_t cell_size = std::max(
-                    nb_vertices(old_c), nb_facets(old_c)
-                );
-                new_cell_ptr[new_c] = new_ptr;
-                for(index_t i=0; i<cell_size; ++i) {
-                    new_corner_vertex[new_ptr+i] = corner_vertex[old_ptr+i];
-                    new_facet_adjacent_cell[new_ptr+i] =
-                        facet_adjacent_cell[old_ptr+i];
+            parallel_for_slice(
+                0, nb(),
+                [&](index_t from, index_t to) {
+                    for(index_t new_c=from; new_c<to; ++new_c) {
+                        index_t old_c = permutation[new_c];
+                        index_t old_ptr = cell_ptr_[old_c];
+                        index_t new_ptr = new_cell_ptr[new_c];
+                        index_t cell_size = std::max(
+                            nb_vertices(old_c), nb_facets(old_c)
+                        );
+                        for(index_t i=0; i<cell_size; ++i) {
+                            new_corner_vertex[new_ptr+i] =
+                                corner_vertex[old_ptr+i];
+                            new_facet_adjacent_cell[new_ptr+i] =
+                                facet_adjacent_cell[old_ptr+i];
+                        }
+                    }
                 }
-                new_ptr += cell_size;
-            }
-            new_cell_ptr[nb()] = new_ptr;
+            );
 
             Permutation::apply(
                 cell_type_.data(), permutation, index_t(sizeof(Numeric::uint8))
             );
 
-            Permutation::invert(permutation);
-
-            for(index_t f = 0; f < new_facet_adjacent_cell.size(); ++f) {
-                if(new_facet_adjacent_cell[f] != NO_CELL) {
-                    new_facet_adjacent_cell[f] =
-                        permutation[new_facet_adjacent_cell[f]];
-                }
-            }
-
             corner_vertex.swap(new_corner_vertex);
             facet_adjacent_cell.swap(new_facet_adjacent_cell);
             cell_ptr_.swap(new_cell_ptr);
         }
+
+        Permutation::invert(permutation);
+
+        parallel_for_slice(
+            0, facet_adjacent_cell.size(),
+            [&](index_t from, index_t to) {
+                for(index_t f = from; f < to; ++f) {
+                    if(facet_adjacent_cell[f] != NO_CELL) {
+                        facet_adjacent_cell[f] =
+                            permutation[facet_adjacent_cell[f]];
+                    }
+                }
+            }
+        );
     }
 
     
@@ -1267,10 +1410,59 @@ namespace GEO {
             }
         }
         
-        // Step 2: connect tets
+        // Step 2: for each tet facet (t1,lf1), find the first matching 
+        // facet around its first vertex. The tets around a vertex are
+        // chained by decreasing index, thus when the first match (t2,lf2)
+        // has t2 >= t1, it is found by only traversing the tets t2 >= t1.
+        // It does not depend on the adjacencies created in step 3, 
+        // thus it is done in parallel. It traverses about twice as many
+        // tets as the sequential algorithm (that skips the facets already
+        // connected), thus it is only used with multiple threads (else
+        // opposite_facet stays empty).
+        GEO::vector<index_t> opposite_facet;
+        if(Process::maximum_concurrent_threads() > 1) {
+            opposite_facet.assign(nb() * 4, NO_FACET);
+            parallel_for_slice(
+                0, nb(),
+                [this, &next_tet_corner_around_vertex, &v2c, &opposite_facet](
+                    index_t from, index_t to
+                ) {
+                    for(index_t t1 = from; t1 < to; ++t1) {
+                        for(index_t lf1 = 0; lf1 < 4; ++lf1) {
+                            index_t v1 = facet_vertex(t1, lf1, 0);
+                            index_t v2 = facet_vertex(t1, lf1, 1);
+                            index_t v3 = facet_vertex(t1, lf1, 2);
+                            for(
+                                index_t c2 = v2c[v1];
+                                c2 != NO_CORNER && c2/4 >= t1;
+                                c2 = next_tet_corner_around_vertex[c2]
+                            ) {
+                                index_t t2 = c2/4;
+                                index_t lf2 = find_tet_facet(t2, v3, v2, v1);
+                                if(lf2 != NO_FACET) {
+                                    opposite_facet[4*t1+lf1] = 4*t2+lf2;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+            );
+        }
+        
+        // Step 3: connect tets, in the same order as a sequential
+        // traversal, so that non-manifold facets are connected the
+        // same way. The facets that are still on the border and that
+        // were not matched in step 2 traverse all the tets around
+        // their first vertex.
         for(index_t t1 = 0; t1 < nb(); ++t1) {
             for(index_t lf1 = 0; lf1 < 4; ++lf1) {
-                if(adjacent(t1, lf1) == NO_CELL) {
+                if(adjacent(t1, lf1) != NO_CELL) {
+                    continue;
+                }
+                index_t f2 = opposite_facet.empty() ?
+                    NO_FACET : opposite_facet[4 * t1 + lf1];
+                if(f2 == NO_FACET) {
                     index_t v1 = facet_vertex(t1, lf1, 0);
                     index_t v2 = facet_vertex(t1, lf1, 1);
                     index_t v3 = facet_vertex(t1, lf1, 2);
@@ -1281,12 +1473,15 @@ namespace GEO {
                         index_t t2 = c2/4;
                         index_t lf2 = find_tet_facet(t2, v3, v2, v1);
                         if(lf2 != NO_FACET) {
-                            set_adjacent(t1, lf1, t2);
-                            set_adjacent(t2, lf2, t1);
+                            f2 = 4 * t2 + lf2;
                             break;
                         }
                     }
                 }
+                if(f2 != NO_FACET) {
+                    set_adjacent(t1, lf1, f2/4);
+                    set_adjacent(f2/4, f2%4, t1);
+                }
             }
         }
     }
@@ -1796,6 +1991,7 @@ namespace GEO {
         cell_corners_.resize_store(corners_facets_new_size);
         cell_facets_.resize_store(corners_facets_new_size);
         resize_store(nb()-1);
+        truncate_marked_elements(nb());
     }
     
     /**************************************************************************/
@@ -1807,12 +2003,33 @@ namespace GEO {
           facet_corners(*this),
           cells(*this),
           cell_corners(*this),
-          cell_facets(*this)
+          cell_facets(*this),
+          vertex_incidence_(nullptr)
     {
         vertices.bind_point_attribute(dimension, single_precision);
     }
 
     Mesh::~Mesh() {
+        delete vertex_incidence_;
+        vertex_incidence_ = nullptr;
+    }
+
+    const MeshVertexIncidence& Mesh::vertex_incidence(
+        MeshElementsFlags what
+    ) const {
+        if(vertex_incidence_ == nullptr) {
+            vertex_incidence_ = new MeshVertexIncidence(*this);
+        }
+        if(!vertex_incidence_->is_up_to_date(what)) {
+            vertex_incidence_->update(what);
+        }
+        return *vertex_incidence_;
+    }
+
+    void Mesh::clear_vertex_incidence() const {
+        if(vertex_incidence_ != nullptr) {
+            vertex_incidence_->clear();
+        }
     }
     
     void Mesh::clear(bool keep_attributes, bool keep_memory) {
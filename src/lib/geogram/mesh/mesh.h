@@ -51,6 +51,8 @@
 #include <geogram/basic/attributes.h>
 #include <geogram/basic/geometry.h>
 
+#include <atomic>
+
 /**
  * \file geogram/mesh/mesh.h
  * \brief The class that represents a mesh.
@@ -59,6 +61,7 @@
 namespace GEO {
 
     class Mesh;
+    class MeshVertexIncidence;
 
     const index_t NO_VERTEX = index_t(-1);
     const index_t NO_EDGE = index_t(-1);
@@ -107,6 +110,23 @@ namespace GEO {
             return const_cast<AttributesManager&>(attributes_);
         }
 
+        /**
+         * \brief Gets the timestamp.
+         * \details The timestamp is incremented each time (sub-)elements
+         *  are created, deleted or permuted, and each time the vertex of
+         *  an element is changed in-place (set_vertex()). It is used to
+         *  detect whether data derived from the mesh (for instance
+         *  MeshVertexIncidence) needs to be recomputed.
+         * \return the current value of the timestamp
+         */
+        Numeric::uint64 timestamp() const {
+            if(vertices_modified_.load(std::memory_order_relaxed)) {
+                vertices_modified_.store(false, std::memory_order_relaxed);
+                ++timestamp_;
+            }
+            return timestamp_;
+        }
+
         /**
 	 * \brief Used by range-based for.
 	 * \return The index of the first position.
@@ -124,6 +144,27 @@ namespace GEO {
 	}
     
     protected:
+
+        /**
+         * \brief Indicates that the (sub-)elements were modified.
+         * \details Increments the timestamp.
+         */
+        void touch() {
+            ++timestamp_;
+        }
+
+        /**
+         * \brief Indicates that the vertex of a (sub-)element was changed
+         *  in-place.
+         * \details The timestamp is incremented by the next call to
+         *  timestamp(). This function can be called concurrently, it does
+         *  not write to memory if the flag is already set.
+         */
+        void touch_vertices() {
+            if(!vertices_modified_.load(std::memory_order_relaxed)) {
+                vertices_modified_.store(true, std::memory_order_relaxed);
+            }
+        }
         
         /**
          * \brief Removes all the elements and attributes.
@@ -153,10 +194,12 @@ namespace GEO {
          */
         index_t create_sub_elements(index_t nb) {
             index_t result = nb_;
-            if(nb_ + nb > attributes_.size()) {
+            if(nb_ + nb > attributes_.capacity()) {
                 index_t new_capacity=nb_ + nb;
                 if(nb < 128) {
-                    new_capacity = std::max(index_t(16),attributes_.size());
+                    new_capacity = std::max(
+                        index_t(16),attributes_.capacity()
+                    );
                     while(new_capacity < nb_ + nb) {
                         new_capacity *= 2;
                     }
@@ -165,6 +208,7 @@ namespace GEO {
             }
             nb_ += nb;
 	    attributes_.resize(nb_);
+            touch();
             return result;
         }
 
@@ -181,6 +225,7 @@ namespace GEO {
 		attributes_.reserve(new_capacity);
             }
 	    attributes_.resize(nb_);
+            touch();
             return result;
         }
 
@@ -217,12 +262,15 @@ namespace GEO {
                 attributes_.clear(false,false);
                 attributes_.resize(rhs.attributes_.size());
             }
+            touch();
         }
         
     protected:
         Mesh& mesh_;
         AttributesManager attributes_;
         index_t nb_;
+        mutable Numeric::uint64 timestamp_;
+        mutable std::atomic<bool> vertices_modified_;
     };
 
 
@@ -254,6 +302,50 @@ namespace GEO {
             bool remove_isolated_vertices=true
         ) = 0;
 
+        /**
+         * \brief Marks an element for deferred deletion.
+         * \details Marked elements are deleted all at once by
+         *  delete_marked_elements(), with a single compaction of the
+         *  elements and their attributes. Elements can be created,
+         *  deleted or permuted while some elements are marked, the
+         *  marks follow the elements.
+         * \param[in] e the element to be deleted
+         */
+        void mark_for_deletion(index_t e) {
+            if(e >= marked_.size()) {
+                marked_.resize(e+1, 0);
+            }
+            marked_[e] = 1;
+        }
+
+        /**
+         * \brief Marks a set of elements for deferred deletion.
+         * \see mark_for_deletion(index_t)
+         * \param[in] to_delete a vector with the same format as in
+         *  delete_elements(). If to_delete[e] is different from 0, then
+         *  element e will be destroyed by delete_marked_elements().
+         */
+        void mark_for_deletion(const vector<index_t>& to_delete);
+
+        /**
+         * \brief Tests whether some elements are marked for deletion.
+         * \retval true if mark_for_deletion() was called since the
+         *  last call to delete_marked_elements()
+         * \retval false otherwise
+         */
+        bool has_marked_elements() const {
+            return marked_.size() != 0;
+        }
+
+        /**
+         * \brief Deletes all the elements marked by mark_for_deletion().
+         * \param[in] remove_isolated_vertices if true, then the vertices
+         *  that are no longer incident to any element are deleted.
+         */
+        virtual void delete_marked_elements(
+            bool remove_isolated_vertices=true
+        ) = 0;
+
         /**
          * \brief Applies a permutation to the elements and their attributes.
          * \details On exit, permutation is modified (used for internal
@@ -302,6 +394,59 @@ namespace GEO {
             }
             return false;
         }
+
+        /**
+         * \brief Gets the elements marked for deletion and unmarks them.
+         * \details This function is used internally by
+         *  delete_marked_elements()
+         * \param[out] to_delete a vector of size \p nb, in the format
+         *  expected by delete_elements()
+         * \param[in] nb the number of elements
+         */
+        void get_marked_elements(vector<index_t>& to_delete, index_t nb);
+
+        /**
+         * \brief Applies a permutation to the marks of the elements.
+         * \details This function is used internally by permute_elements()
+         * \param[in] permutation the permutation applied to the elements,
+         *  in the format expected by permute_elements()
+         */
+        void permute_marked_elements(const vector<index_t>& permutation);
+
+        /**
+         * \brief Removes the marks of deleted elements and renumbers
+         *  the other ones.
+         * \details This function is used internally by delete_elements()
+         * \param[in] old2new the new index of each element, or
+         *  index_t(-1) if the element is deleted
+         */
+        void compress_marked_elements(const vector<index_t>& old2new);
+
+        /**
+         * \brief Unmarks all the elements.
+         * \details This function is used internally by clear()
+         */
+        void clear_marked_elements() {
+            marked_.clear();
+        }
+
+        /**
+         * \brief Removes the marks of the elements that no longer exist.
+         * \details This function is used internally by pop()
+         * \param[in] nb the number of elements
+         */
+        void truncate_marked_elements(index_t nb) {
+            if(marked_.size() > nb) {
+                marked_.resize(nb);
+            }
+        }
+
+        /**
+         * \brief One byte per element, non-zero if the element is marked
+         *  for deletion. It is empty when no element is marked, else its
+         *  size is the index of the last marked element plus one.
+         */
+        vector<Numeric::uint8> marked_;
     };
 
     /**************************************************************************/
@@ -330,6 +475,10 @@ namespace GEO {
             vector<index_t>& to_delete, bool remove_isolated_vertices=true
         );
         
+        virtual void delete_marked_elements(
+            bool remove_isolated_vertices=true
+        );
+
         virtual void permute_elements(vector<index_t>& permutation);
 
         /**
@@ -521,6 +670,20 @@ namespace GEO {
             return &point_fp32_[v*point_fp32_.dimension()];
         }
 
+        /**
+         * \brief Gets a point in its storage precision.
+         * \details Lets algorithms templated on the coordinate type
+         *  read the points without converting the whole mesh.
+         *  See also Geom::mesh_vertex_promoted().
+         * \tparam T one of double (for double-precision mode) or
+         *  float (for single-precision mode)
+         * \param[in] v the index of the vertex
+         * \return a const pointer to the coordinates of the point
+         *  that corresponds to the vertex
+         * \pre T is float if single_precision(), double otherwise
+         */
+        template <class T> const T* typed_point_ptr(index_t v) const;
+
         /**
          * \brief Assigns all the points.
          * \param[in] points a vector that contains all the coordinates
@@ -557,6 +720,14 @@ namespace GEO {
 
         void bind_point_attribute(index_t dim, bool single_precision=false);
 
+        /**
+         * \brief Updates the vertex indices in the edges, facets
+         *  and cells, in parallel.
+         * \details Used by delete_elements() and permute_elements().
+         * \param[in] old2new the new index of each vertex
+         */
+        void update_vertex_indices(const vector<index_t>& old2new);
+
         void copy(const MeshVertices& rhs, bool copy_attributes=true) {
             index_t dim = rhs.dimension();
             if(point_fp32_.is_bound()) {
@@ -609,6 +780,26 @@ namespace GEO {
         friend class Mesh;
         friend class GeogramIOHandler;
     };
+
+    /**
+     * \brief Gets a double-precision point.
+     * \see MeshVertices::typed_point_ptr()
+     */
+    template<> inline const double* MeshVertices::typed_point_ptr<double>(
+        index_t v
+    ) const {
+        return point_ptr(v);
+    }
+
+    /**
+     * \brief Gets a single-precision point.
+     * \see MeshVertices::typed_point_ptr()
+     */
+    template<> inline const float* MeshVertices::typed_point_ptr<float>(
+        index_t v
+    ) const {
+        return single_precision_point_ptr(v);
+    }
     
     /*************************************************************************/
 
@@ -644,6 +835,7 @@ namespace GEO {
             geo_debug_assert(e < nb());
             geo_debug_assert(lv < 2);
             edge_vertex_[2*e+lv] = v;
+            touch_vertices();
         }
 
 
@@ -655,6 +847,7 @@ namespace GEO {
          */
         index_t* vertex_index_ptr(index_t c) {
             geo_debug_assert(c < 2*nb());
+            touch_vertices();
             return &(edge_vertex_[c]);
         }
 
@@ -702,6 +895,10 @@ namespace GEO {
             vector<index_t>& to_delete, bool remove_isolated_vertices=true
         );
         
+        virtual void delete_marked_elements(
+            bool remove_isolated_vertices=true
+        );
+
         virtual void permute_elements(vector<index_t>& permutation);
 
         virtual void clear(
@@ -918,6 +1115,7 @@ namespace GEO {
             geo_debug_assert(c < nb());
             geo_debug_assert(v < vertices_.nb());
             corner_vertex_[c] = v;
+            touch_vertices();
         }
 
         /**
@@ -933,6 +1131,7 @@ namespace GEO {
         void set_vertex_no_check(index_t c, index_t v) {
             geo_debug_assert(c < nb());
             corner_vertex_[c] = v;
+            touch_vertices();
         }
 
         /**
@@ -956,6 +1155,7 @@ namespace GEO {
          */
         index_t* vertex_index_ptr(index_t c) {
             geo_debug_assert(c < nb());
+            touch_vertices();
             return &(corner_vertex_[c]);
         }
 
@@ -1144,6 +1344,10 @@ namespace GEO {
             bool remove_isolated_vertices=true
         );
         
+        virtual void delete_marked_elements(
+            bool remove_isolated_vertices=true
+        );
+
         virtual void permute_elements(vector<index_t>& permutation);
 
         virtual void clear(
@@ -1705,6 +1909,7 @@ namespace GEO {
             geo_debug_assert(c < nb());
             geo_debug_assert(v < vertices_.nb());
             corner_vertex_[c] = v;
+            touch_vertices();
         }
 
         /**
@@ -1716,6 +1921,7 @@ namespace GEO {
          */
         index_t* vertex_index_ptr(index_t c) {
             geo_debug_assert(c < nb());
+            touch_vertices();
             return &(corner_vertex_[c]);
         }
 
@@ -2019,6 +2225,10 @@ namespace GEO {
             bool remove_isolated_vertices=true
         );
         
+        virtual void delete_marked_elements(
+            bool remove_isolated_vertices=true
+        );
+
         virtual void permute_elements(vector<index_t>& permutation);
 
         /**
@@ -2785,7 +2995,32 @@ namespace GEO {
             const std::string& name
         );
 
-        
+        /**
+         * \brief Gets the vertex incidence cache of this mesh.
+         * \details The cache is created on first use, and updated
+         *  if the mesh was modified since the last call (creation,
+         *  deletion or permutation of elements, or in-place changes
+         *  through set_vertex()). Modifications are detected through
+         *  the timestamps of the element stores.
+         *  This function is not thread-safe: it should be called
+         *  before entering parallel sections that use the cache.
+         * \param[in] what a combination of MESH_EDGES, MESH_FACETS and
+         *  MESH_CELLS, specifies the incidence tables to be computed
+         * \return a const reference to the vertex incidence cache
+         */
+        const MeshVertexIncidence& vertex_incidence(
+            MeshElementsFlags what = MESH_FACETS
+        ) const;
+
+        /**
+         * \brief Discards the vertex incidence cache.
+         * \details Releases the memory used by the cache, for instance
+         *  once an algorithm that used it is finished. Modifications of
+         *  the mesh are detected automatically, there is no need to call
+         *  this function to invalidate the cache.
+         */
+        void clear_vertex_incidence() const;
+
     protected:
         /**
          * \brief Displays the list of attributes to the Logger.
@@ -2817,6 +3052,8 @@ namespace GEO {
          *   Use copy() instead.
          */
         const Mesh& operator=(const Mesh& rhs);
+
+        mutable MeshVertexIncidence* vertex_incidence_;
     };
 
     /*************************************************************************/
@@ -64,24 +64,25 @@ namespace {
 
     /**
      * \brief Computes the axis-aligned bounding box of a mesh facet.
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] M the mesh
      * \param[out] B the bounding box of the facet
      * \param[in] f the index of the facet in mesh \p M
      */
-    void get_facet_bbox(
+    template <class T> void get_facet_bbox(
         const Mesh& M, Box& B, index_t f
     ) {
         index_t c = M.facets.corners_begin(f);
-        const double* p = M.vertices.point_ptr(M.facet_corners.vertex(c));
+        const T* p = M.vertices.typed_point_ptr<T>(M.facet_corners.vertex(c));
         for(coord_index_t coord = 0; coord < 3; ++coord) {
-            B.xyz_min[coord] = p[coord];
-            B.xyz_max[coord] = p[coord];
+            B.xyz_min[coord] = double(p[coord]);
+            B.xyz_max[coord] = double(p[coord]);
         }
         for(++c; c < M.facets.corners_end(f); ++c) {
-            p = M.vertices.point_ptr(M.facet_corners.vertex(c));
+            p = M.vertices.typed_point_ptr<T>(M.facet_corners.vertex(c));
             for(coord_index_t coord = 0; coord < 3; ++coord) {
-                B.xyz_min[coord] = std::min(B.xyz_min[coord], p[coord]);
-                B.xyz_max[coord] = std::max(B.xyz_max[coord], p[coord]);
+                B.xyz_min[coord] = std::min(B.xyz_min[coord], double(p[coord]));
+                B.xyz_max[coord] = std::max(B.xyz_max[coord], double(p[coord]));
             }
         }
     }
@@ -89,46 +90,48 @@ namespace {
 
     /**
      * \brief Computes the axis-aligned bounding box of a mesh tetrahedron.
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] M the mesh
      * \param[out] B the bounding box of the facet
      * \param[in] t the index of the tetrahedron in mesh \p M
      */
-    void get_tet_bbox(
+    template <class T> void get_tet_bbox(
         const Mesh& M, Box& B, index_t t
     ) {
-        const double* p = M.vertices.point_ptr(M.cells.vertex(t,0));
+        const T* p = M.vertices.typed_point_ptr<T>(M.cells.vertex(t,0));
         for(coord_index_t coord = 0; coord < 3; ++coord) {
-            B.xyz_min[coord] = p[coord];
-            B.xyz_max[coord] = p[coord];
+            B.xyz_min[coord] = double(p[coord]);
+            B.xyz_max[coord] = double(p[coord]);
         }
         for(index_t lv=1; lv<4; ++lv) {
-            p = M.vertices.point_ptr(M.cells.vertex(t,lv));
+            p = M.vertices.typed_point_ptr<T>(M.cells.vertex(t,lv));
             for(coord_index_t coord = 0; coord < 3; ++coord) {
-                B.xyz_min[coord] = std::min(B.xyz_min[coord], p[coord]);
-                B.xyz_max[coord] = std::max(B.xyz_max[coord], p[coord]);
+                B.xyz_min[coord] = std::min(B.xyz_min[coord], double(p[coord]));
+                B.xyz_max[coord] = std::max(B.xyz_max[coord], double(p[coord]));
             }
         }
     }
 
     /**
      * \brief Computes the axis-aligned bounding box of a mesh cell
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] M the mesh
      * \param[out] B the bounding box of the facet
      * \param[in] c the index of the cell in mesh \p M
      */
-    void get_cell_bbox(
+    template <class T> void get_cell_bbox(
         const Mesh& M, Box& B, index_t c
     ) {
-        const double* p = M.vertices.point_ptr(M.cells.vertex(c,0));
+        const T* p = M.vertices.typed_point_ptr<T>(M.cells.vertex(c,0));
         for(coord_index_t coord = 0; coord < 3; ++coord) {
-            B.xyz_min[coord] = p[coord];
-            B.xyz_max[coord] = p[coord];
+            B.xyz_min[coord] = double(p[coord]);
+            B.xyz_max[coord] = double(p[coord]);
         }
         for(index_t lv=1; lv<M.cells.nb_vertices(c); ++lv) {
-            p = M.vertices.point_ptr(M.cells.vertex(c,lv));
+            p = M.vertices.typed_point_ptr<T>(M.cells.vertex(c,lv));
             for(coord_index_t coord = 0; coord < 3; ++coord) {
-                B.xyz_min[coord] = std::min(B.xyz_min[coord], p[coord]);
-                B.xyz_max[coord] = std::max(B.xyz_max[coord], p[coord]);
+                B.xyz_min[coord] = std::min(B.xyz_min[coord], double(p[coord]));
+                B.xyz_max[coord] = std::max(B.xyz_max[coord], double(p[coord]));
             }
         }
     }
@@ -197,6 +200,7 @@ namespace {
 
     /**
      * \brief Finds the nearest point in a mesh facet from a query point.
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] M the mesh
      * \param[in] p the query point
      * \param[in] f index of the facet in \p M
@@ -204,7 +208,7 @@ namespace {
      * \param[out] squared_dist the squared distance between
      *  \p p and \p nearest_p
      */
-    void get_point_facet_nearest_point(
+    template <class T> void get_point_facet_nearest_point(
         const Mesh& M,
         const vec3& p,
         index_t f,
@@ -213,9 +217,15 @@ namespace {
     ) {
         if(M.facets.nb_vertices(f) == 3) {
 	    index_t c = M.facets.corners_begin(f);
-	    const vec3& p1 = Geom::mesh_vertex(M, M.facet_corners.vertex(c));
-	    const vec3& p2 = Geom::mesh_vertex(M, M.facet_corners.vertex(c+1));
-	    const vec3& p3 = Geom::mesh_vertex(M, M.facet_corners.vertex(c+2));
+	    vec3 p1 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c)
+	    );
+	    vec3 p2 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c+1)
+	    );
+	    vec3 p3 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c+2)
+	    );
 	    double lambda1, lambda2, lambda3;  // barycentric coords, not used.
 	    squared_dist = Geom::point_triangle_squared_distance(
 		p, p1, p2, p3, nearest_p, lambda1, lambda2, lambda3
@@ -223,11 +233,17 @@ namespace {
 	} else {
 	    squared_dist = Numeric::max_float64();
 	    index_t c1 = M.facets.corners_begin(f);
-	    const vec3& p1 = Geom::mesh_vertex(M, M.facet_corners.vertex(c1));
+	    vec3 p1 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c1)
+	    );
 	    for(index_t c2 = c1+1; c2+1<M.facets.corners_end(f); ++c2) {
-		const vec3& p2 = Geom::mesh_vertex(M, M.facet_corners.vertex(c2));
+		vec3 p2 = Geom::mesh_vertex_promoted<T>(
+		    M, M.facet_corners.vertex(c2)
+		);
 		index_t c3 = c2+1;
-		const vec3& p3 = Geom::mesh_vertex(M, M.facet_corners.vertex(c3));
+		vec3 p3 = Geom::mesh_vertex_promoted<T>(
+		    M, M.facet_corners.vertex(c3)
+		);
 		double lambda1, lambda2, lambda3;  // barycentric coords, not used.
 		vec3 cur_nearest_p;
 		double cur_squared_dist = Geom::point_triangle_squared_distance(
@@ -310,6 +326,7 @@ namespace {
 
     /**
      * \brief Tests whether a mesh tetrahedron contains a given point
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] M a const reference to the mesh
      * \param[in] t the index of the tetrahedron in \p M
      * \param[in] p a const reference to the point
@@ -317,13 +334,13 @@ namespace {
      *  the point \p p
      * \retval false otherwise
      */
-    bool mesh_tet_contains_point(
+    template <class T> bool mesh_tet_contains_point(
 	const Mesh& M, index_t t, const vec3& p
     ) {
-        const vec3& p0 = Geom::mesh_vertex(M, M.cells.vertex(t,0));
-        const vec3& p1 = Geom::mesh_vertex(M, M.cells.vertex(t,1));
-        const vec3& p2 = Geom::mesh_vertex(M, M.cells.vertex(t,2));
-        const vec3& p3 = Geom::mesh_vertex(M, M.cells.vertex(t,3));
+        vec3 p0 = Geom::mesh_vertex_promoted<T>(M, M.cells.vertex(t,0));
+        vec3 p1 = Geom::mesh_vertex_promoted<T>(M, M.cells.vertex(t,1));
+        vec3 p2 = Geom::mesh_vertex_promoted<T>(M, M.cells.vertex(t,2));
+        vec3 p3 = Geom::mesh_vertex_promoted<T>(M, M.cells.vertex(t,3));
 
         Sign s[4];
         s[0] = PCK::orient_3d(p, p1, p2, p3);
@@ -424,21 +441,26 @@ namespace {
     /**
      * \brief Tests whether there is an intersection between a segment
      *  and a mesh facet.
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] q1 , q2 the extremities of the segment
      * \param[in] M the mesh
      * \param[in] f the facet
      */
-    bool segment_mesh_facet_intersection(
+    template <class T> bool segment_mesh_facet_intersection(
 	const vec3& q1, const vec3& q2,
         const Mesh& M,
         index_t f
     ) {
         index_t c = M.facets.corners_begin(f);
-        const vec3& p1 = Geom::mesh_vertex(M, M.facet_corners.vertex(c));
+        vec3 p1 = Geom::mesh_vertex_promoted<T>(M, M.facet_corners.vertex(c));
 	++c;
 	while(c+1 != M.facets.corners_end(f)) {
-	    const vec3& p2 = Geom::mesh_vertex(M, M.facet_corners.vertex(c));
-	    const vec3& p3 = Geom::mesh_vertex(M, M.facet_corners.vertex(c+1));
+	    vec3 p2 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c)
+	    );
+	    vec3 p3 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c+1)
+	    );
 	    if(segment_triangle_intersection(q1, q2, p1, p2, p3)) {
 		return true;
 	    }
@@ -450,6 +472,7 @@ namespace {
     /**
      * \brief Tests whether there is an intersection between a segment
      *  and a mesh facet.
+     * \tparam T the storage type of the coordinates, float or double
      * \param[in] q1 , q2 the extremities of the segment
      * \param[in] M the mesh
      * \param[in] f the facet
@@ -458,17 +481,21 @@ namespace {
      * \param[in,out] nearest_f index of the nearest intersected
      *  facet so far
      */
-    bool segment_mesh_facet_nearest_intersection(
+    template <class T> bool segment_mesh_facet_nearest_intersection(
 	const vec3& q1, const vec3& q2,
         const Mesh& M, index_t f,
 	double& nearest_t, index_t& nearest_f
     ) {
         index_t c = M.facets.corners_begin(f);
-        const vec3& p1 = Geom::mesh_vertex(M, M.facet_corners.vertex(c));
+        vec3 p1 = Geom::mesh_vertex_promoted<T>(M, M.facet_corners.vertex(c));
 	++c;
 	while(c+1 != M.facets.corners_end(f)) {
-	    const vec3& p2 = Geom::mesh_vertex(M, M.facet_corners.vertex(c));
-	    const vec3& p3 = Geom::mesh_vertex(M, M.facet_corners.vertex(c+1));
+	    vec3 p2 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c)
+	    );
+	    vec3 p3 = Geom::mesh_vertex_promoted<T>(
+		M, M.facet_corners.vertex(c+1)
+	    );
 	    if(
 		segment_triangle_nearest_intersection(
 		    q1, q2, p1, p2, p3, nearest_t
@@ -556,6 +583,211 @@ namespace {
 	return (tmax >= 0.0) && (tmin <= tmax) && (tmin <= 1.0);
     }
 
+    /**
+     * \brief The recursive function used by the implementation
+     *  of MeshFacetsAABB::nearest_facet().
+     * \tparam T the storage type of the coordinates, float or double
+     * \param[in] M the mesh
+     * \param[in] bboxes the hierarchy of bounding boxes
+     * \param[in] p query point
+     * \param[in,out] nearest_f the nearest facet so far,
+     * \param[in,out] nearest_point a point in nearest_f
+     * \param[in,out] sq_dist squared distance between p and nearest_point
+     * \param[in] n index of the current node in the AABB tree
+     * \param[in] b index of the first facet in the subtree under node \p n
+     * \param[in] e one position past the index of the last facet in the
+     *  subtree under node \p n
+     */
+    template <class T> void nearest_facet_recursive(
+        const Mesh& M, const vector<Box>& bboxes,
+        const vec3& p,
+        index_t& nearest_f, vec3& nearest_point, double& sq_dist,
+        index_t n, index_t b, index_t e
+    ) {
+        geo_debug_assert(e > b);
+
+        // If node is a leaf: compute point-facet distance
+        // and replace current if nearer
+        if(b + 1 == e) {
+            vec3 cur_nearest_point;
+            double cur_sq_dist;
+            get_point_facet_nearest_point<T>(
+                M, p, b, cur_nearest_point, cur_sq_dist
+            );
+            if(cur_sq_dist < sq_dist) {
+                nearest_f = b;
+                nearest_point = cur_nearest_point;
+                sq_dist = cur_sq_dist;
+            }
+            return;
+        }
+        index_t m = b + (e - b) / 2;
+        index_t childl = 2 * n;
+        index_t childr = 2 * n + 1;
+
+        double dl = point_box_signed_squared_distance(p, bboxes[childl]);
+        double dr = point_box_signed_squared_distance(p, bboxes[childr]);
+
+        // Traverse the "nearest" child first, so that it has more chances
+        // to prune the traversal of the other child.
+        if(dl < dr) {
+            if(dl < sq_dist) {
+                nearest_facet_recursive<T>(
+                    M, bboxes, p,
+                    nearest_f, nearest_point, sq_dist,
+                    childl, b, m
+                );
+            }
+            if(dr < sq_dist) {
+                nearest_facet_recursive<T>(
+                    M, bboxes, p,
+                    nearest_f, nearest_point, sq_dist,
+                    childr, m, e
+                );
+            }
+        } else {
+            if(dr < sq_dist) {
+                nearest_facet_recursive<T>(
+                    M, bboxes, p,
+                    nearest_f, nearest_point, sq_dist,
+                    childr, m, e
+                );
+            }
+            if(dl < sq_dist) {
+                nearest_facet_recursive<T>(
+                    M, bboxes, p,
+                    nearest_f, nearest_point, sq_dist,
+                    childl, b, m
+                );
+            }
+        }
+    }
+
+    /**
+     * \brief The recursive function used by the implementation
+     *  of MeshFacetsAABB::segment_intersection()
+     * \tparam T the storage type of the coordinates, float or double
+     * \param[in] M the mesh
+     * \param[in] bboxes the hierarchy of bounding boxes
+     * \param[in] q1 , q2 the segment
+     * \param[in] dirinv precomputed 1/(q2.x-q1.x), 1/(q2.y-q1.y),
+     *  1/(q2.z-q1.z)
+     * \param[in] n index of the current node in the AABB tree
+     * \param[in] b index of the first facet in the subtree under node \p n
+     * \param[in] e one position past the index of the last facet in the
+     *  subtree under node \p n
+     * \retval true if their was an intersection
+     * \retval false otherwise
+     */
+    template <class T> bool segment_intersection_recursive(
+        const Mesh& M, const vector<Box>& bboxes,
+        const vec3& q1, const vec3& q2, const vec3& dirinv,
+        index_t n, index_t b, index_t e
+    ) {
+	if(!segment_box_intersection(q1, dirinv, bboxes[n])) {
+	    return false;
+	}
+        if(b + 1 == e) {
+	    return segment_mesh_facet_intersection<T>(q1, q2, M, b);
+	}
+        index_t m = b + (e - b) / 2;
+        index_t childl = 2 * n;
+        index_t childr = 2 * n + 1;
+	return (
+	    segment_intersection_recursive<T>(
+		M, bboxes, q1, q2, dirinv, childl, b, m
+	    ) ||
+	    segment_intersection_recursive<T>(
+		M, bboxes, q1, q2, dirinv, childr, m, e
+	    )
+	);
+    }
+
+    /**
+     * \brief The recursive function used by the implementation
+     *  of MeshFacetsAABB::segment_nearest_intersection()
+     * \tparam T the storage type of the coordinates, float or double
+     * \param[in] M the mesh
+     * \param[in] bboxes the hierarchy of bounding boxes
+     * \param[in] q1 , q2 the segment
+     * \param[in] dirinv precomputed 1/(q2.x-q1.x), 1/(q2.y-q1.y),
+     *  1/(q2.z-q1.z)
+     * \param[in] n index of the current node in the AABB tree
+     * \param[in] b index of the first facet in the subtree under node \p n
+     * \param[in] e one position past the index of the last facet in the
+     *  subtree under node \p n
+     * \param[in,out] t the coordinate along [q1,q2] of the nearest 
+     *   intersection so-far.
+     * \param[in,out] f the nearest intersected facet so-far.
+     */
+    template <class T> void segment_nearest_intersection_recursive(
+        const Mesh& M, const vector<Box>& bboxes,
+        const vec3& q1, const vec3& q2, const vec3& dirinv,
+        index_t n, index_t b, index_t e,
+        double& t, index_t& f
+    ) {
+	if(!segment_box_intersection(q1, dirinv, bboxes[n])) {
+	    return;
+	}
+        if(b + 1 == e) {
+	    segment_mesh_facet_nearest_intersection<T>(q1, q2, M, b, t, f);
+	    return;
+	}
+        index_t m = b + (e - b) / 2;
+        index_t childl = 2 * n;
+        index_t childr = 2 * n + 1;
+	segment_nearest_intersection_recursive<T>(
+	    M, bboxes, q1, q2, dirinv, childl, b, m, t, f
+	);
+	segment_nearest_intersection_recursive<T>(
+	    M, bboxes, q1, q2, dirinv, childr, m, e, t, f
+	);
+    }
+
+    /**
+     * \brief The recursive function used by the implementation
+     *  of MeshCellsAABB::containing_tet().
+     * \tparam T the storage type of the coordinates, float or double
+     * \param[in] M the mesh
+     * \param[in] bboxes the hierarchy of bounding boxes
+     * \param[in] p a const reference to the query point
+     * \param[in] n index of the current node in the AABB tree
+     * \param[in] b index of the first tet in the subtree under node \p n
+     * \param[in] e one position past the index of the last tet in the
+     *  subtree under node \p n
+     * \return the index of one of the tetrahedra that contains \p p, or
+     *  NO_TET if \p p is outside the mesh.
+     */
+    template <class T> index_t containing_tet_recursive(
+        const Mesh& M, const vector<Box>& bboxes,
+        const vec3& p, 
+        index_t n, index_t b, index_t e        
+    ) {
+        if(!bboxes[n].contains(p)) {
+            return MeshCellsAABB::NO_TET;
+        }
+        
+        if(e==b+1) {
+            if(mesh_tet_contains_point<T>(M, b, p)) {
+                return b;
+            } else {
+                return MeshCellsAABB::NO_TET;
+            }
+        }
+        
+        index_t m = b + (e - b) / 2;
+        index_t childl = 2 * n;
+        index_t childr = 2 * n + 1;
+
+        index_t result = containing_tet_recursive<T>(
+            M, bboxes, p, childl, b, m
+        );
+        if(result == MeshCellsAABB::NO_TET) {
+            result = containing_tet_recursive<T>(M, bboxes, p, childr, m, e);
+        }
+        return result;
+    }
+
 
 }
 
@@ -584,9 +816,17 @@ namespace GEO {
                 1, 0, mesh_->facets.nb()
             ) + 1 // <-- this is because size == max_index + 1 !!!
         );
-        init_bboxes_recursive(
-            *mesh_, bboxes_, 1, 0, mesh_->facets.nb(), get_facet_bbox
-        );
+        if(mesh_->vertices.single_precision()) {
+            init_bboxes_recursive(
+                *mesh_, bboxes_, 1, 0, mesh_->facets.nb(),
+                get_facet_bbox<float>
+            );
+        } else {
+            init_bboxes_recursive(
+                *mesh_, bboxes_, 1, 0, mesh_->facets.nb(),
+                get_facet_bbox<double>
+            );
+        }
     }
 
     
@@ -623,7 +863,7 @@ namespace GEO {
         index_t v = mesh_->facet_corners.vertex(
             mesh_->facets.corners_begin(nearest_f)
         );
-        nearest_point = Geom::mesh_vertex(*mesh_, v);
+        nearest_point = Geom::mesh_vertex_promoted(*mesh_, v);
         sq_dist = Geom::distance2(p, nearest_point);
     }
 
@@ -632,62 +872,15 @@ namespace GEO {
         index_t& nearest_f, vec3& nearest_point, double& sq_dist,
         index_t n, index_t b, index_t e
     ) const {
-        geo_debug_assert(e > b);
-
-        // If node is a leaf: compute point-facet distance
-        // and replace current if nearer
-        if(b + 1 == e) {
-            vec3 cur_nearest_point;
-            double cur_sq_dist;
-            get_point_facet_nearest_point(
-                *mesh_, p, b, cur_nearest_point, cur_sq_dist
+        // The precision of the points is tested once per query
+        if(mesh_->vertices.single_precision()) {
+            ::nearest_facet_recursive<float>(
+                *mesh_, bboxes_, p, nearest_f, nearest_point, sq_dist, n, b, e
             );
-            if(cur_sq_dist < sq_dist) {
-                nearest_f = b;
-                nearest_point = cur_nearest_point;
-                sq_dist = cur_sq_dist;
-            }
-            return;
-        }
-        index_t m = b + (e - b) / 2;
-        index_t childl = 2 * n;
-        index_t childr = 2 * n + 1;
-
-        double dl = point_box_signed_squared_distance(p, bboxes_[childl]);
-        double dr = point_box_signed_squared_distance(p, bboxes_[childr]);
-
-        // Traverse the "nearest" child first, so that it has more chances
-        // to prune the traversal of the other child.
-        if(dl < dr) {
-            if(dl < sq_dist) {
-                nearest_facet_recursive(
-                    p,
-                    nearest_f, nearest_point, sq_dist,
-                    childl, b, m
-                );
-            }
-            if(dr < sq_dist) {
-                nearest_facet_recursive(
-                    p,
-                    nearest_f, nearest_point, sq_dist,
-                    childr, m, e
-                );
-            }
         } else {
-            if(dr < sq_dist) {
-                nearest_facet_recursive(
-                    p,
-                    nearest_f, nearest_point, sq_dist,
-                    childr, m, e
-                );
-            }
-            if(dl < sq_dist) {
-                nearest_facet_recursive(
-                    p,
-                    nearest_f, nearest_point, sq_dist,
-                    childl, b, m
-                );
-            }
+            ::nearest_facet_recursive<double>(
+                *mesh_, bboxes_, p, nearest_f, nearest_point, sq_dist, n, b, e
+            );
         }
     }
 
@@ -702,21 +895,18 @@ namespace GEO {
     }
 
     bool MeshFacetsAABB::segment_intersection_recursive(
-	const vec3& q1, const vec3& q2, const vec3& dirinv, index_t n, index_t b, index_t e
+	const vec3& q1, const vec3& q2, const vec3& dirinv,
+	index_t n, index_t b, index_t e
     ) const {
-	if(!segment_box_intersection(q1, dirinv, bboxes_[n])) {
-	    return false;
-	}
-        if(b + 1 == e) {
-	    return segment_mesh_facet_intersection(q1, q2, *mesh_, b);
-	}
-        index_t m = b + (e - b) / 2;
-        index_t childl = 2 * n;
-        index_t childr = 2 * n + 1;
-	return (
-	    segment_intersection_recursive(q1, q2, dirinv, childl, b, m) ||
-	    segment_intersection_recursive(q1, q2, dirinv, childr, m, e)
-	);
+        // The precision of the points is tested once per query
+        if(mesh_->vertices.single_precision()) {
+            return ::segment_intersection_recursive<float>(
+                *mesh_, bboxes_, q1, q2, dirinv, n, b, e
+            );
+        }
+        return ::segment_intersection_recursive<double>(
+            *mesh_, bboxes_, q1, q2, dirinv, n, b, e
+        );
     }
 
     bool MeshFacetsAABB::segment_nearest_intersection(
@@ -736,21 +926,20 @@ namespace GEO {
     }
     
     void MeshFacetsAABB::segment_nearest_intersection_recursive(
-	const vec3& q1, const vec3& q2, const vec3& dirinv, index_t n, index_t b, index_t e,
+	const vec3& q1, const vec3& q2, const vec3& dirinv,
+	index_t n, index_t b, index_t e,
 	double& t, index_t& f
     ) const {
-	if(!segment_box_intersection(q1, dirinv, bboxes_[n])) {
-	    return;
-	}
-        if(b + 1 == e) {
-	    segment_mesh_facet_nearest_intersection(q1, q2, *mesh_, b, t, f);
-	    return;
-	}
-        index_t m = b + (e - b) / 2;
-        index_t childl = 2 * n;
-        index_t childr = 2 * n + 1;
-	segment_nearest_intersection_recursive(q1, q2, dirinv, childl, b, m, t, f);
-	segment_nearest_intersection_recursive(q1, q2, dirinv, childr, m, e, t, f);
+        // The precision of the points is tested once per query
+        if(mesh_->vertices.single_precision()) {
+            ::segment_nearest_intersection_recursive<float>(
+                *mesh_, bboxes_, q1, q2, dirinv, n, b, e, t, f
+            );
+        } else {
+            ::segment_nearest_intersection_recursive<double>(
+                *mesh_, bboxes_, q1, q2, dirinv, n, b, e, t, f
+            );
+        }
     }
     
     
@@ -773,14 +962,31 @@ namespace GEO {
                 1, 0, mesh_->cells.nb()
             ) + 1 // <-- this is because size == max_index + 1 !!!
         );
+        bool fp32 = mesh_->vertices.single_precision();
         if(mesh_->cells.are_simplices()) {
-            init_bboxes_recursive(
-                *mesh_, bboxes_, 1, 0, mesh_->cells.nb(), get_tet_bbox
-            );
+            if(fp32) {
+                init_bboxes_recursive(
+                    *mesh_, bboxes_, 1, 0, mesh_->cells.nb(),
+                    get_tet_bbox<float>
+                );
+            } else {
+                init_bboxes_recursive(
+                    *mesh_, bboxes_, 1, 0, mesh_->cells.nb(),
+                    get_tet_bbox<double>
+                );
+            }
         } else {
-            init_bboxes_recursive(
-                *mesh_, bboxes_, 1, 0, mesh_->cells.nb(), get_cell_bbox
-            );
+            if(fp32) {
+                init_bboxes_recursive(
+                    *mesh_, bboxes_, 1, 0, mesh_->cells.nb(),
+                    get_cell_bbox<float>
+                );
+            } else {
+                init_bboxes_recursive(
+                    *mesh_, bboxes_, 1, 0, mesh_->cells.nb(),
+                    get_cell_bbox<double>
+                );
+            }
         }
     }
 
@@ -788,30 +994,15 @@ namespace GEO {
         const vec3& p, 
         index_t n, index_t b, index_t e        
     ) const {
-
-        if(!bboxes_[n].contains(p)) {
-            return NO_TET;
-        }
-        
-        if(e==b+1) {
-            if(mesh_tet_contains_point(*mesh_, b, p)) {
-                return b;
-            } else {
-                return NO_TET;
-            }
+        // The precision of the points is tested once per query
+        if(mesh_->vertices.single_precision()) {
+            return ::containing_tet_recursive<float>(
+                *mesh_, bboxes_, p, n, b, e
+            );
         }
-        
-        index_t m = b + (e - b) / 2;
-        index_t childl = 2 * n;
-        index_t childr = 2 * n + 1;
-
-        index_t result = containing_tet_recursive(
-            p, childl, b, m
+        return ::containing_tet_recursive<double>(
+            *mesh_, bboxes_, p, n, b, e
         );
-        if(result == NO_TET) {
-            result = containing_tet_recursive(p, childr, m, e);
-        }
-        return result;
     }
     
 /****************************************************************************/
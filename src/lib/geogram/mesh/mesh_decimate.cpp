@@ -48,8 +48,1132 @@
 #include <geogram/mesh/mesh_geometry.h>
 #include <geogram/mesh/mesh_degree3_vertices.h>
 #include <geogram/points/colocate.h>
+#include <geogram/mesh/mesh_incidence.h>
+#include <geogram/mesh/mesh_reorder.h>
 #include <geogram/basic/stopwatch.h>
 #include <geogram/basic/algorithm.h>
+#include <geogram/basic/process.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Maximum dimension of the quadrics (3 for the position,
+     *  3 for the normal and 2 for the texture coordinates).
+     */
+    const index_t MAX_QUADRIC_DIM = 8;
+
+    /**
+     * \brief Number of vertices in a block.
+     * \details Each block of vertices (contiguous in Hilbert order)
+     *  selects its collapses independently.
+     */
+    const index_t DECIMATE_BLOCK_SIZE = 4096;
+
+    /**
+     * \brief At each pass, the collapses are selected among the cheapest
+     *  1/DECIMATE_CANDIDATES_RATIO edges.
+     */
+    const index_t DECIMATE_CANDIDATES_RATIO = 4;
+
+    /**
+     * \brief Weight of the planes that preserve the borders
+     *  and the sharp edges, relative to the planes of the facets.
+     */
+    const double DECIMATE_FEATURE_WEIGHT = 10.0;
+
+    /**
+     * \brief Weight of the squared distance to the initial position
+     *  of a vertex, relative to the planes of the facets.
+     * \details This regularization term makes the quadrics invertible,
+     *  and in flat regions, where all the collapses have a zero cost,
+     *  it favors the shortest edges, which produces better shaped
+     *  triangles.
+     */
+    const double DECIMATE_REGULARIZATION_WEIGHT = 1e-5;
+
+    /**
+     * \brief Scaling of the attributes (normals and texture coordinates),
+     *  relative to the bounding box diagonal.
+     * \details A unit change of an attribute costs as much as a
+     *  displacement of this fraction of the bounding box diagonal.
+     */
+    const double DECIMATE_ATTRIBUTE_WEIGHT = 0.01;
+
+    /**
+     * \brief An edge collapse candidate.
+     */
+    struct EdgeCollapse {
+        /** \brief the vertex removed by the collapse */
+        index_t v;
+        /** \brief the vertex kept by the collapse */
+        index_t w;
+        /** \brief the quadric error of the collapse */
+        double cost;
+    };
+
+    /**
+     * \brief Decimates a surface mesh by edge collapses,
+     *  using quadric error metrics.
+     * \details The quadrics are generalized to points with attributes
+     *  as in Garland and Heckbert, Simplifying surfaces with color and
+     *  texture using quadric error metrics, IEEE Visualization 1998.
+     *  Each pass computes the cost of all the edges, then the
+     *  vertices are split into blocks along the Hilbert order, and
+     *  each block greedily selects in parallel the cheapest collapses
+     *  whose one-ring is in the block and does not overlap a previously
+     *  selected collapse. The boundaries of the blocks are shifted at
+     *  each pass.
+     */
+    class QuadricDecimation {
+    public:
+        /**
+         * \brief QuadricDecimation constructor.
+         * \param[in] M the surface mesh, with triangular facets
+         * \param[in] mode a combination of #MeshDecimateQuadricMode flags
+         * \param[in] feature_angle minimum angle (in degrees) between the
+         *  normals of two adjacent facets for their common edge to be
+         *  considered as a sharp edge
+         * \param[in] vertices_flags if non-null, an array of flags, the
+         *  vertices with a non-zero flag are preserved
+         */
+        QuadricDecimation(
+            Mesh& M, MeshDecimateQuadricMode mode,
+            double feature_angle, const geo_index_t* vertices_flags
+        ) :
+            M_(M),
+            mode_(mode),
+            cos_feature_angle_(::cos(feature_angle * M_PI / 180.0)),
+            dim_(3),
+            normal_offset_(0),
+            tex_coord_offset_(0),
+            attribute_scale_(1.0),
+            incidence_(M) {
+            index_t nv = M_.vertices.nb();
+
+            if(mode_ & MESH_DECIMATE_QUADRIC_NORMALS) {
+                normal_.bind_if_is_defined(M_.vertices.attributes(), "normal");
+                if(normal_.is_bound() && normal_.dimension() == 3) {
+                    normal_offset_ = dim_;
+                    dim_ += 3;
+                } else if(normal_.is_bound()) {
+                    normal_.unbind();
+                }
+            }
+            if(mode_ & MESH_DECIMATE_QUADRIC_TEX_COORDS) {
+                tex_coord_.bind_if_is_defined(
+                    M_.vertices.attributes(), "tex_coord"
+                );
+                if(tex_coord_.is_bound() && tex_coord_.dimension() == 2) {
+                    tex_coord_offset_ = dim_;
+                    dim_ += 2;
+                } else if(tex_coord_.is_bound()) {
+                    tex_coord_.unbind();
+                }
+            }
+            geo_assert(dim_ <= MAX_QUADRIC_DIM);
+            Q_stride_ = dim_ * (dim_ + 1) / 2 + dim_ + 1;
+            attribute_scale_ = DECIMATE_ATTRIBUTE_WEIGHT * bbox_diagonal(M_);
+
+            // Points with attributes
+            X_.resize(size_t(nv) * dim_);
+            parallel_for(
+                0, nv,
+                [this](index_t v) {
+                    double* x = X(v);
+                    const double* p = M_.vertices.point_ptr(v);
+                    x[0] = p[0];
+                    x[1] = p[1];
+                    x[2] = p[2];
+                    if(normal_.is_bound()) {
+                        for(index_t c = 0; c < 3; ++c) {
+                            x[normal_offset_ + c] =
+                                attribute_scale_ * normal_[3 * v + c];
+                        }
+                    }
+                    if(tex_coord_.is_bound()) {
+                        for(index_t c = 0; c < 2; ++c) {
+                            x[tex_coord_offset_ + c] =
+                                attribute_scale_ * tex_coord_[2 * v + c];
+                        }
+                    }
+                }
+            );
+
+            locked_.assign(nv, 0);
+            if(vertices_flags != nullptr) {
+                for(index_t v = 0; v < nv; ++v) {
+                    if(vertices_flags[v] != 0) {
+                        locked_[v] = 1;
+                    }
+                }
+            }
+            border_.assign(nv, 0);
+            non_manifold_.assign(nv, 0);
+            marked_.assign(nv, 0);
+            moved_.assign(nv, 0);
+            removed_.assign(nv, 0);
+            remap_.assign(nv, NO_VERTEX);
+
+            // Hilbert order, used to partition the vertices into blocks.
+            sorted_.resize(nv);
+            for(index_t v = 0; v < nv; ++v) {
+                sorted_[v] = v;
+            }
+            if(nv > 1) {
+                compute_Hilbert_order(
+                    nv, M_.vertices.point_ptr(0), sorted_, 0, nv,
+                    3, M_.vertices.dimension()
+                );
+            }
+            rank_.assign(nv, 0);
+
+            init_quadrics();
+        }
+
+        /**
+         * \brief Collapses edges until the mesh has the specified number
+         *  of facets or no edge can be collapsed.
+         * \param[in] nb_facets the target number of facets
+         * \return the number of facets of the decimated mesh
+         */
+        index_t decimate(index_t nb_facets) {
+            index_t pass = 0;
+            index_t nb_fails = 0;
+            index_t nb_collapses = 0;
+            while(M_.facets.nb() > nb_facets && nb_fails < 2) {
+                index_t nb = collapse_pass(
+                    M_.facets.nb() - nb_facets,
+                    (pass % 2) * (DECIMATE_BLOCK_SIZE / 2)
+                );
+                nb_collapses += nb;
+                nb_fails = (nb == 0) ? nb_fails + 1 : 0;
+                ++pass;
+            }
+            Logger::out("Decimate") << "Collapsed " << nb_collapses
+                                    << " edges in " << pass << " passes"
+                                    << std::endl;
+            end();
+            return M_.facets.nb();
+        }
+
+    protected:
+
+        /**
+         * \brief Gets the point with attributes associated with a vertex.
+         * \param[in] v the vertex
+         * \return a pointer to the dim_ coordinates of the point
+         */
+        double* X(index_t v) {
+            return X_.data() + size_t(v) * dim_;
+        }
+
+        /**
+         * \copydoc X(index_t)
+         */
+        const double* X(index_t v) const {
+            return X_.data() + size_t(v) * dim_;
+        }
+
+        /**
+         * \brief Gets the position of a vertex.
+         * \param[in] v the vertex
+         * \return a const reference to the position of \p v
+         */
+        const vec3& P(index_t v) const {
+            return *reinterpret_cast<const vec3*>(X(v));
+        }
+
+        /**
+         * \brief Gets the quadric associated with a vertex.
+         * \details A quadric is stored as the upper triangle of the 
+         *  symmetric matrix A (row by row), followed by the vector b
+         *  and the scalar c. It evaluates to x^T A x + 2 b^T x + c.
+         * \param[in] v the vertex
+         * \return a pointer to the Q_stride_ coefficients of the quadric
+         */
+        double* Q(index_t v) {
+            return Q_.data() + size_t(v) * Q_stride_;
+        }
+
+        /**
+         * \copydoc Q(index_t)
+         */
+        const double* Q(index_t v) const {
+            return Q_.data() + size_t(v) * Q_stride_;
+        }
+
+        /**
+         * \brief Gets the index of a coefficient of the matrix
+         *  of a quadric.
+         * \param[in] i , j the row and the column, with i <= j
+         * \return the index of the coefficient in the quadric
+         */
+        index_t A_index(index_t i, index_t j) const {
+            geo_debug_assert(i <= j);
+            return i * dim_ - i * (i - 1) / 2 + (j - i);
+        }
+
+        /**
+         * \brief Adds to a quadric the squared distance to the
+         *  plane of a triangle, in the space of points with attributes.
+         * \param[in,out] Q the quadric
+         * \param[in] p , q , r the three vertices of the triangle
+         * \param[in] w the weight
+         */
+        void add_triangle_quadric(
+            double* Q, index_t p, index_t q, index_t r, double w
+        ) const {
+            const double* xp = X(p);
+            const double* xq = X(q);
+            const double* xr = X(r);
+            double e1[MAX_QUADRIC_DIM];
+            double e2[MAX_QUADRIC_DIM];
+            double l1 = 0.0;
+            for(index_t i = 0; i < dim_; ++i) {
+                e1[i] = xq[i] - xp[i];
+                l1 += e1[i] * e1[i];
+            }
+            if(l1 == 0.0) {
+                return;
+            }
+            l1 = 1.0 / ::sqrt(l1);
+            double d = 0.0;
+            for(index_t i = 0; i < dim_; ++i) {
+                e1[i] *= l1;
+                e2[i] = xr[i] - xp[i];
+                d += e1[i] * e2[i];
+            }
+            double l2 = 0.0;
+            for(index_t i = 0; i < dim_; ++i) {
+                e2[i] -= d * e1[i];
+                l2 += e2[i] * e2[i];
+            }
+            if(l2 == 0.0) {
+                return;
+            }
+            l2 = 1.0 / ::sqrt(l2);
+            double pe1 = 0.0;
+            double pe2 = 0.0;
+            double pp = 0.0;
+            for(index_t i = 0; i < dim_; ++i) {
+                e2[i] *= l2;
+                pe1 += xp[i] * e1[i];
+                pe2 += xp[i] * e2[i];
+                pp += xp[i] * xp[i];
+            }
+            index_t k = 0;
+            for(index_t i = 0; i < dim_; ++i) {
+                for(index_t j = i; j < dim_; ++j) {
+                    double a = -e1[i] * e1[j] - e2[i] * e2[j];
+                    if(i == j) {
+                        a += 1.0;
+                    }
+                    Q[k] += w * a;
+                    ++k;
+                }
+            }
+            for(index_t i = 0; i < dim_; ++i) {
+                Q[k] += w * (pe1 * e1[i] + pe2 * e2[i] - xp[i]);
+                ++k;
+            }
+            Q[k] += w * (pp - pe1 * pe1 - pe2 * pe2);
+        }
+
+        /**
+         * \brief Adds to a quadric the squared distance to a plane
+         *  in the space of the positions.
+         * \param[in,out] Q the quadric
+         * \param[in] N the unit normal to the plane
+         * \param[in] p a point of the plane
+         * \param[in] w the weight
+         */
+        void add_plane_quadric(
+            double* Q, const vec3& N, const vec3& p, double w
+        ) const {
+            double d = -dot(N, p);
+            for(index_t i = 0; i < 3; ++i) {
+                for(index_t j = i; j < 3; ++j) {
+                    Q[A_index(i, j)] += w * N[i] * N[j];
+                }
+            }
+            index_t b = dim_ * (dim_ + 1) / 2;
+            for(index_t i = 0; i < 3; ++i) {
+                Q[b + i] += w * d * N[i];
+            }
+            Q[b + dim_] += w * d * d;
+        }
+
+        /**
+         * \brief Adds to a quadric the squared distance to a point
+         *  in the space of the positions.
+         * \param[in,out] Q the quadric
+         * \param[in] p the point
+         * \param[in] w the weight
+         */
+        void add_point_quadric(double* Q, const vec3& p, double w) const {
+            index_t b = dim_ * (dim_ + 1) / 2;
+            for(index_t i = 0; i < 3; ++i) {
+                Q[A_index(i, i)] += w;
+                Q[b + i] -= w * p[i];
+            }
+            Q[b + dim_] += w * dot(p, p);
+        }
+
+        /**
+         * \brief Evaluates the sum of two quadrics at a point.
+         * \param[in] Q1 , Q2 the two quadrics
+         * \param[in] x the point with attributes
+         * \return the value of the sum of the quadrics at \p x
+         */
+        double evaluate(
+            const double* Q1, const double* Q2, const double* x
+        ) const {
+            double result = 0.0;
+            index_t k = 0;
+            for(index_t i = 0; i < dim_; ++i) {
+                for(index_t j = i; j < dim_; ++j) {
+                    double a = Q1[k] + Q2[k];
+                    result += (i == j) ?
+                        a * x[i] * x[i] : 2.0 * a * x[i] * x[j];
+                    ++k;
+                }
+            }
+            for(index_t i = 0; i < dim_; ++i) {
+                result += 2.0 * (Q1[k] + Q2[k]) * x[i];
+                ++k;
+            }
+            result += Q1[k] + Q2[k];
+            return std::max(result, 0.0);
+        }
+
+        /**
+         * \brief Computes the point that minimizes the sum of two quadrics.
+         * \param[in] Q1 , Q2 the two quadrics
+         * \param[out] x the point with attributes that minimizes Q1 + Q2
+         * \retval true if the minimum is unique
+         * \retval false otherwise (and x is undefined)
+         */
+        bool minimize(
+            const double* Q1, const double* Q2, double* x
+        ) const {
+            double A[MAX_QUADRIC_DIM][MAX_QUADRIC_DIM + 1];
+            double max_diag = 0.0;
+            index_t k = 0;
+            for(index_t i = 0; i < dim_; ++i) {
+                for(index_t j = i; j < dim_; ++j) {
+                    A[i][j] = A[j][i] = Q1[k] + Q2[k];
+                    ++k;
+                }
+                max_diag = std::max(max_diag, ::fabs(A[i][i]));
+            }
+            for(index_t i = 0; i < dim_; ++i) {
+                A[i][dim_] = -(Q1[k] + Q2[k]);
+                ++k;
+            }
+            // Gaussian elimination with partial pivoting
+            for(index_t i = 0; i < dim_; ++i) {
+                index_t pivot = i;
+                for(index_t j = i + 1; j < dim_; ++j) {
+                    if(::fabs(A[j][i]) > ::fabs(A[pivot][i])) {
+                        pivot = j;
+                    }
+                }
+                if(::fabs(A[pivot][i]) <= 1e-10 * max_diag) {
+                    return false;
+                }
+                if(pivot != i) {
+                    for(index_t j = i; j <= dim_; ++j) {
+                        std::swap(A[i][j], A[pivot][j]);
+                    }
+                }
+                for(index_t j = i + 1; j < dim_; ++j) {
+                    double s = A[j][i] / A[i][i];
+                    for(index_t l = i; l <= dim_; ++l) {
+                        A[j][l] -= s * A[i][l];
+                    }
+                }
+            }
+            for(index_t i = dim_; i-- > 0;) {
+                double s = A[i][dim_];
+                for(index_t j = i + 1; j < dim_; ++j) {
+                    s -= A[i][j] * x[j];
+                }
+                x[i] = s / A[i][i];
+            }
+            return true;
+        }
+
+        /**
+         * \brief Gets the one-ring of a vertex.
+         * \param[in] v the vertex
+         * \param[out] N the two other vertices of each facet incident to
+         *  \p v, sorted. An edge incident to \p v appears once per facet.
+         */
+        void get_one_ring(index_t v, vector<index_t>& N) const {
+            const MeshVertexIncidence& I = incidence_;
+            N.clear();
+            for(index_t f: I.facets(v)) {
+                for(index_t lv = 0; lv < 3; ++lv) {
+                    index_t w = M_.facets.vertex(f, lv);
+                    if(w != v) {
+                        N.push_back(w);
+                    }
+                }
+            }
+            std::sort(N.begin(), N.end());
+        }
+
+        /**
+         * \brief Counts the facets incident to an edge.
+         * \param[in] N the one-ring of a vertex v, as returned 
+         *  by get_one_ring()
+         * \param[in] w a vertex
+         * \return the number of facets incident to the edge (v,w)
+         */
+        static index_t nb_edge_facets(const vector<index_t>& N, index_t w) {
+            auto it = std::equal_range(N.begin(), N.end(), w);
+            return index_t(it.second - it.first);
+        }
+
+        /**
+         * \brief Computes the normal to a facet.
+         * \param[in] f the facet
+         * \return the non-normalized normal to \p f, using the
+         *  current positions of the vertices
+         */
+        vec3 facet_normal(index_t f) const {
+            const vec3& p1 = P(M_.facets.vertex(f, 0));
+            const vec3& p2 = P(M_.facets.vertex(f, 1));
+            const vec3& p3 = P(M_.facets.vertex(f, 2));
+            return cross(p2 - p1, p3 - p1);
+        }
+
+        /**
+         * \brief Computes the initial quadrics.
+         * \details The quadric of a vertex sums the planes of its 
+         *  incident facets weighted by their areas, and the planes 
+         *  orthogonal to the surface along its incident border edges 
+         *  and sharp edges. The border vertices are also locked if 
+         *  MESH_DECIMATE_QUADRIC_KEEP_B is set.
+         */
+        void init_quadrics() {
+            index_t nv = M_.vertices.nb();
+            Q_.assign(size_t(nv) * Q_stride_, 0.0);
+            incidence_.update(MESH_FACETS);
+            bool features = (mode_ & MESH_DECIMATE_QUADRIC_FEATURES) != 0;
+            bool keep_b = (mode_ & MESH_DECIMATE_QUADRIC_KEEP_B) != 0;
+            parallel_for_slice(
+                0, nv,
+                [&](index_t from, index_t to) {
+                    vector<index_t> N;
+                    for(index_t v = from; v < to; ++v) {
+                        double* q = Q(v);
+                        get_one_ring(v, N);
+                        for(index_t f: incidence_.facets(v)) {
+                            index_t p1 = M_.facets.vertex(f, 0);
+                            index_t p2 = M_.facets.vertex(f, 1);
+                            index_t p3 = M_.facets.vertex(f, 2);
+                            vec3 Nf = facet_normal(f);
+                            double l = length(Nf);
+                            add_triangle_quadric(q, p1, p2, p3, 0.5 * l);
+                            add_point_quadric(
+                                q, P(v),
+                                DECIMATE_REGULARIZATION_WEIGHT * l / 6.0
+                            );
+                            if(l == 0.0) {
+                                continue;
+                            }
+                            Nf = (1.0 / l) * Nf;
+                            // Border and sharp edges of f incident to v
+                            for(index_t lv = 0; lv < 3; ++lv) {
+                                index_t w = M_.facets.vertex(f, lv);
+                                if(w == v) {
+                                    continue;
+                                }
+                                index_t nb = nb_edge_facets(N, w);
+                                bool feature = (nb == 1);
+                                if(!feature && nb == 2 && features) {
+                                    feature = is_sharp_edge(f, v, w, Nf);
+                                }
+                                if(feature) {
+                                    vec3 E = P(w) - P(v);
+                                    vec3 Ne = normalize(cross(E, Nf));
+                                    add_plane_quadric(
+                                        q, Ne, P(v),
+                                        DECIMATE_FEATURE_WEIGHT * 
+                                        length2(E)
+                                    );
+                                }
+                                if(nb == 1 && keep_b) {
+                                    locked_[v] = 1;
+                                }
+                            }
+                        }
+                    }
+                }
+            );
+        }
+
+        /**
+         * \brief Tests whether an edge is sharp.
+         * \param[in] f a facet incident to the edge
+         * \param[in] v , w the two vertices of the edge
+         * \param[in] Nf the unit normal to \p f
+         * \retval true if the angle between the normal to \p f and the 
+         *  normal to the other facet incident to (v,w) is larger than
+         *  the feature angle
+         * \retval false otherwise
+         */
+        bool is_sharp_edge(
+            index_t f, index_t v, index_t w, const vec3& Nf
+        ) const {
+            for(index_t g: incidence_.facets(v)) {
+                if(g == f) {
+                    continue;
+                }
+                for(index_t lv = 0; lv < 3; ++lv) {
+                    if(M_.facets.vertex(g, lv) == w) {
+                        vec3 Ng = normalize(facet_normal(g));
+                        return dot(Nf, Ng) < cos_feature_angle_;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * \brief Computes the point where the vertex resulting from the
+         *  collapse of an edge is placed.
+         * \param[in] v the removed vertex
+         * \param[in] w the kept vertex
+         * \param[out] x the point with attributes
+         * \return the quadric error at \p x
+         */
+        double collapse_point(index_t v, index_t w, double* x) const {
+            const double* Qv = Q(v);
+            const double* Qw = Q(w);
+            if(locked_[w] || !minimize(Qv, Qw, x)) {
+                // Locked vertex or degenerate quadric: use the
+                // best of the two vertices and the midpoint.
+                double best = evaluate(Qv, Qw, X(w));
+                for(index_t i = 0; i < dim_; ++i) {
+                    x[i] = X(w)[i];
+                }
+                if(locked_[w]) {
+                    return best;
+                }
+                double y[MAX_QUADRIC_DIM];
+                for(index_t i = 0; i < dim_; ++i) {
+                    y[i] = X(v)[i];
+                }
+                double cost = evaluate(Qv, Qw, y);
+                if(cost < best) {
+                    best = cost;
+                    for(index_t i = 0; i < dim_; ++i) {
+                        x[i] = y[i];
+                    }
+                }
+                for(index_t i = 0; i < dim_; ++i) {
+                    y[i] = 0.5 * (X(v)[i] + X(w)[i]);
+                }
+                cost = evaluate(Qv, Qw, y);
+                if(cost < best) {
+                    best = cost;
+                    for(index_t i = 0; i < dim_; ++i) {
+                        x[i] = y[i];
+                    }
+                }
+                return best;
+            }
+            return evaluate(Qv, Qw, x);
+        }
+
+        /**
+         * \brief Gets the block of a vertex.
+         * \param[in] v the vertex
+         * \param[in] offset the shift of the blocks boundaries
+         * \return the index of the block that contains \p v
+         */
+        index_t block(index_t v, index_t offset) const {
+            return (rank_[v] + offset) / DECIMATE_BLOCK_SIZE;
+        }
+
+        /**
+         * \brief Computes all the collapsible edges and their costs.
+         * \details Also updates the border_ and non_manifold_ flags.
+         * \param[out] edges the edges
+         */
+        void compute_edges(vector<EdgeCollapse>& edges) {
+            index_t nv = M_.vertices.nb();
+            vector<index_t> edge_ptr(nv + 1, 0);
+
+            // Step 1: count the edges (v,w) with w > v, and classify 
+            // the vertices.
+            parallel_for_slice(
+                0, nv,
+                [&](index_t from, index_t to) {
+                    vector<index_t> N;
+                    for(index_t v = from; v < to; ++v) {
+                        get_one_ring(v, N);
+                        border_[v] = 0;
+                        non_manifold_[v] = 0;
+                        index_t nb = 0;
+                        for(index_t i = 0; i < N.size(); ) {
+                            index_t j = i + 1;
+                            while(j < N.size() && N[j] == N[i]) {
+                                ++j;
+                            }
+                            if(j - i == 1) {
+                                border_[v] = 1;
+                            } else if(j - i > 2) {
+                                non_manifold_[v] = 1;
+                            }
+                            if(N[i] > v) {
+                                ++nb;
+                            }
+                            i = j;
+                        }
+                        edge_ptr[v + 1] = nb;
+                    }
+                }
+            );
+            for(index_t v = 0; v < nv; ++v) {
+                edge_ptr[v + 1] += edge_ptr[v];
+            }
+
+            // Step 2: compute the collapses and their costs
+            edges.resize(edge_ptr[nv]);
+            parallel_for_slice(
+                0, nv,
+                [&](index_t from, index_t to) {
+                    vector<index_t> N;
+                    double x[MAX_QUADRIC_DIM];
+                    for(index_t v = from; v < to; ++v) {
+                        get_one_ring(v, N);
+                        index_t e = edge_ptr[v];
+                        for(index_t i = 0; i < N.size(); ) {
+                            index_t j = i + 1;
+                            while(j < N.size() && N[j] == N[i]) {
+                                ++j;
+                            }
+                            index_t w = N[i];
+                            if(w > v) {
+                                EdgeCollapse& E = edges[e];
+                                ++e;
+                                // The locked vertex (if any) is kept
+                                if(locked_[v]) {
+                                    E.v = w;
+                                    E.w = v;
+                                } else {
+                                    E.v = v;
+                                    E.w = w;
+                                }
+                                E.cost = Numeric::max_float64();
+                                if(
+                                    j - i <= 2 &&
+                                    !(locked_[v] && locked_[w]) &&
+                                    !non_manifold_[v] && !non_manifold_[w] &&
+                                    // Interior edge between two borders
+                                    !(j - i == 2 && border_[v] && border_[w])
+                                ) {
+                                    E.cost = collapse_point(E.v, E.w, x);
+                                }
+                            }
+                            i = j;
+                        }
+                    }
+                }
+            );
+        }
+
+        /**
+         * \brief Tests whether an edge collapse is valid.
+         * \details The collapse is valid if it preserves the topology 
+         *  (link condition), if it does not flip any facet, and if its
+         *  one-ring is in the block.
+         * \param[in] E the edge collapse
+         * \param[in] x the point with attributes where the vertex that
+         *  results from the collapse is placed
+         * \param[in] b the block
+         * \param[in] offset the shift of the blocks boundaries
+         * \param[out] Nv , Nw the one-rings of E.v and E.w
+         * \retval true if the collapse is valid
+         * \retval false otherwise
+         */
+        bool collapse_is_valid(
+            const EdgeCollapse& E, const double* x,
+            index_t b, index_t offset,
+            vector<index_t>& Nv, vector<index_t>& Nw
+        ) const {
+            get_one_ring(E.v, Nv);
+            get_one_ring(E.w, Nw);
+            for(index_t u: Nv) {
+                if(block(u, offset) != b || marked_[u]) {
+                    return false;
+                }
+            }
+            for(index_t u: Nw) {
+                if(block(u, offset) != b || marked_[u]) {
+                    return false;
+                }
+            }
+
+            // Link condition: the common neighbors of v and w
+            // are the vertices opposite to the edge.
+            index_t nb_edge_f = nb_edge_facets(Nv, E.w);
+            index_t nb_common = 0;
+            index_t nb_v_neigh = 0;
+            index_t nb_w_neigh = 0;
+            for(index_t i = 0; i < Nv.size(); ++i) {
+                if(i != 0 && Nv[i] == Nv[i-1]) {
+                    continue;
+                }
+                ++nb_v_neigh;
+                if(
+                    Nv[i] != E.w &&
+                    std::binary_search(Nw.begin(), Nw.end(), Nv[i])
+                ) {
+                    ++nb_common;
+                }
+            }
+            for(index_t i = 0; i < Nw.size(); ++i) {
+                if(i == 0 || Nw[i] != Nw[i-1]) {
+                    ++nb_w_neigh;
+                }
+            }
+            if(nb_common != nb_edge_f) {
+                return false;
+            }
+            // Do not collapse a tetrahedron
+            if(nb_edge_f == 2 && nb_v_neigh == 3 && nb_w_neigh == 3) {
+                return false;
+            }
+
+            // Flipped facets
+            const vec3& p = *reinterpret_cast<const vec3*>(x);
+            for(index_t k = 0; k < 2; ++k) {
+                index_t v = (k == 0) ? E.v : E.w;
+                index_t w = (k == 0) ? E.w : E.v;
+                for(index_t f: incidence_.facets(v)) {
+                    index_t lv = 0;
+                    bool has_w = false;
+                    for(index_t i = 0; i < 3; ++i) {
+                        index_t u = M_.facets.vertex(f, i);
+                        if(u == v) {
+                            lv = i;
+                        } else if(u == w) {
+                            has_w = true;
+                        }
+                    }
+                    if(has_w) {
+                        continue;
+                    }
+                    const vec3& p1 = P(M_.facets.vertex(f, (lv + 1) % 3));
+                    const vec3& p2 = P(M_.facets.vertex(f, (lv + 2) % 3));
+                    vec3 N1 = cross(p1 - P(v), p2 - P(v));
+                    vec3 N2 = cross(p1 - p, p2 - p);
+                    if(dot(N1, N2) <= 0.0) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * \brief Selects and applies a set of independent collapses.
+         * \param[in] nb_facets_to_remove the number of facets that 
+         *  remain to be removed
+         * \param[in] offset the shift of the blocks boundaries
+         * \return the number of collapsed edges
+         */
+        index_t collapse_pass(index_t nb_facets_to_remove, index_t offset) {
+            incidence_.update(MESH_FACETS);
+
+            // Rank of the remaining vertices in the Hilbert order, so that
+            // the blocks keep the same number of vertices while the mesh
+            // gets coarser.
+            index_t rank = 0;
+            for(index_t v: sorted_) {
+                rank_[v] = rank;
+                rank += index_t(!removed_[v]);
+            }
+
+            vector<EdgeCollapse> edges;
+            compute_edges(edges);
+
+            // Candidates: the cheapest edges with both extremities 
+            // in the same block.
+            vector<index_t> candidates;
+            for(index_t e = 0; e < edges.size(); ++e) {
+                if(
+                    edges[e].cost != Numeric::max_float64() &&
+                    block(edges[e].v, offset) == block(edges[e].w, offset)
+                ) {
+                    candidates.push_back(e);
+                }
+            }
+            auto cheaper = [&](index_t e1, index_t e2) {
+                return edges[e1].cost < edges[e2].cost || (
+                    edges[e1].cost == edges[e2].cost && e1 < e2
+                );
+            };
+            index_t nb_candidates = std::max(
+                index_t(candidates.size() / DECIMATE_CANDIDATES_RATIO),
+                (nb_facets_to_remove + 1) / 2
+            );
+            if(candidates.size() > nb_candidates) {
+                std::nth_element(
+                    candidates.begin(),
+                    candidates.begin() + std::ptrdiff_t(nb_candidates),
+                    candidates.end(),
+                    cheaper
+                );
+                candidates.resize(nb_candidates);
+            }
+            if(candidates.size() == 0) {
+                return 0;
+            }
+
+            // Group the candidates by block, by increasing cost
+            GEO::sort(
+                candidates.begin(), candidates.end(),
+                [&](index_t e1, index_t e2) {
+                    index_t b1 = block(edges[e1].v, offset);
+                    index_t b2 = block(edges[e2].v, offset);
+                    return b1 < b2 || (b1 == b2 && cheaper(e1, e2));
+                }
+            );
+            vector<index_t> block_begin;
+            for(index_t i = 0; i < candidates.size(); ++i) {
+                if(
+                    i == 0 ||
+                    block(edges[candidates[i]].v, offset) != 
+                    block(edges[candidates[i-1]].v, offset)
+                ) {
+                    block_begin.push_back(i);
+                }
+            }
+            block_begin.push_back(candidates.size());
+
+            // Greedy selection of independent collapses in each block
+            vector<Numeric::uint8> selected(candidates.size(), 0);
+            parallel_for(
+                0, block_begin.size() - 1,
+                [&](index_t i) {
+                    vector<index_t> Nv;
+                    vector<index_t> Nw;
+                    double x[MAX_QUADRIC_DIM];
+                    for(index_t j = block_begin[i]; j < block_begin[i+1]; ++j) {
+                        const EdgeCollapse& E = edges[candidates[j]];
+                        index_t b = block(E.v, offset);
+                        if(marked_[E.v] || marked_[E.w]) {
+                            continue;
+                        }
+                        collapse_point(E.v, E.w, x);
+                        if(!collapse_is_valid(E, x, b, offset, Nv, Nw)) {
+                            continue;
+                        }
+                        selected[j] = Numeric::uint8(
+                            nb_edge_facets(Nv, E.w)
+                        );
+                        marked_[E.v] = 1;
+                        marked_[E.w] = 1;
+                        for(index_t u: Nv) {
+                            marked_[u] = 1;
+                        }
+                        for(index_t u: Nw) {
+                            marked_[u] = 1;
+                        }
+                    }
+                }
+            );
+
+            // Keep the cheapest selected collapses, so that the number 
+            // of facets does not go below the target.
+            {
+                vector<index_t> order;
+                for(index_t j = 0; j < candidates.size(); ++j) {
+                    if(selected[j] != 0) {
+                        order.push_back(j);
+                    }
+                }
+                GEO::sort(
+                    order.begin(), order.end(),
+                    [&](index_t j1, index_t j2) {
+                        return cheaper(candidates[j1], candidates[j2]);
+                    }
+                );
+                index_t nb_removed_facets = 0;
+                for(index_t j: order) {
+                    if(nb_removed_facets >= nb_facets_to_remove) {
+                        selected[j] = 0;
+                    }
+                    nb_removed_facets += selected[j];
+                }
+            }
+
+            // Apply the collapses
+            index_t nb_collapses = 0;
+            for(index_t j = 0; j < candidates.size(); ++j) {
+                nb_collapses += index_t(selected[j] != 0);
+            }
+            parallel_for(
+                0, candidates.size(),
+                [&](index_t j) {
+                    if(!selected[j]) {
+                        return;
+                    }
+                    const EdgeCollapse& E = edges[candidates[j]];
+                    double x[MAX_QUADRIC_DIM];
+                    collapse_point(E.v, E.w, x);
+                    for(index_t i = 0; i < dim_; ++i) {
+                        X(E.w)[i] = x[i];
+                    }
+                    double* Qw = Q(E.w);
+                    const double* Qv = Q(E.v);
+                    for(index_t i = 0; i < Q_stride_; ++i) {
+                        Qw[i] += Qv[i];
+                    }
+                    moved_[E.w] = 1;
+                    removed_[E.v] = 1;
+                    remap_[E.v] = E.w;
+                }
+            );
+            vector<index_t> to_delete(M_.facets.nb(), 0);
+            parallel_for(
+                0, M_.facets.nb(),
+                [&](index_t f) {
+                    for(index_t lv = 0; lv < 3; ++lv) {
+                        index_t v = M_.facets.vertex(f, lv);
+                        if(remap_[v] != NO_VERTEX) {
+                            M_.facets.set_vertex(f, lv, remap_[v]);
+                        }
+                    }
+                    index_t v1 = M_.facets.vertex(f, 0);
+                    index_t v2 = M_.facets.vertex(f, 1);
+                    index_t v3 = M_.facets.vertex(f, 2);
+                    if(v1 == v2 || v2 == v3 || v3 == v1) {
+                        to_delete[f] = 1;
+                    }
+                }
+            );
+            parallel_for_slice(
+                0, M_.vertices.nb(),
+                [&](index_t from, index_t to) {
+                    for(index_t v = from; v < to; ++v) {
+                        remap_[v] = NO_VERTEX;
+                        marked_[v] = 0;
+                    }
+                }
+            );
+            M_.facets.delete_elements(to_delete, false);
+            return nb_collapses;
+        }
+
+        /**
+         * \brief Copies the new positions and attributes to the mesh,
+         *  and removes the collapsed vertices.
+         */
+        void end() {
+            index_t nv = M_.vertices.nb();
+            parallel_for(
+                0, nv,
+                [this](index_t v) {
+                    if(!moved_[v]) {
+                        return;
+                    }
+                    const double* x = X(v);
+                    double* p = M_.vertices.point_ptr(v);
+                    p[0] = x[0];
+                    p[1] = x[1];
+                    p[2] = x[2];
+                    if(normal_.is_bound()) {
+                        vec3 N(
+                            x[normal_offset_],
+                            x[normal_offset_ + 1],
+                            x[normal_offset_ + 2]
+                        );
+                        N = normalize(N);
+                        for(index_t c = 0; c < 3; ++c) {
+                            normal_[3 * v + c] = N[c];
+                        }
+                    }
+                    if(tex_coord_.is_bound()) {
+                        for(index_t c = 0; c < 2; ++c) {
+                            tex_coord_[2 * v + c] =
+                                x[tex_coord_offset_ + c] / attribute_scale_;
+                        }
+                    }
+                }
+            );
+            if(normal_.is_bound()) {
+                normal_.unbind();
+            }
+            if(tex_coord_.is_bound()) {
+                tex_coord_.unbind();
+            }
+            incidence_.clear();
+            vector<index_t> to_delete(nv, 0);
+            for(index_t v = 0; v < nv; ++v) {
+                to_delete[v] = removed_[v];
+            }
+            M_.vertices.delete_elements(to_delete, false);
+            M_.facets.connect();
+        }
+
+    private:
+        Mesh& M_;
+        MeshDecimateQuadricMode mode_;
+        double cos_feature_angle_;
+        index_t dim_;
+        index_t Q_stride_;
+        index_t normal_offset_;
+        index_t tex_coord_offset_;
+        double attribute_scale_;
+        Attribute<double> normal_;
+        Attribute<double> tex_coord_;
+        MeshVertexIncidence incidence_;
+
+        /** \brief the points with attributes, dim_ doubles per vertex */
+        vector<double> X_;
+
+        /** \brief the quadrics, Q_stride_ doubles per vertex */
+        vector<double> Q_;
+
+        /** \brief the vertices sorted in Hilbert order */
+        vector<index_t> sorted_;
+
+        /** 
+         * \brief the rank of each vertex in the Hilbert order, among 
+         *  the remaining vertices
+         */
+        vector<index_t> rank_;
+
+        /** \brief the vertices that cannot be moved nor removed */
+        vector<Numeric::uint8> locked_;
+
+        /** \brief the vertices on the border */
+        vector<Numeric::uint8> border_;
+
+        /** \brief the vertices incident to a non-manifold edge */
+        vector<Numeric::uint8> non_manifold_;
+
+        /** \brief the vertices touched by a collapse in the current pass */
+        vector<Numeric::uint8> marked_;
+
+        /** \brief the vertices that need to be copied to the mesh */
+        vector<Numeric::uint8> moved_;
+
+        /** \brief the vertices removed by a collapse */
+        vector<Numeric::uint8> removed_;
+
+        /** \brief the vertex that replaces each removed vertex */
+        vector<index_t> remap_;
+    };
+}
 
 namespace GEO {
 
@@ -172,5 +1296,21 @@ namespace GEO {
             while(remove_degree3_vertices(M, max_dist) != 0) {}
         }
     }
+
+    index_t mesh_decimate_quadric(
+        Mesh& M, index_t nb_facets, MeshDecimateQuadricMode mode,
+        double feature_angle, geo_index_t* vertices_flags
+    ) {
+        Stopwatch W("Decimate");
+        if(!M.facets.are_simplices()) {
+            M.facets.triangulate();
+        }
+        index_t nb_facets_in = M.facets.nb();
+        QuadricDecimation decimation(M, mode, feature_angle, vertices_flags);
+        decimation.decimate(nb_facets);
+        Logger::out("Decimate") << "Facets: " << nb_facets_in 
+                                << " -> " << M.facets.nb() << std::endl;
+        return M.facets.nb();
+    }
 }
 
@@ -92,6 +92,65 @@ namespace GEO {
         MeshDecimateMode mode = MESH_DECIMATE_DEFAULT,
         geo_index_t* vertices_flags = nullptr
     );
+
+    /**
+     * \brief Determines the operating mode of mesh_decimate_quadric().
+     * \details The flags can be combined with the 'bitwise or' (|) 
+     *  operator. MESH_DECIMATE_QUADRIC_DEFAULT fits most uses.
+     */
+    enum MeshDecimateQuadricMode {
+        MESH_DECIMATE_QUADRIC_KEEP_B = 1,   /**< Do not move border vertices */
+        MESH_DECIMATE_QUADRIC_FEATURES = 2, /**< Preserve sharp edges       */
+        MESH_DECIMATE_QUADRIC_NORMALS = 4,  /**< Use "normal" attribute     */
+        MESH_DECIMATE_QUADRIC_TEX_COORDS = 8, /**< Use "tex_coord" attribute */
+        MESH_DECIMATE_QUADRIC_DEFAULT =
+            MESH_DECIMATE_QUADRIC_FEATURES |
+            MESH_DECIMATE_QUADRIC_NORMALS |
+            MESH_DECIMATE_QUADRIC_TEX_COORDS
+            /**< Fits most uses */
+    };
+
+    /**
+     * \brief Decimates a surface mesh by edge collapses driven by
+     *  quadric error metrics.
+     * \details The quadric of each vertex measures the squared distance
+     *  to the planes of the triangles of the original mesh. Borders, and
+     *  sharp edges if MESH_DECIMATE_QUADRIC_FEATURES is set, are preserved
+     *  by additional planes orthogonal to the surface. If the 
+     *  vertices have a "normal" (resp. "tex_coord") attribute and
+     *  MESH_DECIMATE_QUADRIC_NORMALS (resp. TEX_COORDS) is set, then the
+     *  attributes are taken into account by the quadrics and interpolated
+     *  by the collapses. Collapses that would flip a triangle or change
+     *  the topology are rejected.
+     *
+     *  Edges are collapsed by passes of independent collapses, computed in
+     *  parallel: the vertices are partitioned into blocks along the 
+     *  Hilbert order, and each block collapses its edges by increasing
+     *  error, except the ones near its border. The result does not depend
+     *  on the number of threads.
+     * \param[in,out] M the surface mesh to decimate. It is triangulated
+     *  if need be. Facet attributes are kept, vertex attributes of the 
+     *  remaining vertices are kept but not interpolated (except "normal"
+     *  and "tex_coord" as specified by \p mode).
+     * \param[in] nb_facets the target number of facets
+     * \param[in] mode a combination of #MeshDecimateQuadricMode flags.
+     *  Combine them with the 'bitwise or' (|) operator.
+     * \param[in] feature_angle minimum angle (in degrees) between the
+     *  normals of two adjacent facets for their common edge to be
+     *  considered as a sharp edge
+     * \param[in] vertices_flags an array of flags associated with
+     *  each vertex of \p M, or nullptr if unspecified. Memory
+     *  is managed by client code. If \p vertices_flags[v] is
+     *  non-zero, then vertex v is preserved and not moved.
+     * \return the number of facets of the decimated mesh. It may be 
+     *  larger than \p nb_facets if no more edge could be collapsed.
+     */
+    index_t GEOGRAM_API mesh_decimate_quadric(
+        Mesh& M, index_t nb_facets,
+        MeshDecimateQuadricMode mode = MESH_DECIMATE_QUADRIC_DEFAULT,
+        double feature_angle = 45.0,
+        geo_index_t* vertices_flags = nullptr
+    );
 }
 
 #endif
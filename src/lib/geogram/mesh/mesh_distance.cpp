@@ -49,6 +49,7 @@
 #include <geogram/mesh/mesh_sampling.h>
 #include <geogram/basic/process.h>
 #include <geogram/basic/stopwatch.h>
+#include <geogram/basic/geometry_nd.h>
 
 #include <algorithm>
 
@@ -187,6 +188,378 @@ namespace {
                 << std::endl;
         }
     }
+
+    /**
+     * \brief Computes the squared distance between a point and
+     *  a facet.
+     * \param[in] M the mesh
+     * \param[in] p the point
+     * \param[in] f the facet of \p M
+     * \param[out] nearest_point the point of \p f nearest to \p p
+     * \return the squared distance between \p p and \p f
+     */
+    double point_facet_squared_distance(
+        const Mesh& M, const vec3& p, index_t f, vec3& nearest_point
+    ) {
+        double result = Numeric::max_float64();
+        index_t c1 = M.facets.corners_begin(f);
+        vec3 p1(M.vertices.point_ptr(M.facet_corners.vertex(c1)));
+        for(index_t c2 = c1 + 1; c2 + 1 < M.facets.corners_end(f); ++c2) {
+            vec3 p2(M.vertices.point_ptr(M.facet_corners.vertex(c2)));
+            vec3 p3(M.vertices.point_ptr(M.facet_corners.vertex(c2 + 1)));
+            vec3 q;
+            double l1, l2, l3;
+            double d = Geom::point_triangle_squared_distance(
+                p, p1, p2, p3, q, l1, l2, l3
+            );
+            if(d < result) {
+                result = d;
+                nearest_point = q;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief A triangle of the first mesh, obtained by subdividing a 
+     *  facet, used by HausdorffBounds.
+     */
+    struct HausdorffTriangle {
+        /** \brief the vertices */
+        vec3 p[3];
+
+        /** \brief the distances between the vertices and the surface */
+        double d[3];
+
+        /** \brief the facets of the surface nearest to the vertices */
+        index_t f[3];
+
+        /** 
+         * \brief an upper bound of the distance between the points
+         *  of the triangle and the surface 
+         */
+        double upper_bound;
+
+        /**
+         * \brief Gets a lower bound of the distance between the points
+         *  of the triangle and the surface.
+         * \return the largest distance between a vertex of the triangle
+         *  and the surface
+         */
+        double lower_bound() const {
+            return std::max(d[0], std::max(d[1], d[2]));
+        }
+    };
+
+    /**
+     * \brief Computes bounds of the one sided Hausdorff distance
+     *  between two surfaces by recursive subdivision.
+     * \details The bounds of each triangle are computed as follows:
+     *  - the distances at the vertices are a lower bound;
+     *  - for any facet F of the surface, the distance to F is a convex
+     *    function, thus its maximum over a triangle is reached at one of
+     *    its vertices. The distance to the surface is smaller than the 
+     *    distance to F, thus for each facet F nearest to a vertex,
+     *    max_i d(p_i, F) is an upper bound over the triangle;
+     *  - the distance is 1-Lipschitz, thus max_i d(p_i) plus the length
+     *    of the longest edge is also an upper bound.
+     *  Only the triangles that may contain a point farther than the
+     *  current lower bound plus the tolerance are subdivided.
+     */
+    class HausdorffBounds {
+    public:
+        /**
+         * \brief HausdorffBounds constructor.
+         * \param[in] m1 the mesh sampled by the triangles
+         * \param[in] m2 the surface, its facets are reordered
+         */
+        HausdorffBounds(const Mesh& m1, Mesh& m2) :
+            m1_(m1),
+            m2_(m2),
+            AABB_(m2),
+            lower_bound_(0.0),
+            upper_bound_(0.0) {
+        }
+
+        /**
+         * \brief Computes the bounds.
+         * \details The facets of the first mesh are processed by chunks.
+         *  The triangles of a chunk are pushed onto a stack, and refined
+         *  depth-first: the triangles on top of the stack are subdivided
+         *  in parallel, and their children that may still contain a
+         *  point farther than the lower bound plus the tolerance are
+         *  pushed back. Memory usage is thus bounded by
+         *  \p max_nb_triangles, whatever the size of the first mesh.
+         * \param[in] tolerance the requested maximum difference between
+         *  the upper bound and the lower bound
+         * \param[in] max_nb_triangles maximum number of triangles 
+         *  stored at the same time
+         */
+        void compute(double tolerance, index_t max_nb_triangles) {
+            lower_bound_ = 0.0;
+            upper_bound_ = 0.0;
+            if(m1_.facets.nb() == 0) {
+                return;
+            }
+            size_t max_nb = std::max(size_t(max_nb_triangles), size_t(16));
+
+            // Distances at the vertices of m1
+            vector<double> vertex_dist(m1_.vertices.nb(), 0.0);
+            vector<index_t> vertex_facet(m1_.vertices.nb(), NO_FACET);
+            parallel_for(
+                0, m1_.vertices.nb(),
+                [&](index_t v) {
+                    vec3 p(m1_.vertices.point_ptr(v));
+                    vec3 q;
+                    double sq_dist;
+                    vertex_facet[v] = AABB_.nearest_facet(p, q, sq_dist);
+                    vertex_dist[v] = ::sqrt(sq_dist);
+                }
+            );
+
+            size_t nb_triangles = 0;
+            bool saturated = false;
+            vector<HausdorffTriangle> stack;
+            vector<HausdorffTriangle> children;
+            index_t next_facet = 0;
+            while(next_facet < m1_.facets.nb()) {
+
+                // Initial triangles of the next chunk of facets
+                children.clear();
+                while(
+                    next_facet < m1_.facets.nb() &&
+                    4 * size_t(children.size()) < max_nb
+                ) {
+                    index_t f = next_facet;
+                    ++next_facet;
+                    index_t c1 = m1_.facets.corners_begin(f);
+                    for(
+                        index_t c2 = c1 + 1;
+                        c2 + 1 < m1_.facets.corners_end(f); ++c2
+                    ) {
+                        index_t c[3] = { c1, c2, c2 + 1 };
+                        HausdorffTriangle T;
+                        for(index_t i = 0; i < 3; ++i) {
+                            index_t v = m1_.facet_corners.vertex(c[i]);
+                            T.p[i] = vec3(m1_.vertices.point_ptr(v));
+                            T.d[i] = vertex_dist[v];
+                            T.f[i] = vertex_facet[v];
+                        }
+                        T.upper_bound = Numeric::max_float64();
+                        children.push_back(T);
+                    }
+                }
+                parallel_for(
+                    0, children.size(),
+                    [&](index_t t) {
+                        children[t].upper_bound = upper_bound(children[t]);
+                    }
+                );
+                push_active(children, stack, tolerance);
+                nb_triangles += children.size();
+
+                // Depth-first refinement of the chunk
+                while(!stack.empty()) {
+                    // Retire the triangles that no longer need to be
+                    // refined, the lower bound may have grown since
+                    // they were pushed
+                    const HausdorffTriangle& top = stack.back();
+                    if(top.upper_bound <= lower_bound_ + tolerance) {
+                        upper_bound_ = std::max(upper_bound_, top.upper_bound);
+                        stack.pop_back();
+                        continue;
+                    }
+                    // Pop the triangles on top of the stack, such that
+                    // their children fit in max_nb
+                    index_t n = index_t(std::min(
+                        size_t(stack.size()), (max_nb - stack.size()) / 3
+                    ));
+                    if(n == 0) {
+                        // Stack is full, keep the bounds of the
+                        // remaining triangles without refining them
+                        saturated = true;
+                        for(const HausdorffTriangle& T: stack) {
+                            upper_bound_ = std::max(
+                                upper_bound_, T.upper_bound
+                            );
+                        }
+                        stack.clear();
+                        break;
+                    }
+                    index_t first = stack.size() - n;
+                    children.resize(4 * size_t(n));
+                    parallel_for(
+                        0, n,
+                        [&](index_t t) {
+                            subdivide(stack[first + t], &children[4 * t]);
+                        }
+                    );
+                    stack.resize(first);
+                    push_active(children, stack, tolerance);
+                    nb_triangles += children.size();
+                }
+            }
+            upper_bound_ = std::max(upper_bound_, lower_bound_);
+
+            Logger::out("Distance") << "Bounds: [" << lower_bound_ << ", "
+                                    << upper_bound_ << "] after "
+                                    << nb_triangles
+                                    << " triangles" << std::endl;
+            if(saturated) {
+                Logger::warn("Distance")
+                    << "Reached max nb. of triangles, "
+                    << "tolerance may not be reached" << std::endl;
+            }
+        }
+
+        /**
+         * \brief Gets the lower bound.
+         * \return the largest distance between a point of the first mesh
+         *  and the surface found so far
+         */
+        double lower_bound() const {
+            return lower_bound_;
+        }
+
+        /**
+         * \brief Gets the upper bound.
+         * \return an upper bound of the distance between the points of 
+         *  the first mesh and the surface
+         */
+        double upper_bound() const {
+            return upper_bound_;
+        }
+
+    protected:
+        /**
+         * \brief Computes an upper bound of the distance between the
+         *  points of a triangle and the surface.
+         * \param[in] T the triangle
+         * \return the smallest of the bounds obtained from the facets
+         *  nearest to the vertices of \p T, from the Lipschitz 
+         *  continuity of the distance, and from the bound of the 
+         *  triangle that contains \p T
+         */
+        double upper_bound(const HausdorffTriangle& T) const {
+            double result = T.upper_bound;
+            double l = std::max(
+                distance(T.p[0], T.p[1]),
+                std::max(distance(T.p[1], T.p[2]), distance(T.p[2], T.p[0]))
+            );
+            result = std::min(result, T.lower_bound() + l);
+            for(index_t k = 0; k < 3; ++k) {
+                if(
+                    (k > 0 && T.f[k] == T.f[0]) ||
+                    (k > 1 && T.f[k] == T.f[1])
+                ) {
+                    continue;
+                }
+                double d = T.d[k];
+                for(index_t i = 0; i < 3 && d < result; ++i) {
+                    if(i != k) {
+                        vec3 q;
+                        d = std::max(
+                            d, ::sqrt(
+                                point_facet_squared_distance(
+                                    m2_, T.p[i], T.f[k], q
+                                )
+                            )
+                        );
+                    }
+                }
+                result = std::min(result, d);
+            }
+            return result;
+        }
+
+        /**
+         * \brief Updates the bounds with a set of triangles and pushes
+         *  the ones that need to be refined.
+         * \details The lower bound is updated with all the triangles
+         *  first, so that the result does not depend on their order.
+         * \param[in] triangles the triangles
+         * \param[in,out] stack the triangles that may contain a point
+         *  farther than the lower bound plus \p tolerance are pushed 
+         *  onto it
+         * \param[in] tolerance the requested maximum difference between
+         *  the upper bound and the lower bound
+         */
+        void push_active(
+            const vector<HausdorffTriangle>& triangles,
+            vector<HausdorffTriangle>& stack,
+            double tolerance
+        ) {
+            for(const HausdorffTriangle& T: triangles) {
+                lower_bound_ = std::max(lower_bound_, T.lower_bound());
+            }
+            for(const HausdorffTriangle& T: triangles) {
+                if(T.upper_bound <= lower_bound_ + tolerance) {
+                    upper_bound_ = std::max(upper_bound_, T.upper_bound);
+                } else {
+                    stack.push_back(T);
+                }
+            }
+        }
+
+        /**
+         * \brief Computes the distance between a point and the surface.
+         * \param[in] p the point
+         * \param[in,out] f on entry, a facet near \p p, on exit the 
+         *  facet nearest to \p p
+         * \return the distance between \p p and the surface
+         */
+        double distance_to_surface(const vec3& p, index_t& f) const {
+            vec3 q;
+            double sq_dist = point_facet_squared_distance(m2_, p, f, q);
+            AABB_.nearest_facet_with_hint(p, f, q, sq_dist);
+            return ::sqrt(sq_dist);
+        }
+
+        /**
+         * \brief Splits a triangle into four triangles.
+         * \param[in] T the triangle
+         * \param[out] children the four sub-triangles of \p T, with 
+         *  their distances and bounds
+         */
+        void subdivide(
+            const HausdorffTriangle& T, HausdorffTriangle* children
+        ) const {
+            vec3 m[3];
+            double d[3];
+            index_t f[3];
+            for(index_t i = 0; i < 3; ++i) {
+                index_t j = (i + 1) % 3;
+                m[i] = 0.5 * (T.p[i] + T.p[j]);
+                f[i] = T.d[i] < T.d[j] ? T.f[i] : T.f[j];
+                d[i] = distance_to_surface(m[i], f[i]);
+            }
+            // The corner children, then the middle one
+            for(index_t i = 0; i < 3; ++i) {
+                index_t k = (i + 2) % 3;
+                HausdorffTriangle& C = children[i];
+                C.p[0] = T.p[i];  C.d[0] = T.d[i];  C.f[0] = T.f[i];
+                C.p[1] = m[i];    C.d[1] = d[i];    C.f[1] = f[i];
+                C.p[2] = m[k];    C.d[2] = d[k];    C.f[2] = f[k];
+            }
+            HausdorffTriangle& C = children[3];
+            for(index_t i = 0; i < 3; ++i) {
+                C.p[i] = m[i];
+                C.d[i] = d[i];
+                C.f[i] = f[i];
+            }
+            for(index_t i = 0; i < 4; ++i) {
+                children[i].upper_bound = T.upper_bound;
+                children[i].upper_bound = upper_bound(children[i]);
+            }
+        }
+
+    private:
+        const Mesh& m1_;
+        Mesh& m2_;
+        MeshFacetsAABB AABB_;
+        double lower_bound_;
+        double upper_bound_;
+    };
 }
 
 /****************************************************************************/
@@ -269,5 +642,35 @@ namespace GEO {
             mesh_one_sided_Hausdorff_distance(m2, m1, sampling_step)
         );
     }
+
+    bool mesh_one_sided_Hausdorff_distance_bounds(
+        Mesh& m1, Mesh& m2, double tolerance,
+        double& lower_bound, double& upper_bound,
+        index_t max_nb_triangles
+    ) {
+        geo_assert(m2.facets.nb() != 0);
+        HausdorffBounds bounds(m1, m2);
+        bounds.compute(tolerance, max_nb_triangles);
+        lower_bound = bounds.lower_bound();
+        upper_bound = bounds.upper_bound();
+        return (upper_bound - lower_bound <= tolerance);
+    }
+
+    bool mesh_symmetric_Hausdorff_distance_bounds(
+        Mesh& m1, Mesh& m2, double tolerance,
+        double& lower_bound, double& upper_bound,
+        index_t max_nb_triangles
+    ) {
+        double l12, u12, l21, u21;
+        mesh_one_sided_Hausdorff_distance_bounds(
+            m1, m2, tolerance, l12, u12, max_nb_triangles
+        );
+        mesh_one_sided_Hausdorff_distance_bounds(
+            m2, m1, tolerance, l21, u21, max_nb_triangles
+        );
+        lower_bound = std::max(l12, l21);
+        upper_bound = std::max(u12, u21);
+        return (upper_bound - lower_bound <= tolerance);
+    }
 }
 
@@ -47,6 +47,7 @@
 #define GEOGRAM_MESH_MESH_DISTANCE
 
 #include <geogram/basic/common.h>
+#include <geogram/basic/numeric.h>
 
 /**
  * \file mesh_distance.h
@@ -114,6 +115,68 @@ namespace GEO {
     double GEOGRAM_API mesh_symmetric_Hausdorff_distance(
         Mesh& m1, Mesh& m2, double sampling_dist
     );
+
+    /**
+     * \brief Computes a lower bound and an upper bound of the
+     *  single sided Hausdorff distance dH(m1->m2) between
+     *  two surfacic meshes.
+     * \details The facets of \p m1 are recursively subdivided. The 
+     *  distances at the vertices of the sub-triangles give a lower bound,
+     *  and, since the distance to a facet of \p m2 is a convex function,
+     *  the largest distance between the vertices of a sub-triangle and 
+     *  the facets of \p m2 nearest to its vertices gives an upper bound 
+     *  over the sub-triangle. Only the sub-triangles whose upper bound is
+     *  larger than the global lower bound plus \p tolerance are
+     *  subdivided, in parallel. The facets are processed by chunks, and
+     *  each chunk is refined depth-first, so that memory usage does not
+     *  depend on the size of \p m1. The result does not depend on the
+     *  number of threads.
+     *
+     * \remark Only the facets of meshes \p m1 and
+     *  \p m2 are used (line segments and volumetric cells are ignored).
+     *  Note that the order of the mesh facets of \p m2 is changed.
+     *
+     * \param[in] m1 , m2 two surfacic meshes whose distance is computed
+     * \param[in] tolerance the requested maximum difference between the 
+     *  upper bound and the lower bound
+     * \param[out] lower_bound the largest distance between a point of
+     *  \p m1 and \p m2 found by the algorithm
+     * \param[out] upper_bound a guaranteed upper bound of dH(m1->m2)
+     * \param[in] max_nb_triangles maximum number of sub-triangles 
+     *  stored at the same time. When it is reached, the remaining 
+     *  sub-triangles of the current chunk are not subdivided and the
+     *  bounds may be farther apart than \p tolerance.
+     * \retval true if upper_bound - lower_bound <= tolerance
+     * \retval false otherwise
+     */
+    bool GEOGRAM_API mesh_one_sided_Hausdorff_distance_bounds(
+        Mesh& m1, Mesh& m2, double tolerance,
+        double& lower_bound, double& upper_bound,
+        index_t max_nb_triangles = 1u << 24
+    );
+
+    /**
+     * \brief Computes a lower bound and an upper bound of the
+     *  symmetric Hausdorff distance dH(m1<->m2) between
+     *  two surfacic meshes.
+     * \remark Only the facets of meshes \p m1 and
+     *  \p m2 are used (line segments and volumetric cells are ignored).
+     *  Note that the order of the mesh facets are changed.
+     * \param[in] m1 , m2 two surfacic meshes whose distance is computed
+     * \param[in] tolerance the requested maximum difference between the 
+     *  upper bound and the lower bound
+     * \param[out] lower_bound , upper_bound the bounds of dH(m1<->m2)
+     * \param[in] max_nb_triangles maximum number of sub-triangles 
+     *  stored at the same time
+     * \retval true if upper_bound - lower_bound <= tolerance
+     * \retval false otherwise
+     * \see mesh_one_sided_Hausdorff_distance_bounds()
+     */
+    bool GEOGRAM_API mesh_symmetric_Hausdorff_distance_bounds(
+        Mesh& m1, Mesh& m2, double tolerance,
+        double& lower_bound, double& upper_bound,
+        index_t max_nb_triangles = 1u << 24
+    );
 }
 
 #endif
@@ -54,6 +54,30 @@ namespace {
 
     using namespace GEO;
 
+    /**
+     * \brief Gets the bounding box of a mesh, with the coordinates
+     *  read in their storage precision.
+     * \tparam T float in single-precision mode, double otherwise
+     * \param[in] M The mesh
+     * \param[out] xyzmin the lower corner of the bounding box
+     * \param[out] xyzmax the upper corner of the bounding box
+     */
+    template <class T> void get_bbox_typed(
+        const Mesh& M, double* xyzmin, double* xyzmax
+    ) {
+        for(index_t c = 0; c < 3; c++) {
+            xyzmin[c] = Numeric::max_float64();
+            xyzmax[c] = Numeric::min_float64();
+        }
+        for(index_t v: M.vertices) {
+            const T* p = M.vertices.typed_point_ptr<T>(v);
+            for(index_t c = 0; c < 3; c++) {
+                xyzmin[c] = std::min(xyzmin[c], double(p[c]));
+                xyzmax[c] = std::max(xyzmax[c], double(p[c]));
+            }
+        }
+    }
+
     /**
      * \brief Computes a sizing field using local feature size
      * \details The sizing field is stored into the vertex weights
@@ -84,13 +108,13 @@ namespace GEO {
 	    vec3 result(0.0, 0.0, 0.0);
 	    index_t c1 = M.facets.corners_begin(f);
 	    index_t v1 = M.facet_corners.vertex(c1);
-	    const vec3& p1 = mesh_vertex(M, v1);
+	    vec3 p1 = mesh_vertex_promoted(M, v1);
 	    for(index_t c2=c1+1; c2<M.facets.corners_end(f); ++c2) {
 		index_t c3 = M.facets.next_corner_around_facet(f,c2);
 		index_t v2 = M.facet_corners.vertex(c2);
 		index_t v3 = M.facet_corners.vertex(c3);
-		const vec3& p2 = mesh_vertex(M, v2);
-		const vec3& p3 = mesh_vertex(M, v3);
+		vec3 p2 = mesh_vertex_promoted(M, v2);
+		vec3 p3 = mesh_vertex_promoted(M, v3);
 		result += cross(p2 - p1, p3 - p1);
 	    }
 	    return result;
@@ -208,16 +232,10 @@ namespace GEO {
 
     void get_bbox(const Mesh& M, double* xyzmin, double* xyzmax) {
         geo_assert(M.vertices.dimension() >= 3);
-        for(index_t c = 0; c < 3; c++) {
-            xyzmin[c] = Numeric::max_float64();
-            xyzmax[c] = Numeric::min_float64();
-        }
-        for(index_t v: M.vertices) {
-            const double* p = M.vertices.point_ptr(v);
-            for(index_t c = 0; c < 3; c++) {
-                xyzmin[c] = std::min(xyzmin[c], p[c]);
-                xyzmax[c] = std::max(xyzmax[c], p[c]);
-            }
+        if(M.vertices.single_precision()) {
+            get_bbox_typed<float>(M, xyzmin, xyzmax);
+        } else {
+            get_bbox_typed<double>(M, xyzmin, xyzmax);
         }
     }
 
@@ -72,6 +72,43 @@ namespace GEO {
             return *(const vec3*) (M.vertices.point_ptr(v));
         }
 
+        /**
+         * \brief Gets a mesh vertex by its index, promoted to
+         *  double precision.
+         * \details Conversion from float to double is exact, thus
+         *  predicates evaluated on the promoted point give the same
+         *  result as if the mesh was stored in double precision.
+         * \tparam T the storage type of the coordinates, float in
+         *  single-precision mode or double in double-precision mode
+         * \param[in] M the mesh
+         * \param[in] v the index of the vertex
+         * \return a copy of the \p v%th vertex of a mesh
+         * \pre M.vertices.dimension() >= 3
+         */
+        template <class T>
+        inline vec3 mesh_vertex_promoted(const Mesh& M, index_t v) {
+            geo_debug_assert(M.vertices.dimension() >= 3);
+            const T* p = M.vertices.typed_point_ptr<T>(v);
+            return vec3(double(p[0]), double(p[1]), double(p[2]));
+        }
+
+        /**
+         * \brief Gets a mesh vertex by its index, promoted to
+         *  double precision.
+         * \details Works in both single and double precision modes.
+         *  Hot loops should rather dispatch once on
+         *  M.vertices.single_precision() and use the templated version.
+         * \param[in] M the mesh
+         * \param[in] v the index of the vertex
+         * \return a copy of the \p v%th vertex of a mesh
+         * \pre M.vertices.dimension() >= 3
+         */
+        inline vec3 mesh_vertex_promoted(const Mesh& M, index_t v) {
+            return M.vertices.single_precision() ?
+                mesh_vertex_promoted<float>(M, v) :
+                mesh_vertex_promoted<double>(M, v) ;
+        }
+
         /**
          * \brief Gets a mesh vertex by its index.
          * \param[in] M the mesh
@@ -155,24 +192,20 @@ namespace GEO {
         }
 
         /**
-         * \brief Computes the area of a facet.
+         * \brief Computes the area of a facet with the coordinates
+         *  read in their storage precision.
+         * \tparam T float in single-precision mode, double otherwise
          * \param[in] M a const reference to the mesh
          * \param[in] f index of the facet
          * \param[in] dim dimension that will be used to compute the area
          * \return the area of the facet, obtained by considering the
          *  \p dim first coordinates of the vertices only
+         * \pre the facet is not empty
          */
-        inline double mesh_facet_area(const Mesh& M, index_t f, index_t dim=0) {
-            geo_debug_assert(dim <= M.vertices.dimension());
-            if(dim == 0) {
-                dim = M.vertices.dimension();
-            }
+        template <class T>
+        inline double mesh_facet_area(const Mesh& M, index_t f, index_t dim) {
             double result = 0.0;
-            // Check for empty facet, should not happen.
-            if(M.facets.corners_end(f) == M.facets.corners_begin(f)) {
-                return result;
-            }
-            const double* p0 = M.vertices.point_ptr(
+            const T* p0 = M.vertices.typed_point_ptr<T>(
                 M.facet_corners.vertex(M.facets.corners_begin(f))
             );
             for(
@@ -181,13 +214,39 @@ namespace GEO {
             ) {
                 result += GEO::Geom::triangle_area(
                     p0,
-                    M.vertices.point_ptr(M.facet_corners.vertex(i)),
-                    M.vertices.point_ptr(M.facet_corners.vertex(i + 1)),
+                    M.vertices.typed_point_ptr<T>(M.facet_corners.vertex(i)),
+                    M.vertices.typed_point_ptr<T>(
+                        M.facet_corners.vertex(i + 1)
+                    ),
                     coord_index_t(dim)
                 );
             }
             return result;
         }
+
+        /**
+         * \brief Computes the area of a facet.
+         * \param[in] M a const reference to the mesh
+         * \param[in] f index of the facet
+         * \param[in] dim dimension that will be used to compute the area
+         * \return the area of the facet, obtained by considering the
+         *  \p dim first coordinates of the vertices only
+         */
+        inline double mesh_facet_area(const Mesh& M, index_t f, index_t dim=0) {
+            geo_debug_assert(dim <= M.vertices.dimension());
+            if(dim == 0) {
+                dim = M.vertices.dimension();
+            }
+            double result = 0.0;
+            // Check for empty facet, should not happen.
+            if(M.facets.corners_end(f) == M.facets.corners_begin(f)) {
+                return result;
+            }
+            if(M.vertices.single_precision()) {
+                return mesh_facet_area<float>(M, f, dim);
+            }
+            return mesh_facet_area<double>(M, f, dim);
+        }
         
         /**
          * \brief Computes the normal to a mesh facet.
@@ -210,7 +269,9 @@ namespace GEO {
             double count = 0.0;
             for(index_t c = M.facets.corners_begin(f);
                 c < M.facets.corners_end(f); ++c) {
-                result += Geom::mesh_corner_vertex(M, c);
+                result += Geom::mesh_vertex_promoted(
+                    M, M.facet_corners.vertex(c)
+                );
                 count += 1.0;
             }
             return (1.0 / count) * result;
@@ -228,10 +289,10 @@ namespace GEO {
             index_t iv2 = M.cells.vertex(t, 1);
             index_t iv3 = M.cells.vertex(t, 2);
             index_t iv4 = M.cells.vertex(t, 3);
-            const vec3& v1 = Geom::mesh_vertex(M, iv1);
-            const vec3& v2 = Geom::mesh_vertex(M, iv2);
-            const vec3& v3 = Geom::mesh_vertex(M, iv3);
-            const vec3& v4 = Geom::mesh_vertex(M, iv4);
+            vec3 v1 = Geom::mesh_vertex_promoted(M, iv1);
+            vec3 v2 = Geom::mesh_vertex_promoted(M, iv2);
+            vec3 v3 = Geom::mesh_vertex_promoted(M, iv3);
+            vec3 v4 = Geom::mesh_vertex_promoted(M, iv4);
             return 0.25 * (v1 + v2 + v3 + v4);
         }
 
@@ -0,0 +1,328 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/mesh/mesh_incidence.h>
+#include <geogram/basic/process.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Maximum number of slices used to compute an incidence
+     *  table in parallel.
+     * \details Each slice uses a temporary array of size
+     *  nb_vertices, this bounds the required memory.
+     */
+    const index_t MAX_SLICES = 8;
+
+    /**
+     * \brief Minimum number of elements to be processed by a
+     *  slice.
+     */
+    const index_t MIN_SLICE_SIZE = 10000;
+
+    /**
+     * \brief Gives access to the vertices of the edges of a mesh.
+     */
+    class EdgeVertices {
+    public:
+        EdgeVertices(const Mesh& M) : M_(M) {
+        }
+        index_t nb() const {
+            return M_.edges.nb();
+        }
+        index_t corners_begin(index_t e) const {
+            return 2*e;
+        }
+        index_t corners_end(index_t e) const {
+            return 2*e+2;
+        }
+        index_t vertex(index_t c) const {
+            return M_.edges.vertex(c/2, c%2);
+        }
+    private:
+        const Mesh& M_;
+    };
+
+    /**
+     * \brief Gives access to the vertices of the facets of a mesh.
+     */
+    class FacetVertices {
+    public:
+        FacetVertices(const Mesh& M) : M_(M) {
+        }
+        index_t nb() const {
+            return M_.facets.nb();
+        }
+        index_t corners_begin(index_t f) const {
+            return M_.facets.corners_begin(f);
+        }
+        index_t corners_end(index_t f) const {
+            return M_.facets.corners_end(f);
+        }
+        index_t vertex(index_t c) const {
+            return M_.facet_corners.vertex(c);
+        }
+    private:
+        const Mesh& M_;
+    };
+
+    /**
+     * \brief Gives access to the vertices of the cells of a mesh.
+     */
+    class CellVertices {
+    public:
+        CellVertices(const Mesh& M) : M_(M) {
+        }
+        index_t nb() const {
+            return M_.cells.nb();
+        }
+        index_t corners_begin(index_t c) const {
+            return M_.cells.corners_begin(c);
+        }
+        index_t corners_end(index_t c) const {
+            return M_.cells.corners_end(c);
+        }
+        index_t vertex(index_t c) const {
+            return M_.cell_corners.vertex(c);
+        }
+    private:
+        const Mesh& M_;
+    };
+
+    /**
+     * \brief Computes a vertex to elements incidence table in
+     *  compressed sparse row format.
+     * \details The elements are split into contiguous slices, processed
+     *  in parallel. Each slice counts the number of incident elements
+     *  per vertex, then prefix sums give the position of each
+     *  (vertex, slice) pair in the table, so that the lists are filled
+     *  in parallel and are sorted by element index.
+     * \param[in] nb_vertices the number of vertices
+     * \param[in] E gives access to the vertices of the elements
+     * \param[out] ptr the nb_vertices+1 offsets in \p elts
+     * \param[out] elts the concatenated lists of incident elements
+     * \tparam ELEMENTS one of EdgeVertices, FacetVertices, CellVertices
+     */
+    template <class ELEMENTS> void compute_incidence(
+        index_t nb_vertices, const ELEMENTS& E,
+        vector<index_t>& ptr, vector<index_t>& elts
+    ) {
+        index_t nb_elements = E.nb();
+        index_t nb_slices = std::min(
+            MAX_SLICES, Process::maximum_concurrent_threads()
+        );
+        nb_slices = std::max(
+            index_t(1), std::min(nb_slices, nb_elements / MIN_SLICE_SIZE)
+        );
+
+        auto slice_begin = [&](index_t s)->index_t {
+            return index_t(
+                Numeric::uint64(nb_elements) * s / nb_slices
+            );
+        };
+
+        // Step 1: count incident elements per (slice, vertex)
+        vector<index_t> cursor(size_t(nb_slices)*nb_vertices, 0);
+        parallel_for(
+            0, nb_slices,
+            [&](index_t s) {
+                index_t* count = cursor.data() + size_t(s)*nb_vertices;
+                for(index_t e=slice_begin(s); e<slice_begin(s+1); ++e) {
+                    for(
+                        index_t c=E.corners_begin(e); c<E.corners_end(e); ++c
+                    ) {
+                        index_t v = E.vertex(c);
+                        if(v < nb_vertices) {
+                            ++count[v];
+                        }
+                    }
+                }
+            }
+        );
+
+        // Step 2: prefix sums, cursor[s][v] becomes the position where
+        // slice s writes the next element incident to v.
+        ptr.assign(nb_vertices+1, 0);
+        parallel_for_slice(
+            0, nb_vertices,
+            [&](index_t from, index_t to) {
+                for(index_t v=from; v<to; ++v) {
+                    index_t nb = 0;
+                    for(index_t s=0; s<nb_slices; ++s) {
+                        nb += cursor.data()[size_t(s)*nb_vertices+v];
+                    }
+                    ptr[v+1] = nb;
+                }
+            }
+        );
+        for(index_t v=0; v<nb_vertices; ++v) {
+            ptr[v+1] += ptr[v];
+        }
+        parallel_for_slice(
+            0, nb_vertices,
+            [&](index_t from, index_t to) {
+                for(index_t v=from; v<to; ++v) {
+                    index_t pos = ptr[v];
+                    for(index_t s=0; s<nb_slices; ++s) {
+                        index_t& cur = cursor.data()[size_t(s)*nb_vertices+v];
+                        index_t nb = cur;
+                        cur = pos;
+                        pos += nb;
+                    }
+                }
+            }
+        );
+
+        // Step 3: fill the lists
+        elts.resize(ptr[nb_vertices]);
+        parallel_for(
+            0, nb_slices,
+            [&](index_t s) {
+                index_t* pos = cursor.data() + size_t(s)*nb_vertices;
+                for(index_t e=slice_begin(s); e<slice_begin(s+1); ++e) {
+                    for(
+                        index_t c=E.corners_begin(e); c<E.corners_end(e); ++c
+                    ) {
+                        index_t v = E.vertex(c);
+                        if(v < nb_vertices) {
+                            elts[pos[v]] = e;
+                            ++pos[v];
+                        }
+                    }
+                }
+            }
+        );
+    }
+}
+
+namespace GEO {
+
+    MeshVertexIncidence::MeshVertexIncidence(const Mesh& M) : mesh_(M) {
+    }
+
+    void MeshVertexIncidence::update(MeshElementsFlags what) {
+        index_t nv = mesh_.vertices.nb();
+        if(
+            (what & MESH_EDGES) != 0 &&
+            !table_is_up_to_date(edges_, mesh_.edges, mesh_.edges)
+        ) {
+            compute_incidence(
+                nv, EdgeVertices(mesh_), edges_.ptr, edges_.elts
+            );
+            record_timestamps(edges_, mesh_.edges, mesh_.edges);
+        }
+        if(
+            (what & MESH_FACETS) != 0 &&
+            !table_is_up_to_date(facets_, mesh_.facets, mesh_.facet_corners)
+        ) {
+            compute_incidence(
+                nv, FacetVertices(mesh_), facets_.ptr, facets_.elts
+            );
+            record_timestamps(facets_, mesh_.facets, mesh_.facet_corners);
+        }
+        if(
+            (what & MESH_CELLS) != 0 &&
+            !table_is_up_to_date(cells_, mesh_.cells, mesh_.cell_corners)
+        ) {
+            compute_incidence(
+                nv, CellVertices(mesh_), cells_.ptr, cells_.elts
+            );
+            record_timestamps(cells_, mesh_.cells, mesh_.cell_corners);
+        }
+    }
+
+    bool MeshVertexIncidence::is_up_to_date(MeshElementsFlags what) const {
+        if(
+            (what & MESH_EDGES) != 0 &&
+            !table_is_up_to_date(edges_, mesh_.edges, mesh_.edges)
+        ) {
+            return false;
+        }
+        if(
+            (what & MESH_FACETS) != 0 &&
+            !table_is_up_to_date(facets_, mesh_.facets, mesh_.facet_corners)
+        ) {
+            return false;
+        }
+        if(
+            (what & MESH_CELLS) != 0 &&
+            !table_is_up_to_date(cells_, mesh_.cells, mesh_.cell_corners)
+        ) {
+            return false;
+        }
+        return true;
+    }
+
+    void MeshVertexIncidence::clear() {
+        edges_.clear();
+        facets_.clear();
+        cells_.clear();
+    }
+
+    bool MeshVertexIncidence::table_is_up_to_date(
+        const Table& T,
+        const MeshSubElementsStore& elements,
+        const MeshSubElementsStore& corners
+    ) const {
+        return
+            T.valid &&
+            T.timestamps[0] == mesh_.vertices.timestamp() &&
+            T.timestamps[1] == elements.timestamp() &&
+            T.timestamps[2] == corners.timestamp();
+    }
+
+    void MeshVertexIncidence::record_timestamps(
+        Table& T,
+        const MeshSubElementsStore& elements,
+        const MeshSubElementsStore& corners
+    ) {
+        T.timestamps[0] = mesh_.vertices.timestamp();
+        T.timestamps[1] = elements.timestamp();
+        T.timestamps[2] = corners.timestamp();
+        T.valid = true;
+    }
+}
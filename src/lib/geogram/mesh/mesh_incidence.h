@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+
+#ifndef GEOGRAM_MESH_MESH_INCIDENCE
+#define GEOGRAM_MESH_MESH_INCIDENCE
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/range.h>
+#include <geogram/mesh/mesh.h>
+
+/**
+ * \file geogram/mesh/mesh_incidence.h
+ * \brief Cached vertex to edges / facets / cells incidence.
+ */
+
+namespace GEO {
+
+    /**
+     * \brief Stores for each vertex of a mesh the list of incident
+     *  edges, facets and cells.
+     * \details The lists are stored in compressed sparse row format,
+     *  and are computed in parallel. Each list is sorted by element
+     *  index, an element appears once per corner incident to the vertex.
+     *  A MeshVertexIncidence is typically obtained through
+     *  Mesh::vertex_incidence(), that maintains it up to date:
+     * \code
+     *   const MeshVertexIncidence& I = M.vertex_incidence(MESH_FACETS);
+     *   for(index_t v: M.vertices) {
+     *      for(index_t f: I.facets(v)) {
+     *         ...
+     *      }
+     *   }
+     * \endcode
+     */
+    class GEOGRAM_API MeshVertexIncidence {
+    public:
+        /**
+         * \brief MeshVertexIncidence constructor.
+         * \details Does not compute anything, computation is done
+         *  by update().
+         * \param[in] M a const reference to the mesh
+         */
+        MeshVertexIncidence(const Mesh& M);
+
+        /**
+         * \brief Computes the incidence tables that are not up to date.
+         * \param[in] what a combination of MESH_EDGES, MESH_FACETS and
+         *  MESH_CELLS
+         */
+        void update(MeshElementsFlags what);
+
+        /**
+         * \brief Tests whether incidence tables are up to date.
+         * \param[in] what a combination of MESH_EDGES, MESH_FACETS and
+         *  MESH_CELLS
+         * \retval true if all the tables in \p what were computed
+         *  and the mesh was not modified since then
+         * \retval false otherwise
+         */
+        bool is_up_to_date(MeshElementsFlags what) const;
+
+        /**
+         * \brief Discards all the incidence tables.
+         */
+        void clear();
+
+        /**
+         * \brief Gets the edges incident to a vertex.
+         * \param[in] v a vertex
+         * \return a range with the indices of the edges incident to \p v
+         * \pre is_up_to_date(MESH_EDGES)
+         */
+        range<const index_t*> edges(index_t v) const {
+            return edges_.elements(v);
+        }
+
+        /**
+         * \brief Gets the facets incident to a vertex.
+         * \param[in] v a vertex
+         * \return a range with the indices of the facets incident to \p v
+         * \pre is_up_to_date(MESH_FACETS)
+         */
+        range<const index_t*> facets(index_t v) const {
+            return facets_.elements(v);
+        }
+
+        /**
+         * \brief Gets the cells incident to a vertex.
+         * \param[in] v a vertex
+         * \return a range with the indices of the cells incident to \p v
+         * \pre is_up_to_date(MESH_CELLS)
+         */
+        range<const index_t*> cells(index_t v) const {
+            return cells_.elements(v);
+        }
+
+        /**
+         * \brief Gets the number of edges incident to a vertex.
+         * \param[in] v a vertex
+         * \return the number of edges incident to \p v
+         * \pre is_up_to_date(MESH_EDGES)
+         */
+        index_t nb_edges(index_t v) const {
+            return edges_.nb(v);
+        }
+
+        /**
+         * \brief Gets the number of facet corners incident to a vertex.
+         * \param[in] v a vertex
+         * \return the number of facet corners incident to \p v
+         * \pre is_up_to_date(MESH_FACETS)
+         */
+        index_t nb_facets(index_t v) const {
+            return facets_.nb(v);
+        }
+
+        /**
+         * \brief Gets the number of cell corners incident to a vertex.
+         * \param[in] v a vertex
+         * \return the number of cell corners incident to \p v
+         * \pre is_up_to_date(MESH_CELLS)
+         */
+        index_t nb_cells(index_t v) const {
+            return cells_.nb(v);
+        }
+
+    protected:
+
+        /**
+         * \brief An incidence table, in compressed sparse row format.
+         */
+        struct Table {
+
+            /**
+             * \brief Table constructor.
+             */
+            Table() : valid(false) {
+                timestamps[0] = timestamps[1] = timestamps[2] = 0;
+            }
+
+            /**
+             * \brief Gets the number of elements incident to a vertex.
+             * \param[in] v a vertex
+             * \return the number of elements incident to \p v
+             */
+            index_t nb(index_t v) const {
+                geo_debug_assert(valid);
+                geo_debug_assert(v+1 < ptr.size());
+                return ptr[v+1] - ptr[v];
+            }
+
+            /**
+             * \brief Gets the elements incident to a vertex.
+             * \param[in] v a vertex
+             * \return a range with the elements incident to \p v
+             */
+            range<const index_t*> elements(index_t v) const {
+                geo_debug_assert(valid);
+                geo_debug_assert(v+1 < ptr.size());
+                const index_t* base = elts.data();
+                return range<const index_t*>(base+ptr[v], base+ptr[v+1]);
+            }
+
+            /**
+             * \brief Discards the table.
+             */
+            void clear() {
+                ptr.clear();
+                elts.clear();
+                valid = false;
+            }
+
+            vector<index_t> ptr;
+            vector<index_t> elts;
+            Numeric::uint64 timestamps[3];
+            bool valid;
+        };
+
+        /**
+         * \brief Tests whether a table is up to date.
+         * \param[in] T the table
+         * \param[in] elements the elements store
+         * \param[in] corners the corners store (or the elements store
+         *  for edges)
+         * \retval true if \p T was computed and the mesh was not modified
+         *  since then
+         * \retval false otherwise
+         */
+        bool table_is_up_to_date(
+            const Table& T,
+            const MeshSubElementsStore& elements,
+            const MeshSubElementsStore& corners
+        ) const;
+
+        /**
+         * \brief Records the timestamps of the mesh in a table.
+         * \param[out] T the table
+         * \param[in] elements the elements store
+         * \param[in] corners the corners store (or the elements store
+         *  for edges)
+         */
+        void record_timestamps(
+            Table& T,
+            const MeshSubElementsStore& elements,
+            const MeshSubElementsStore& corners
+        );
+
+    private:
+        const Mesh& mesh_;
+        Table edges_;
+        Table facets_;
+        Table cells_;
+    };
+}
+
+#endif
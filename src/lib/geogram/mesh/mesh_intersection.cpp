@@ -54,6 +54,7 @@
 #include <geogram/mesh/mesh_preprocessing.h>
 #include <geogram/mesh/triangle_intersection.h>
 #include <geogram/basic/logger.h>
+#include <geogram/basic/process.h>
 
 namespace {
 
@@ -108,49 +109,123 @@ namespace {
     }
 
     /**
-     * \brief Action class for storing intersections when traversing
-     *  a AABBTree.
+     * \brief Action class for storing the intersections of a given facet
+     *  when traversing a AABBTree.
+     * \details Only the facets with an index larger than the given facet
+     *  are tested, so that each pair of facets is tested once when all
+     *  the facets are traversed.
      */
-    class StoreIntersections {
+    class StoreFacetIntersections {
     public:
         /**
-         * \brief Constructs the StoreIntersections
+         * \brief Constructs the StoreFacetIntersections
          * \param[in] M the mesh
-         * \param[out] has_isect the flag that indicates for each facet
-         *  whether it has intersections
+         * \param[in] f1 the facet
+         * \param[out] isect the facets that have an intersection. Each
+         *  detected intersection appends \p f1 and the intersected facet
+         *  to it.
+         * \param[in] sym storage for the symbolic representation of 
+         *  the intersections, reused between calls to avoid reallocations.
          */
-        StoreIntersections(
-            const Mesh& M, vector<index_t>& has_isect
+        StoreFacetIntersections(
+            const Mesh& M, index_t f1, 
+            vector<index_t>& isect, vector<TriangleIsect>& sym
         ) :
             M_(M),
-            has_intersection_(has_isect) {
-            has_intersection_.assign(M_.facets.nb(), 0);
+            f1_(f1),
+            isect_(isect),
+            sym_(sym) {
         }
 
         /**
-         * \brief Determines the intersections between two facets
+         * \brief Determines the intersections between the two facets
          * \details It is a callback for AABBTree traversal
-         * \param[in] f1 index of the first facet
          * \param[in] f2 index of the second facet
          */
-        void operator() (index_t f1, index_t f2) {
+        void operator() (index_t f2) {
             // TODO: if facets are adjacents, test for
             // coplanarity.
             if(
-                !facets_are_adjacent(M_, f1, f2) &&
-                f1 != f2 && triangles_intersect(M_, f1, f2, sym_)
+                f2 > f1_ &&
+                !facets_are_adjacent(M_, f1_, f2) &&
+                triangles_intersect(M_, f1_, f2, sym_)
             ) {
-                has_intersection_[f1] = 1;
-                has_intersection_[f2] = 1;
+                isect_.push_back(f1_);
+                isect_.push_back(f2);
             }
         }
 
     private:
         const Mesh& M_;
-        vector<index_t>& has_intersection_;
-        vector<TriangleIsect> sym_;
+        index_t f1_;
+        vector<index_t>& isect_;
+        vector<TriangleIsect>& sym_;
     };
 
+    /**
+     * \brief Finds the facets that have an intersection.
+     * \details Candidate pairs are generated and tested in parallel. 
+     *  Each batch of facets stores its intersections in its own list,
+     *  the lists are then merged in batch order, so that the result
+     *  does not depend on the number of threads.
+     * \param[in] M the mesh
+     * \param[in] AABB the facets AABB of \p M
+     * \param[out] has_intersection has_intersection[f] is set to 1 if
+     *  facet f has an intersection, 0 otherwise
+     */
+    void find_intersecting_facets(
+        const Mesh& M, const MeshFacetsAABB& AABB,
+        vector<index_t>& has_intersection
+    ) {
+        has_intersection.assign(M.facets.nb(), 0);
+
+        // Small batches, interleaved between the threads, so that the 
+        // (spatially clustered) intersections are balanced.
+        const index_t batch_size = 1024;
+        index_t nb_batches = (M.facets.nb() + batch_size - 1) / batch_size;
+        vector< vector<index_t> > batch_isect(nb_batches);
+        
+        parallel_for(
+            0, nb_batches,
+            [&M, &AABB, &batch_isect, batch_size](index_t batch) {
+                vector<TriangleIsect> sym;
+                index_t b = batch * batch_size;
+                index_t e = std::min(b + batch_size, M.facets.nb());
+                for(index_t f1 = b; f1 < e; ++f1) {
+                    Box box;
+                    index_t c = M.facets.corners_begin(f1);
+                    const double* p = M.vertices.point_ptr(
+                        M.facet_corners.vertex(c)
+                    );
+                    for(coord_index_t coord = 0; coord < 3; ++coord) {
+                        box.xyz_min[coord] = p[coord];
+                        box.xyz_max[coord] = p[coord];
+                    }
+                    for(++c; c < M.facets.corners_end(f1); ++c) {
+                        p = M.vertices.point_ptr(M.facet_corners.vertex(c));
+                        for(coord_index_t coord = 0; coord < 3; ++coord) {
+                            box.xyz_min[coord] =
+                                std::min(box.xyz_min[coord], p[coord]);
+                            box.xyz_max[coord] =
+                                std::max(box.xyz_max[coord], p[coord]);
+                        }
+                    }
+                    StoreFacetIntersections action(
+                        M, f1, batch_isect[batch], sym
+                    );
+                    AABB.compute_bbox_facet_bbox_intersections(box, action);
+                }
+            },
+            1, true
+        );
+        
+        for(index_t batch = 0; batch < nb_batches; ++batch) {
+            for(index_t f: batch_isect[batch]) {
+                has_intersection[f] = 1;
+            }
+        }
+    }
+
     /**
      * \brief Deletes the intersecting facets from a mesh
      * \param[in] M the mesh
@@ -163,9 +238,8 @@ namespace {
         mesh_repair(M, MESH_REPAIR_DEFAULT);  // it repairs and triangulates.
 
         vector<index_t> has_intersection;
-        StoreIntersections action(M, has_intersection);
         MeshFacetsAABB AABB(M);
-        AABB.compute_facet_bbox_intersections(action);
+        find_intersecting_facets(M, AABB, has_intersection);
 
         for(index_t i = 1; i <= nb_neigh; i++) {
             for(index_t f: M.facets) {
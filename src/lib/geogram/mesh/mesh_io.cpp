@@ -3406,6 +3406,9 @@ namespace GEO {
                     filename,
                     index_t(CmdLine::get_arg_int("sys:compression_level"))
                 );
+                out.set_attribute_codecs(
+                    CmdLine::get_arg_bool("sys:geofile_codecs")
+                );
                 result = save(M, out, ioflags, true);
             }  catch(const GeoFileException& exc) {
                 Logger::err("I/O") << exc.what() << std::endl;
@@ -3543,6 +3546,65 @@ namespace GEO {
             } 
         }
 
+        /**
+         * \brief Reads an attribute of indices from a geogram file.
+         * \details Indices may have been stored with 32 bits or
+         *  with 64 bits (if the file was written by geogram compiled
+         *  with GEOGRAM_WITH_GARGANTUA). They are converted to index_t.
+         * \param[in] in a reference to the InputGeoFile
+         * \param[out] addr where to store the indices
+         */
+        void read_index_attribute(InputGeoFile& in, index_t* addr) {
+            size_t element_size = in.current_attribute().element_size;
+            if(element_size == sizeof(index_t)) {
+                in.read_attribute(addr);
+                return;
+            }
+            index_t nb = in.current_attribute_set().nb_items *
+                in.current_attribute().dimension;
+            // In ASCII files, indices are parsed directly as index_t,
+            // only the 32-bit NO_INDEX value needs to be converted.
+            if(in.is_ascii()) {
+                in.read_attribute(addr);
+                if(element_size == sizeof(Numeric::uint32)) {
+                    for(index_t i=0; i<nb; ++i) {
+                        if(addr[i] == index_t(Numeric::uint32(-1))) {
+                            addr[i] = index_t(-1);
+                        }
+                    }
+                }
+                return;
+            }
+            if(element_size == sizeof(Numeric::uint32)) {
+                vector<Numeric::uint32> indices(nb);
+                in.read_attribute(indices.data());
+                for(index_t i=0; i<nb; ++i) {
+                    addr[i] = (indices[i] == Numeric::uint32(-1)) ?
+                        index_t(-1) : index_t(indices[i]);
+                }
+            } else if(element_size == sizeof(Numeric::uint64)) {
+                vector<Numeric::uint64> indices(nb);
+                in.read_attribute(indices.data());
+                for(index_t i=0; i<nb; ++i) {
+                    if(indices[i] == Numeric::uint64(-1)) {
+                        addr[i] = index_t(-1);
+                    } else if(indices[i] >= Numeric::uint64(index_t(-1))) {
+                        throw GeoFileException(
+                            "Index does not fit in 32 bits, "
+                            "recompile geogram with GEOGRAM_WITH_GARGANTUA"
+                        );
+                    } else {
+                        addr[i] = index_t(indices[i]);
+                    }
+                }
+            } else {
+                throw GeoFileException(
+                    "Invalid index size in attribute " +
+                    in.current_attribute().name
+                );
+            }
+        }
+
         /**
          * \brief Reads an internal attribute from a geogram file and
          *  stores it in a mesh.
@@ -3573,24 +3635,26 @@ namespace GEO {
             if(name == "GEO::Mesh::edges::edge_vertex") {
                 if(ioflags.has_element(MESH_EDGES)) {
                     M.edges.edge_vertex_.resize(M.edges.nb()*2);
-                    in.read_attribute(M.edges.edge_vertex_.data());
+                    read_index_attribute(in, M.edges.edge_vertex_.data());
                 }
             } else if(name == "GEO::Mesh::facets::facet_ptr") {
                 if(ioflags.has_element(MESH_FACETS)) {
                     M.facets.is_simplicial_ = false;
                     M.facets.facet_ptr_.resize(M.facets.nb()+1);
-                    in.read_attribute(M.facets.facet_ptr_.data());
+                    read_index_attribute(in, M.facets.facet_ptr_.data());
                 } 
             } else if(name == "GEO::Mesh::facet_corners::corner_vertex") {
                 if(ioflags.has_element(MESH_FACETS)) {
-                    in.read_attribute(M.facet_corners.corner_vertex_.data());
+                    read_index_attribute(
+                        in, M.facet_corners.corner_vertex_.data()
+                    );
                 } 
             } else if(
                 name == "GEO::Mesh::facet_corners::corner_adjacent_facet"
             ) {
                 if(ioflags.has_element(MESH_FACETS)) {
-                    in.read_attribute(
-                        M.facet_corners.corner_adjacent_facet_.data()
+                    read_index_attribute(
+                        in, M.facet_corners.corner_adjacent_facet_.data()
                     );
                 } 
             } else if(name == "GEO::Mesh::cells::cell_type") {
@@ -3603,15 +3667,19 @@ namespace GEO {
                 if(ioflags.has_element(MESH_CELLS)) {
                     M.cells.is_simplicial_ = false;
                     M.cells.cell_ptr_.resize(M.cells.nb()+1);
-                    in.read_attribute(M.cells.cell_ptr_.data());
+                    read_index_attribute(in, M.cells.cell_ptr_.data());
                 } 
             } else if(name == "GEO::Mesh::cell_corners::corner_vertex") {
                 if(ioflags.has_element(MESH_CELLS)) {
-                    in.read_attribute(M.cell_corners.corner_vertex_.data());
+                    read_index_attribute(
+                        in, M.cell_corners.corner_vertex_.data()
+                    );
                 } 
             } else if(name == "GEO::Mesh::cell_facets::adjacent_cell") {
                 if(ioflags.has_element(MESH_CELLS)) {
-                    in.read_attribute(M.cell_facets.adjacent_cell_.data());
+                    read_index_attribute(
+                        in, M.cell_facets.adjacent_cell_.data()
+                    );
                 } 
             } 
         }
@@ -3678,13 +3746,24 @@ namespace GEO {
                           store->element_typeid_name()
                       );
 
+                    // Cold attributes are decompressed into a temporary
+                    // buffer, so that they stay cold.
+                    std::vector<Numeric::uint8> cold_data;
+                    const void* data = nullptr;
+                    if(store->is_cold()) {
+                        store->copy_data(cold_data);
+                        data = cold_data.data();
+                    } else {
+                        data = store->data();
+                    }
+
                     out.write_attribute(
                         attribute_set_name,
                         attribute_names[i],
                         element_type,
                         store->element_size(),
                         store->dimension(),
-                        store->data()
+                        data
                     );
                 } else {
                     Logger::warn("I/O")
@@ -46,8 +46,7 @@
 #include <geogram/mesh/mesh_partition.h>
 #include <geogram/mesh/mesh.h>
 #include <geogram/mesh/mesh_reorder.h>
-#include <geogram/basic/permutation.h>
-#include <stack>
+#include <geogram/mesh/mesh_topology.h>
 
 namespace {
 
@@ -106,6 +105,38 @@ namespace {
         }
     }
 
+    /**
+     * \brief Computes the permutation that makes the elements of each
+     *  connected component contiguous.
+     * \details Components keep their order, and the elements of each
+     *  component keep their relative order.
+     * \param[in] component , nb_components the connected components,
+     *  as computed by get_connected_components()
+     * \param[out] new_index the permutation, in the format expected by
+     *  permute_elements()
+     * \param[out] ptr the element pointers of the components are
+     *  appended to \p ptr
+     */
+    void sort_by_component(
+        const vector<index_t>& component, index_t nb_components,
+        vector<index_t>& new_index, vector<index_t>& ptr
+    ) {
+        vector<index_t> comp_ptr(nb_components + 1, 0);
+        for(index_t i=0; i<component.size(); ++i) {
+            ++comp_ptr[component[i]+1];
+        }
+        for(index_t c=0; c<nb_components; ++c) {
+            comp_ptr[c+1] += comp_ptr[c];
+        }
+        for(index_t c=0; c<=nb_components; ++c) {
+            ptr.push_back(comp_ptr[c]);
+        }
+        new_index.resize(component.size());
+        for(index_t i=0; i<component.size(); ++i) {
+            new_index[comp_ptr[component[i]]++] = i;
+        }
+    }
+
     /**
      * \brief Partitions a surface into its connected components.
      * \param[in,out] M the mesh to be partitioned. Its facets are
@@ -118,34 +149,10 @@ namespace {
         Mesh& M,
         vector<index_t>& facet_ptr
     ) {
-        const index_t UNVISITED = index_t(-1);
-
-        vector<index_t> new_index(M.facets.nb(), UNVISITED);
-        std::stack<index_t> S;
-        index_t new_cur_index = 0;
-        for(index_t f: M.facets) {
-            if(new_index[f] == UNVISITED) {
-                facet_ptr.push_back(new_cur_index);
-                new_index[f] = new_cur_index;
-                new_cur_index++;
-                S.push(f);
-            }
-            while(!S.empty()) {
-                index_t ftop = S.top();
-                S.pop();
-                for(index_t c: M.facets.corners(ftop)) {
-                    index_t g = M.facet_corners.adjacent_facet(c);
-                    if(g != NO_FACET && new_index[g] == UNVISITED) {
-                        new_index[g] = new_cur_index;
-                        new_cur_index++;
-                        S.push(index_t(g));
-                    }
-                }
-            }
-        }
-        geo_assert(new_cur_index == M.facets.nb());
-        facet_ptr.push_back(new_cur_index);
-        Permutation::invert(new_index);
+        vector<index_t> component;
+        index_t nb_components = get_connected_components(M, component);
+        vector<index_t> new_index;
+        sort_by_component(component, nb_components, new_index, facet_ptr);
         M.facets.permute_elements(new_index);
     }
 
@@ -161,34 +168,10 @@ namespace {
         Mesh& M,
         vector<index_t>& tet_ptr
     ) {
-        const index_t UNVISITED = index_t(-1);
-
-        vector<index_t> new_index(M.cells.nb(), UNVISITED);
-        std::stack<index_t> S;
-        index_t new_cur_index = 0;
-        for(index_t t: M.cells) {
-            if(new_index[t] == UNVISITED) {
-                tet_ptr.push_back(new_cur_index);
-                new_index[t] = new_cur_index;
-                new_cur_index++;
-                S.push(t);
-            }
-            while(!S.empty()) {
-                index_t t1 = S.top();
-                S.pop();
-                for(index_t lf = 0; lf < 4; lf++) {
-                    index_t t2 = M.cells.adjacent(t1, lf);
-                    if(t2 != NO_CELL && new_index[t2] == UNVISITED) {
-                        new_index[t2] = new_cur_index;
-                        new_cur_index++;
-                        S.push(index_t(t2));
-                    }
-                }
-            }
-        }
-        geo_assert(new_cur_index == M.cells.nb());
-        tet_ptr.push_back(new_cur_index);
-        Permutation::invert(new_index);
+        vector<index_t> component;
+        index_t nb_components = get_cell_connected_components(M, component);
+        vector<index_t> new_index;
+        sort_by_component(component, nb_components, new_index, tet_ptr);
         M.cells.permute_elements(new_index);
     }
 }
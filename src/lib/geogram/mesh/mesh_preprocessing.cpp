@@ -140,10 +140,17 @@ namespace GEO {
         index_t nb_components = get_connected_components(M, component);
         vector<double> comp_area(nb_components, 0.0);
         vector<index_t> comp_facets(nb_components, 0);
-        for(index_t f: M.facets) {
-            comp_area[component[f]] += Geom::mesh_facet_area(M, f, 3);
-            ++comp_facets[component[f]];
-        }
+        parallel_for_each_component(
+            component, nb_components,
+            [&](index_t comp, range<const index_t*> facets) {
+                double area = 0.0;
+                for(index_t f: facets) {
+                    area += Geom::mesh_facet_area(M, f, 3);
+                }
+                comp_area[comp] = area;
+                comp_facets[comp] = index_t(facets.end() - facets.begin());
+            }
+        );
 
         Logger::out("Components")
             << "Nb connected components=" << comp_area.size() << std::endl;
@@ -185,15 +192,20 @@ namespace GEO {
     void orient_normals(Mesh& M) {
         vector<index_t> component;
         index_t nb_components = get_connected_components(M, component);
-        vector<double> comp_signed_volume(nb_components, 0.0);
-        for(index_t f: M.facets) {
-            comp_signed_volume[component[f]] += signed_volume(M, f);
-        }
-        for(index_t f: M.facets) {
-            if(comp_signed_volume[component[f]] < 0.0) {
-                M.facets.flip(f);
+        parallel_for_each_component(
+            component, nb_components,
+            [&M](index_t, range<const index_t*> facets) {
+                double comp_signed_volume = 0.0;
+                for(index_t f: facets) {
+                    comp_signed_volume += signed_volume(M, f);
+                }
+                if(comp_signed_volume < 0.0) {
+                    for(index_t f: facets) {
+                        M.facets.flip(f);
+                    }
+                }
             }
-        }
+        );
     }
 
     void invert_normals(Mesh& M) {
@@ -52,11 +52,191 @@
 #include <geogram/mesh/mesh_preprocessing.h>
 #include <geogram/mesh/mesh_io.h>
 #include <geogram/voronoi/CVT.h>
+#include <geogram/voronoi/RVD.h>
+#include <geogram/delaunay/delaunay.h>
 #include <geogram/basic/command_line.h>
 #include <geogram/basic/stopwatch.h>
 #include <geogram/basic/progress.h>
 #include <geogram/bibliography/bibliography.h>
 
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Minimum number of points in the coarsest level of
+     *  multilevel_CVT().
+     */
+    const index_t MULTILEVEL_MIN_POINTS = 10000;
+
+    /**
+     * \brief Ratio between the number of points of two consecutive
+     *  levels in multilevel_CVT().
+     * \details Inserting a point at the midpoint of each edge of the
+     *  restricted Delaunay triangulation multiplies the number of points
+     *  by approximately four.
+     */
+    const double MULTILEVEL_RATIO = 0.25;
+
+    /**
+     * \brief Ratio between the number of Newton iterations of the
+     *  coarsest level and of the other levels in multilevel_CVT().
+     */
+    const index_t MULTILEVEL_NEWTON_DIVISOR = 6;
+
+    /**
+     * \brief Inserts new points at the midpoints of the edges of the
+     *  restricted Delaunay triangulation.
+     * \param[in,out] CVT the CentroidalVoronoiTesselation
+     * \param[in] nb_points the new number of points
+     * \param[in] samples initial positions of the points, used if
+     *  the triangulation has not enough edges.
+     */
+    void insert_edge_midpoints(
+        CentroidalVoronoiTesselation& CVT, index_t nb_points,
+        const vector<double>& samples
+    ) {
+        index_t dim = CVT.dimension();
+        index_t nb_old_points = CVT.nb_points();
+        CVT.delaunay()->set_vertices(nb_old_points, CVT.embedding(0));
+        vector<index_t> triangles;
+        vector<double> vertices;
+        CVT.RVD()->compute_RDT(
+            triangles, vertices,
+            RestrictedVoronoiDiagram::RDT_DONT_REPAIR
+        );
+
+        vector<std::pair<index_t, index_t> > edges;
+        for(index_t t = 0; t < triangles.size(); t += 3) {
+            for(index_t lv = 0; lv < 3; ++lv) {
+                index_t v1 = triangles[t + lv];
+                index_t v2 = triangles[t + (lv + 1) % 3];
+                edges.push_back(
+                    std::make_pair(std::min(v1, v2), std::max(v1, v2))
+                );
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        // If there are more edges than new points, the refined edges are
+        // randomly chosen.
+        // The shuffle is implemented here with geogram's random number
+        // generator, since std::shuffle() gives different results with
+        // different standard libraries. Two draws are combined since
+        // RAND_MAX may be small.
+        Numeric::random_reset();
+        for(index_t i = index_t(edges.size()); i > 1; --i) {
+            Numeric::uint64 r =
+                (Numeric::uint64(Numeric::random_int32()) << 31) ^
+                Numeric::uint64(Numeric::random_int32());
+            std::swap(edges[i - 1], edges[index_t(r % i)]);
+        }
+
+        CVT.resize_points(nb_points);
+        for(index_t i = nb_old_points; i < nb_points; ++i) {
+            index_t e = i - nb_old_points;
+            double* p = CVT.embedding(i);
+            for(index_t c = 0; c < dim; ++c) {
+                p[c] = (e < edges.size()) ? 0.5 * (
+                    vertices[edges[e].first * dim + c] +
+                    vertices[edges[e].second * dim + c]
+                ) : samples[i * dim + c];
+            }
+        }
+    }
+
+    /**
+     * \brief Optimizes a CVT from coarse to fine.
+     * \details The initial sampling is sorted in BRIO order, and the 
+     *  levels of the BRIO order define nested subsets of the points.
+     *  The coarsest subset is optimized with Lloyd and Newton iterations,
+     *  then at each level, new points are inserted at the midpoints
+     *  of the edges of the restricted Delaunay triangulation of the 
+     *  previous level (or at their initial position if there are not
+     *  enough edges), and a few iterations are used to optimize
+     *  the warm-started points.
+     * \param[in,out] CVT the CentroidalVoronoiTesselation, with its
+     *  initial sampling
+     * \param[in] nb_Lloyd_iter number of Lloyd iterations for the
+     *  coarsest level
+     * \param[in] nb_Newton_iter number of Newton iterations for the
+     *  coarsest level, the other levels use MULTILEVEL_NEWTON_DIVISOR
+     *  times less iterations
+     * \param[in] Newton_m number of evaluations used for
+     *  Hessian approximation
+     */
+    void multilevel_CVT(
+        CentroidalVoronoiTesselation& CVT,
+        index_t nb_Lloyd_iter,
+        index_t nb_Newton_iter,
+        index_t Newton_m
+    ) {
+        index_t nb_fine_Newton_iter = (nb_Newton_iter == 0) ? 0 :
+            std::max(nb_Newton_iter / MULTILEVEL_NEWTON_DIVISOR, index_t(1));
+        index_t nb_points = CVT.nb_points();
+        index_t dim = CVT.dimension();
+
+        vector<double> samples(nb_points * dim);
+        vector<index_t> sorted;
+        vector<index_t> levels;
+        compute_BRIO_order(
+            nb_points, CVT.embedding(0), sorted, 3, dim,
+            64, MULTILEVEL_RATIO, &levels
+        );
+        for(index_t i = 0; i < nb_points; ++i) {
+            for(index_t c = 0; c < dim; ++c) {
+                samples[i * dim + c] = CVT.embedding(sorted[i])[c];
+            }
+        }
+
+        vector<index_t> level_end;
+        for(index_t l = 1; l < levels.size(); ++l) {
+            if(
+                levels[l] >= MULTILEVEL_MIN_POINTS ||
+                levels[l] == nb_points
+            ) {
+                level_end.push_back(levels[l]);
+            }
+        }
+
+        for(index_t l = 0; l < level_end.size(); ++l) {
+            Stopwatch W("Level");
+            index_t nb_Lloyd = nb_Lloyd_iter;
+            index_t nb_Newton = nb_Newton_iter;
+            if(l == 0) {
+                CVT.set_points(level_end[0], samples.data());
+            } else {
+                insert_edge_midpoints(CVT, level_end[l], samples);
+                nb_Lloyd = std::min(nb_Lloyd_iter, index_t(1));
+                nb_Newton = nb_fine_Newton_iter;
+            }
+            Logger::out("Remesh") << "Level " << l << ": "
+                                  << level_end[l] << " points, "
+                                  << nb_Lloyd << " Lloyd, "
+                                  << nb_Newton << " Newton iterations"
+                                  << std::endl;
+            try {
+                ProgressTask progress("Lloyd", 100);
+                CVT.set_progress_logger(&progress);
+                CVT.Lloyd_iterations(nb_Lloyd);
+            }
+            catch(const TaskCanceled&) {
+                // TODO_CANCEL
+            }
+            if(nb_Newton != 0) {
+                try {
+                    ProgressTask progress("Newton", 100);
+                    CVT.set_progress_logger(&progress);
+                    CVT.Newton_iterations(nb_Newton, Newton_m);
+                }
+                catch(const TaskCanceled&) {
+                    // TODO_CANCEL
+                }
+            }
+        }
+    }
+}
+
 /****************************************************************************/
 
 namespace GEO {
@@ -67,7 +247,8 @@ namespace GEO {
         coord_index_t dim,
         index_t nb_Lloyd_iter,
         index_t nb_Newton_iter,
-        index_t Newton_m
+        index_t Newton_m,
+        bool multilevel
     ) {
 
         geo_cite("DBLP:journals/cgf/YanLLSW09");
@@ -97,24 +278,28 @@ namespace GEO {
         }
         CVT.compute_initial_sampling(nb_points);
 
-        try {
-            ProgressTask progress("Lloyd", 100);
-            CVT.set_progress_logger(&progress);
-            CVT.Lloyd_iterations(nb_Lloyd_iter);
-        }
-        catch(const TaskCanceled&) {
-            // TODO_CANCEL
-        }
-
-        if(nb_Newton_iter != 0) {
+        if(multilevel) {
+            multilevel_CVT(CVT, nb_Lloyd_iter, nb_Newton_iter, Newton_m);
+        } else {
             try {
-                ProgressTask progress("Newton", 100);
+                ProgressTask progress("Lloyd", 100);
                 CVT.set_progress_logger(&progress);
-                CVT.Newton_iterations(nb_Newton_iter, Newton_m);
+                CVT.Lloyd_iterations(nb_Lloyd_iter);
             }
             catch(const TaskCanceled&) {
                 // TODO_CANCEL
             }
+
+            if(nb_Newton_iter != 0) {
+                try {
+                    ProgressTask progress("Newton", 100);
+                    CVT.set_progress_logger(&progress);
+                    CVT.Newton_iterations(nb_Newton_iter, Newton_m);
+                }
+                catch(const TaskCanceled&) {
+                    // TODO_CANCEL
+                }
+            }
         }
 
         if(M_in.vertices.dimension() == 6 &&
@@ -74,6 +74,12 @@ namespace GEO {
      * \param[in] nb_Newton_iter number of Newton iterations
      * \param[in] Newton_m number of evaluations used for
      *  Hessian approximation..
+     * \param[in] multilevel if set, the points are optimized from
+     *  coarse to fine: a subset of about 1/4 of the points is optimized
+     *  first, then new points are inserted at the midpoints of the 
+     *  edges of its restricted Delaunay triangulation, and so on. 
+     *  The coarsest level uses nb_Lloyd_iter and nb_Newton_iter 
+     *  iterations, and the finer levels use a few iterations only.
      *
      * Example 1 - isotropic remesh:
      * \code
@@ -92,7 +98,8 @@ namespace GEO {
         coord_index_t dim = 0,
         index_t nb_Lloyd_iter = 5,
         index_t nb_Newton_iter = 30,
-        index_t Newton_m = 7
+        index_t Newton_m = 7,
+        bool multilevel = false
     );
 }
 
@@ -56,6 +56,10 @@
 
 #include <random>
 
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
 namespace {
 
     using namespace GEO;
@@ -145,6 +149,65 @@ namespace {
         }
         VertexArray vertices;
     };
+
+#ifndef GEOGRAM_PSM
+
+    /**
+     * \brief Exposes an interface compatible with the requirement
+     * of Hilbert sort templates for a mesh with single-precision
+     * vertices.
+     * \details Coordinates are compared and accumulated as floats
+     *  promoted to doubles, thus the computed order is the same as
+     *  the one of the same mesh stored in double precision.
+     */
+    class SinglePrecisionMesh {
+    public:
+
+        /**
+         * \brief Used by SinglePrecisionMesh to access the vertices.
+         */
+        class Vertices {
+        public:
+            /**
+             * \brief Constructs a new Vertices.
+             * \param[in] vertices the vertices of a mesh in
+             *  single-precision mode
+             */
+            Vertices(const MeshVertices& vertices) : vertices_(vertices) {
+            }
+
+            /**
+             * \brief Gets a vertex by its index.
+             * \param[in] v the index of the vertex
+             * \return a const pointer to the coordinates of the vertex
+             */
+            const float* point_ptr(index_t v) const {
+                return vertices_.single_precision_point_ptr(v);
+            }
+
+        private:
+            const MeshVertices& vertices_;
+        };
+
+        /**
+         * \brief Constructs a new SinglePrecisionMesh.
+         * \param[in] M a mesh in single-precision mode
+         */
+        SinglePrecisionMesh(const Mesh& M) :
+            vertices(M.vertices),
+            facets(M.facets),
+            facet_corners(M.facet_corners),
+            cells(M.cells) {
+            geo_debug_assert(M.vertices.single_precision());
+        }
+
+        Vertices vertices;
+        const MeshFacets& facets;
+        const MeshFacetCornersStore& facet_corners;
+        const MeshCells& cells;
+    };
+
+#endif
     
     /************************************************************************/
 
@@ -296,9 +359,9 @@ namespace {
             double result = 0.0;
 	    double s = 1.0 / double(mesh_.facets.nb_vertices(f));
             for(index_t c: mesh_.facets.corners(f)) {
-                result += s*mesh_.vertices.point_ptr(
+                result += s*double(mesh_.vertices.point_ptr(
                     mesh_.facet_corners.vertex(c)
-		)[COORD]; 
+		)[COORD]); 
             }
             return result;
         }
@@ -438,9 +501,9 @@ namespace {
         double center(index_t t) const {
             double result = 0.0;
             for(index_t lv = 0; lv < 4; ++lv) {
-                result += mesh_.vertices.point_ptr(
+                result += double(mesh_.vertices.point_ptr(
                     mesh_.cells.vertex(t, lv)
-                )[COORD];
+                )[COORD]);
             }
             return result;
         }
@@ -580,9 +643,9 @@ namespace {
         double center(index_t c) const {
             double result = 0.0;
             for(index_t lv = 0; lv < mesh_.cells.nb_vertices(c); ++lv) {
-                result += mesh_.vertices.point_ptr(
+                result += double(mesh_.vertices.point_ptr(
                     mesh_.cells.vertex(c, lv)
-                )[COORD];
+                )[COORD]);
             }
             return result / double(mesh_.cells.nb_vertices(c));
         }
@@ -954,6 +1017,31 @@ namespace {
     /************************************************************************/
 
 #ifndef GEOGRAM_PSM
+
+    /**
+     * \brief Sorts a sequence of elements of a mesh spatially.
+     * \details Dispatches on the precision of the vertices, so that
+     *  meshes in single-precision mode are sorted without being
+     *  converted.
+     * \param[in] M the mesh in which the elements to sort reside
+     * \param[in] b an iterator to the first index to be sorted
+     * \param[in] e an iterator one position past the last index 
+     *  to be sorted
+     * \tparam CMP the comparator class
+     */
+    template <template <int COORD, bool UP, class MESH> class CMP>
+    void mesh_spatial_sort_3d(
+        const Mesh& M,
+        vector<index_t>::iterator b,
+        vector<index_t>::iterator e
+    ) {
+        if(M.vertices.single_precision()) {
+            SinglePrecisionMesh SM(M);
+            HilbertSort3d<CMP, SinglePrecisionMesh>(SM, b, e);
+        } else {
+            HilbertSort3d<CMP, Mesh>(M, b, e);
+        }
+    }
     
     /**
      * \brief Sorts the vertices of a mesh according to the Hilbert ordering.
@@ -972,7 +1060,7 @@ namespace {
         for(index_t i: M.vertices) {
             sorted_indices[i] = i;
         }
-        HilbertSort3d<Hilbert_vcmp, Mesh>(
+        mesh_spatial_sort_3d<Hilbert_vcmp>(
             M, sorted_indices.begin(), sorted_indices.end()
         );
     }
@@ -994,7 +1082,7 @@ namespace {
         for(index_t i: M.facets) {
             sorted_indices[i] = i;
         }
-        HilbertSort3d<Hilbert_fcmp, Mesh>(
+        mesh_spatial_sort_3d<Hilbert_fcmp>(
             M, sorted_indices.begin(), sorted_indices.end()
         );
     }
@@ -1016,11 +1104,11 @@ namespace {
             sorted_indices[i] = i;
         }
         if(M.cells.are_simplices()) {
-            HilbertSort3d<Hilbert_tcmp, Mesh>(
+            mesh_spatial_sort_3d<Hilbert_tcmp>(
                 M, sorted_indices.begin(), sorted_indices.end()
             );
         } else {
-            HilbertSort3d<Hilbert_ccmp, Mesh>(
+            mesh_spatial_sort_3d<Hilbert_ccmp>(
                 M, sorted_indices.begin(), sorted_indices.end()
             );
         }
@@ -1042,7 +1130,7 @@ namespace {
         for(index_t i: M.vertices) {
             sorted_indices[i] = i;
         }
-        HilbertSort3d<Morton_vcmp, Mesh>(
+        mesh_spatial_sort_3d<Morton_vcmp>(
             M, sorted_indices.begin(), sorted_indices.end()
         );
     }
@@ -1063,7 +1151,7 @@ namespace {
         for(index_t i: M.facets) {
             sorted_indices[i] = i;
         }
-        HilbertSort3d<Morton_fcmp, Mesh>(
+        mesh_spatial_sort_3d<Morton_fcmp>(
             M, sorted_indices.begin(), sorted_indices.end()
         );
     }
@@ -1085,17 +1173,415 @@ namespace {
             sorted_indices[i] = i;
         }
         if(M.cells.are_simplices()) {
-            HilbertSort3d<Morton_tcmp, Mesh>(
+            mesh_spatial_sort_3d<Morton_tcmp>(
                 M, sorted_indices.begin(), sorted_indices.end()
             );
         } else {
-            HilbertSort3d<Morton_ccmp, Mesh>(
+            mesh_spatial_sort_3d<Morton_ccmp>(
                 M, sorted_indices.begin(), sorted_indices.end()
             );
         }
     }
 
 #endif    
+
+    /************************************************************************/
+
+    /**
+     * \brief Number of bits of the digits used by the radix sort.
+     */
+    const index_t RADIX_BITS = 11;
+
+    /**
+     * \brief Number of buckets used by the radix sort.
+     */
+    const index_t RADIX_SIZE = index_t(1) << RADIX_BITS;
+
+    /**
+     * \brief Below this number of elements, radix sort and
+     *  key computation are sequential.
+     */
+    const index_t RADIX_MIN_PARALLEL_SIZE = 65536;
+
+    /**
+     * \brief Inserts two zero bits between the 21 least significant
+     *  bits of an integer.
+     * \param[in] x the integer
+     * \return the spread bits of \p x
+     */
+    inline Numeric::uint64 spread_bits_3d(Numeric::uint64 x) {
+#ifdef __BMI2__
+        return _pdep_u64(x, 0x1249249249249249ull);
+#else
+        x &= 0x1fffffull;
+        x = (x | (x << 32)) & 0x1f00000000ffffull;
+        x = (x | (x << 16)) & 0x1f0000ff0000ffull;
+        x = (x | (x << 8))  & 0x100f00f00f00f00full;
+        x = (x | (x << 4))  & 0x10c30c30c30c30c3ull;
+        x = (x | (x << 2))  & 0x1249249249249249ull;
+        return x;
+#endif
+    }
+
+    /**
+     * \brief Inserts a zero bit between the 32 least significant
+     *  bits of an integer.
+     * \param[in] x the integer
+     * \return the spread bits of \p x
+     */
+    inline Numeric::uint64 spread_bits_2d(Numeric::uint64 x) {
+#ifdef __BMI2__
+        return _pdep_u64(x, 0x5555555555555555ull);
+#else
+        x &= 0xffffffffull;
+        x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+        x = (x | (x << 8))  & 0x00ff00ff00ff00ffull;
+        x = (x | (x << 4))  & 0x0f0f0f0f0f0f0f0full;
+        x = (x | (x << 2))  & 0x3333333333333333ull;
+        x = (x | (x << 1))  & 0x5555555555555555ull;
+        return x;
+#endif
+    }
+
+    /**
+     * \brief Computes the Morton key of a point with integer coordinates.
+     * \details The most significant bit of the key is the most
+     *  significant bit of X[0].
+     * \param[in] X the 2 or 3 integer coordinates, with 32 and 21
+     *  significant bits respectively
+     * \param[in] dimension 2 or 3
+     * \return the Morton key
+     */
+    inline Numeric::uint64 morton_key(
+        const Numeric::uint32* X, index_t dimension
+    ) {
+        if(dimension == 3) {
+            return
+                (spread_bits_3d(X[0]) << 2) |
+                (spread_bits_3d(X[1]) << 1) |
+                 spread_bits_3d(X[2]);
+        }
+        return (spread_bits_2d(X[0]) << 1) | spread_bits_2d(X[1]);
+    }
+
+    /**
+     * \brief Computes the Hilbert key of a point with integer coordinates.
+     * \details Uses the "transpose" representation of the Hilbert index,
+     *  from: John Skilling, Programming the Hilbert curve, AIP Conf.
+     *  Proc. 707, 2004. The transposed coordinates are then interleaved
+     *  like a Morton key.
+     * \param[in] X_in the 2 or 3 integer coordinates, with 32 and 21
+     *  significant bits respectively
+     * \param[in] dimension 2 or 3
+     * \return the Hilbert key
+     */
+    inline Numeric::uint64 hilbert_key(
+        const Numeric::uint32* X_in, index_t dimension
+    ) {
+        Numeric::uint32 X[3];
+        for(index_t i=0; i<dimension; ++i) {
+            X[i] = X_in[i];
+        }
+        Numeric::uint32 M = (dimension == 3) ? (1u << 20) : (1u << 31);
+        // Inverse undo
+        for(Numeric::uint32 Q = M; Q > 1; Q >>= 1) {
+            Numeric::uint32 P = Q - 1;
+            for(index_t i=0; i<dimension; ++i) {
+                if((X[i] & Q) != 0) {
+                    X[0] ^= P;
+                } else {
+                    Numeric::uint32 t = (X[0] ^ X[i]) & P;
+                    X[0] ^= t;
+                    X[i] ^= t;
+                }
+            }
+        }
+        // Gray encode
+        for(index_t i=1; i<dimension; ++i) {
+            X[i] ^= X[i-1];
+        }
+        Numeric::uint32 t = 0;
+        for(Numeric::uint32 Q = M; Q > 1; Q >>= 1) {
+            if((X[dimension-1] & Q) != 0) {
+                t ^= Q-1;
+            }
+        }
+        for(index_t i=0; i<dimension; ++i) {
+            X[i] ^= t;
+        }
+        return morton_key(X, dimension);
+    }
+
+    /**
+     * \brief Computes the spatial keys of a set of points.
+     * \details Coordinates are quantized in the bounding box of the points
+     *  (with the same scaling along all axes), using 21 bits per
+     *  coordinate in 3D and 32 bits per coordinate in 2D.
+     * \param[in] points pointer to the coordinates of the points
+     * \param[in] dimension 2 or 3
+     * \param[in] stride number of coordinates between two consecutive points
+     * \param[in] indices the indices of the points
+     * \param[in] nb number of points in \p indices
+     * \param[in] hilbert if true, Hilbert keys are computed, else Morton
+     *  keys are computed
+     * \param[out] keys the nb keys, keys[i] is the key of 
+     *  point indices[i]
+     * \tparam T the type of the coordinates, float or double
+     */
+    template <class T> void compute_spatial_keys(
+        const T* points, index_t dimension, index_t stride,
+        const index_t* indices, index_t nb,
+        bool hilbert,
+        vector<Numeric::uint64>& keys
+    ) {
+        geo_assert(dimension == 2 || dimension == 3);
+
+        double xyz_min[3];
+        double xyz_max[3];
+        for(index_t c=0; c<dimension; ++c) {
+            xyz_min[c] = Numeric::max_float64();
+            xyz_max[c] = Numeric::min_float64();
+        }
+        Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+        parallel_for_slice(
+            0, nb,
+            [&](index_t from, index_t to) {
+                double local_min[3];
+                double local_max[3];
+                for(index_t c=0; c<dimension; ++c) {
+                    local_min[c] = Numeric::max_float64();
+                    local_max[c] = Numeric::min_float64();
+                }
+                for(index_t i=from; i<to; ++i) {
+                    const T* p = points + size_t(indices[i])*stride;
+                    for(index_t c=0; c<dimension; ++c) {
+                        local_min[c] = std::min(local_min[c], double(p[c]));
+                        local_max[c] = std::max(local_max[c], double(p[c]));
+                    }
+                }
+                Process::acquire_spinlock(lock);
+                for(index_t c=0; c<dimension; ++c) {
+                    xyz_min[c] = std::min(xyz_min[c], local_min[c]);
+                    xyz_max[c] = std::max(xyz_max[c], local_max[c]);
+                }
+                Process::release_spinlock(lock);
+            }
+        );
+
+        double extent = 0.0;
+        for(index_t c=0; c<dimension; ++c) {
+            extent = std::max(extent, xyz_max[c] - xyz_min[c]);
+        }
+        double max_coord = (dimension == 3) ?
+            double((1u << 21) - 1) : double(0xffffffffu);
+        double scale = (extent > 0.0) ? max_coord / extent : 0.0;
+
+        keys.resize(nb);
+        parallel_for_slice(
+            0, nb,
+            [&](index_t from, index_t to) {
+                Numeric::uint32 X[3];
+                for(index_t i=from; i<to; ++i) {
+                    const T* p = points + size_t(indices[i])*stride;
+                    for(index_t c=0; c<dimension; ++c) {
+                        double x = (double(p[c]) - xyz_min[c]) * scale;
+                        x = std::min(std::max(x, 0.0), max_coord);
+                        X[c] = Numeric::uint32(x);
+                    }
+                    keys[i] = hilbert ?
+                        hilbert_key(X, dimension) : morton_key(X, dimension);
+                }
+            }
+        );
+    }
+
+    /**
+     * \brief Sorts values by keys using a parallel least significant
+     *  digit radix sort.
+     * \details The sort is stable, and the result does not depend on
+     *  the number of threads. At each pass, the sequence is split into
+     *  slices, each slice computes a histogram of its digits, then
+     *  prefix sums give the destination of each slice / digit pair.
+     *  Passes where all the keys have the same digit are skipped.
+     * \param[in,out] keys the keys
+     * \param[in,out] values the values, permuted in the same way
+     *  as the keys
+     * \param[in] nb_bits number of significant bits in the keys
+     */
+    void radix_sort(
+        vector<Numeric::uint64>& keys, vector<index_t>& values,
+        index_t nb_bits
+    ) {
+        geo_assert(keys.size() == values.size());
+        index_t nb = keys.size();
+        if(nb <= 1) {
+            return;
+        }
+
+        index_t nb_slices = (nb < RADIX_MIN_PARALLEL_SIZE) ?
+            1 : Process::maximum_concurrent_threads();
+        auto slice_begin = [&](index_t s)->index_t {
+            return index_t(Numeric::uint64(nb) * s / nb_slices);
+        };
+
+        vector<Numeric::uint64> keys2(nb);
+        vector<index_t> values2(nb);
+        vector<index_t> histogram(nb_slices * RADIX_SIZE);
+
+        for(index_t shift = 0; shift < nb_bits; shift += RADIX_BITS) {
+
+            // Step 1: histogram of each slice
+            histogram.assign(nb_slices * RADIX_SIZE, 0);
+            parallel_for(
+                0, nb_slices,
+                [&](index_t s) {
+                    index_t* H = histogram.data() + s*RADIX_SIZE;
+                    for(index_t i=slice_begin(s); i<slice_begin(s+1); ++i) {
+                        ++H[(keys[i] >> shift) & (RADIX_SIZE-1)];
+                    }
+                }
+            );
+
+            // Step 2: prefix sums, H[s][d] becomes the position where
+            // slice s writes its next element with digit d.
+            bool trivial_pass = false;
+            index_t pos = 0;
+            for(index_t d=0; d<RADIX_SIZE; ++d) {
+                index_t nb_d = 0;
+                for(index_t s=0; s<nb_slices; ++s) {
+                    index_t& H = histogram[s*RADIX_SIZE+d];
+                    nb_d += H;
+                    index_t nb_sd = H;
+                    H = pos;
+                    pos += nb_sd;
+                }
+                if(nb_d == nb) {
+                    trivial_pass = true;
+                    break;
+                }
+            }
+            if(trivial_pass) {
+                continue;
+            }
+
+            // Step 3: scatter
+            parallel_for(
+                0, nb_slices,
+                [&](index_t s) {
+                    index_t* H = histogram.data() + s*RADIX_SIZE;
+                    for(index_t i=slice_begin(s); i<slice_begin(s+1); ++i) {
+                        index_t d =
+                            index_t((keys[i] >> shift) & (RADIX_SIZE-1));
+                        index_t j = H[d];
+                        ++H[d];
+                        keys2[j] = keys[i];
+                        values2[j] = values[i];
+                    }
+                }
+            );
+            keys.swap(keys2);
+            values.swap(values2);
+        }
+    }
+
+    /**
+     * \brief Sorts a sequence of points using spatial keys and
+     *  radix sort.
+     * \param[in] points pointer to the coordinates of the points
+     * \param[in] dimension 2 or 3
+     * \param[in] stride number of coordinates between two consecutive points
+     * \param[in] b , e the sequence of point indices to be sorted
+     * \param[in] hilbert if true, sort along the Hilbert curve, else
+     *  along the Morton curve
+     * \tparam T the type of the coordinates, float or double
+     */
+    template <class T> void radix_spatial_sort(
+        const T* points, index_t dimension, index_t stride,
+        vector<index_t>::iterator b, vector<index_t>::iterator e,
+        bool hilbert
+    ) {
+        vector<index_t> values(index_t(e-b));
+        std::copy(b, e, values.begin());
+        vector<Numeric::uint64> keys;
+        compute_spatial_keys(
+            points, dimension, stride, values.data(), values.size(),
+            hilbert, keys
+        );
+        radix_sort(keys, values, (dimension == 3) ? 63 : 64);
+        std::copy(values.begin(), values.end(), b);
+    }
+
+    /**
+     * \brief Sorts a sequence of indices using precomputed keys and
+     *  radix sort.
+     * \param[in] keys the keys of all elements
+     * \param[in] nb_bits number of significant bits in the keys
+     * \param[in] b , e the sequence of indices to be sorted
+     */
+    void radix_sort_by_keys(
+        const vector<Numeric::uint64>& keys, index_t nb_bits,
+        vector<index_t>::iterator b, vector<index_t>::iterator e
+    ) {
+        vector<index_t> values(index_t(e-b));
+        std::copy(b, e, values.begin());
+        vector<Numeric::uint64> local_keys(values.size());
+        for(index_t i=0; i<values.size(); ++i) {
+            local_keys[i] = keys[values[i]];
+        }
+        radix_sort(local_keys, values, nb_bits);
+        std::copy(values.begin(), values.end(), b);
+    }
+
+#ifndef GEOGRAM_PSM
+
+    /**
+     * \brief Sorts the facets or the cells of a mesh using spatial keys
+     *  computed from their centroids.
+     * \param[in] M the mesh
+     * \param[in] cells if true, cells are sorted, else facets are sorted
+     * \param[in] hilbert if true, sort along the Hilbert curve, else
+     *  along the Morton curve
+     * \param[out] sorted_indices the permutation to be applied to the
+     *  facets or cells
+     */
+    void radix_sort_elements_3d(
+        const Mesh& M, bool cells, bool hilbert,
+        vector<index_t>& sorted_indices
+    ) {
+        index_t nb = cells ? M.cells.nb() : M.facets.nb();
+        vector<double> centroids(3*nb);
+        parallel_for_slice(
+            0, nb,
+            [&](index_t from, index_t to) {
+                for(index_t e=from; e<to; ++e) {
+                    vec3 g(0.0, 0.0, 0.0);
+                    index_t nv = cells ?
+                        M.cells.nb_vertices(e) : M.facets.nb_vertices(e);
+                    for(index_t lv=0; lv<nv; ++lv) {
+                        index_t v = cells ?
+                            M.cells.vertex(e,lv) : M.facets.vertex(e,lv);
+                        g += Geom::mesh_vertex_promoted(M, v);
+                    }
+                    if(nv != 0) {
+                        g = (1.0 / double(nv)) * g;
+                    }
+                    centroids[3*e]   = g.x;
+                    centroids[3*e+1] = g.y;
+                    centroids[3*e+2] = g.z;
+                }
+            }
+        );
+        sorted_indices.resize(nb);
+        for(index_t i=0; i<nb; ++i) {
+            sorted_indices[i] = i;
+        }
+        radix_spatial_sort(
+            centroids.data(), 3, 3,
+            sorted_indices.begin(), sorted_indices.end(), hilbert
+        );
+    }
+
+#endif
     
     /**
      * \brief Computes the BRIO order for a set of 3D points.
@@ -1112,6 +1598,8 @@ namespace {
      *  the rest to be sorted
      * \param[in,out] depth iteration depth
      * \param[out] levels if non-null, bounds of each level
+     * \param[in] keys if non-null, the Hilbert keys of all the vertices,
+     *  used to sort each level with radix sort.
      */
     void compute_BRIO_order_recursive(
         index_t nb_vertices, const double* vertices,
@@ -1122,7 +1610,8 @@ namespace {
         index_t threshold,
         double ratio,
         index_t& depth,
-        vector<index_t>* levels
+        vector<index_t>* levels,
+        const vector<Numeric::uint64>* keys
     ) {
         geo_debug_assert(e > b);
 
@@ -1135,12 +1624,14 @@ namespace {
 		dimension, stride,
                 sorted_indices, b, m,
                 threshold, ratio, depth,
-                levels
+                levels, keys
             );
         }
 
         VertexMesh M(nb_vertices, vertices, stride);
-	if(dimension == 3) {
+	if(keys != nullptr) {
+	    radix_sort_by_keys(*keys, (dimension == 3) ? 63 : 64, m, e);
+	} else if(dimension == 3) {
 	    HilbertSort3d<Hilbert_vcmp, VertexMesh>(
 		M, m, e
 	    );
@@ -1164,12 +1655,33 @@ namespace GEO {
 
 #ifndef GEOGRAM_PSM
     
-    void mesh_reorder(Mesh& M, MeshOrder order) {
+    void mesh_reorder(Mesh& M, MeshOrder order, SpatialSortMode mode) {
 
         geo_assert(M.vertices.dimension() >= 3);
 
+        bool radix = (mode == SPATIAL_SORT_RADIX);
+        bool hilbert = (order == MESH_ORDER_HILBERT);
+
         // Step 1: reorder vertices
-        {
+        if(radix) {
+            vector<index_t> sorted_indices(M.vertices.nb());
+            for(index_t i: M.vertices) {
+                sorted_indices[i] = i;
+            }
+            if(M.vertices.single_precision()) {
+                radix_spatial_sort(
+                    M.vertices.single_precision_point_ptr(0),
+                    3, M.vertices.dimension(),
+                    sorted_indices.begin(), sorted_indices.end(), hilbert
+                );
+            } else {
+                radix_spatial_sort(
+                    M.vertices.point_ptr(0), 3, M.vertices.dimension(),
+                    sorted_indices.begin(), sorted_indices.end(), hilbert
+                );
+            }
+            M.vertices.permute_elements(sorted_indices);
+        } else {
             vector<index_t> sorted_indices;
             switch(order) {
                 case MESH_ORDER_HILBERT:
@@ -1183,7 +1695,11 @@ namespace GEO {
         }
 
         // Step 2: reorder facets
-        if(M.facets.nb() != 0) {
+        if(M.facets.nb() != 0 && radix) {
+            vector<index_t> sorted_indices;
+            radix_sort_elements_3d(M, false, hilbert, sorted_indices);
+            M.facets.permute_elements(sorted_indices);
+        } else if(M.facets.nb() != 0) {
             vector<index_t> sorted_indices;
             switch(order) {
                 case MESH_ORDER_HILBERT:
@@ -1197,7 +1713,11 @@ namespace GEO {
         }
 
         // Step 3: reorder cells
-        if(M.cells.nb() != 0) {
+        if(M.cells.nb() != 0 && radix) {
+            vector<index_t> sorted_indices;
+            radix_sort_elements_3d(M, true, hilbert, sorted_indices);
+            M.cells.permute_elements(sorted_indices);
+        } else if(M.cells.nb() != 0) {
             vector<index_t> sorted_indices;
             switch(order) {
                 case MESH_ORDER_HILBERT:
@@ -1219,14 +1739,22 @@ namespace GEO {
         vector<index_t>& sorted_indices,
         index_t first,
         index_t last,
-        index_t dimension, index_t stride
+        index_t dimension, index_t stride,
+        SpatialSortMode mode
     ) {
         geo_debug_assert(last > first);
         if(last - first <= 1) {
             return;
         }
         VertexMesh M(total_nb_vertices, vertices, stride);
-	if(dimension == 3) {
+	if(mode == SPATIAL_SORT_RADIX) {
+	    radix_spatial_sort(
+		vertices, dimension, stride,
+		sorted_indices.begin() + int(first),
+		sorted_indices.begin() + int(last),
+		true
+	    );
+	} else if(dimension == 3) {
 	    HilbertSort3d<Hilbert_vcmp, VertexMesh>(
 		M, sorted_indices.begin() + int(first),
 		sorted_indices.begin() + int(last)
@@ -1248,7 +1776,8 @@ namespace GEO {
         index_t stride,
         index_t threshold,
         double ratio,
-        vector<index_t>* levels
+        vector<index_t>* levels,
+        SpatialSortMode mode
     ) {
         if(levels != nullptr) {
             levels->clear();
@@ -1268,12 +1797,27 @@ namespace GEO {
         std::mt19937 urng(rng());
         std::shuffle(sorted_indices.begin(), sorted_indices.end(), urng);
 
+        // In radix mode, the keys of all the vertices are computed once,
+        // then each level is sorted by radix sort.
+        vector<Numeric::uint64> keys;
+        if(mode == SPATIAL_SORT_RADIX) {
+            vector<index_t> all_vertices(nb_vertices);
+            for(index_t i = 0; i < nb_vertices; ++i) {
+                all_vertices[i] = i;
+            }
+            compute_spatial_keys(
+                vertices, dimension, stride,
+                all_vertices.data(), nb_vertices, true, keys
+            );
+        }
+
         compute_BRIO_order_recursive(
             nb_vertices, vertices,
 	    dimension, stride,
             sorted_indices,
             sorted_indices.begin(), sorted_indices.end(),
-            threshold, ratio, depth, levels
+            threshold, ratio, depth, levels,
+            (mode == SPATIAL_SORT_RADIX) ? &keys : nullptr
         );
     }
 }
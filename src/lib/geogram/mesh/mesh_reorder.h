@@ -57,6 +57,26 @@
 
 namespace GEO {
 
+    /**
+     * \brief Algorithm used to compute spatial orders.
+     * \details It is passed to mesh_reorder(), compute_Hilbert_order()
+     *  and compute_BRIO_order(), each call can use a different one.
+     */
+    enum SpatialSortMode {
+        /**
+         * Recursive partitioning of the elements using comparisons
+         * (default).
+         */
+        SPATIAL_SORT_RECURSIVE,
+        /**
+         * Coordinates are quantized and converted into 64-bit Hilbert
+         * or Morton keys, sorted with a parallel radix sort. This is
+         * faster for large point sets, but elements that fall in the
+         * same quantization cell (2^21 cells per axis in 3D) keep
+         * their relative order.
+         */
+        SPATIAL_SORT_RADIX
+    };
 
 #ifndef GEOGRAM_PSM     
     class Mesh;
@@ -83,9 +103,12 @@ namespace GEO {
      *  and for implementing mesh partitioning.
      * \param[in] M the mesh to reorder
      * \param[in] order the reordering scheme
+     * \param[in] mode the algorithm used to compute the order, one of
+     *  SPATIAL_SORT_RECURSIVE (default), SPATIAL_SORT_RADIX
      */
     void GEOGRAM_API mesh_reorder(
-        Mesh& M, MeshOrder order = MESH_ORDER_HILBERT
+        Mesh& M, MeshOrder order = MESH_ORDER_HILBERT,
+        SpatialSortMode mode = SPATIAL_SORT_RECURSIVE
     );
 
 #endif
@@ -128,13 +151,16 @@ namespace GEO {
      *  in \p sorted_indices to be sorted
      * \param[in] dimension number of vertices coordinates
      * \param[in] stride number of doubles between two consecutive vertices
+     * \param[in] mode the algorithm used to compute the order, one of
+     *  SPATIAL_SORT_RECURSIVE (default), SPATIAL_SORT_RADIX
      */
     void GEOGRAM_API compute_Hilbert_order(
         index_t total_nb_vertices, const double* vertices,
         vector<index_t>& sorted_indices,
         index_t first,
         index_t last,
-        index_t dimension, index_t stride = 3
+        index_t dimension, index_t stride = 3,
+        SpatialSortMode mode = SPATIAL_SORT_RECURSIVE
     );
     
     /**
@@ -155,6 +181,8 @@ namespace GEO {
      *  the rest to be sorted
      * \param[out] levels if non-nullptr, indices that correspond to level l are
      *   in the range levels[l] (included) ... levels[l+1] (excluded)
+     * \param[in] mode the algorithm used to sort each level, one of
+     *  SPATIAL_SORT_RECURSIVE (default), SPATIAL_SORT_RADIX
      */
     void GEOGRAM_API compute_BRIO_order(
         index_t nb_vertices, const double* vertices,
@@ -163,7 +191,8 @@ namespace GEO {
         index_t stride = 3,
         index_t threshold = 64,
         double ratio = 0.125,
-        vector<index_t>* levels = nullptr
+        vector<index_t>* levels = nullptr,
+        SpatialSortMode mode = SPATIAL_SORT_RECURSIVE
     );
 
     /**
@@ -49,14 +49,17 @@
 #include <geogram/mesh/mesh_halfedges.h>
 #include <geogram/mesh/mesh_io.h>
 #include <geogram/mesh/mesh_preprocessing.h>
+#include <geogram/mesh/mesh_topology.h>
 #include <geogram/points/colocate.h>
 #include <geogram/basic/geometry_nd.h>
 #include <geogram/basic/stopwatch.h>
 #include <geogram/basic/command_line.h>
 #include <geogram/basic/argused.h>
 #include <geogram/basic/algorithm.h>
+#include <geogram/basic/process.h>
 #include <stack>
 #include <queue>
+#include <sstream>
 
 namespace {
 
@@ -94,32 +97,42 @@ namespace {
 
 
         // Replace vertex indices for edges
-        for(index_t e: M.edges) {
-            M.edges.set_vertex(e, 0, old2new[M.edges.vertex(e,0)]);
-            M.edges.set_vertex(e, 1, old2new[M.edges.vertex(e,1)]);            
-        }
+        parallel_for(
+            0, M.edges.nb(),
+            [&M, &old2new](index_t e) {
+                M.edges.set_vertex(e, 0, old2new[M.edges.vertex(e,0)]);
+                M.edges.set_vertex(e, 1, old2new[M.edges.vertex(e,1)]);
+            }
+        );
 
         // Replace vertex indices for facets
-        for(index_t c: M.facet_corners) {
-            M.facet_corners.set_vertex(c, old2new[M.facet_corners.vertex(c)]);
-        }
+        parallel_for(
+            0, M.facet_corners.nb(),
+            [&M, &old2new](index_t c) {
+                M.facet_corners.set_vertex(
+                    c, old2new[M.facet_corners.vertex(c)]
+                );
+            }
+        );
 
         // Replace vertex indices for cells
-        for(index_t ce: M.cells) {
-            for(index_t c: M.cells.corners(ce)) {
-                M.cell_corners.set_vertex(c, old2new[M.cell_corners.vertex(c)]);
+        parallel_for(
+            0, M.cell_corners.nb(),
+            [&M, &old2new](index_t c) {
+                M.cell_corners.set_vertex(
+                    c, old2new[M.cell_corners.vertex(c)]
+                );
             }
-        } 
+        );
         
         // Now old2new is "recycled" for marking vertices that
         // need to be removed.
-        for(index_t i = 0; i < old2new.size(); i++) {
-            if(old2new[i] == i) {
-                old2new[i] = 0;
-            } else {
-                old2new[i] = 1;
+        parallel_for(
+            0, old2new.size(),
+            [&old2new](index_t i) {
+                old2new[i] = (old2new[i] == i) ? 0 : 1;
             }
-        }
+        );
         M.vertices.delete_elements(old2new);
     }
 
@@ -193,7 +206,7 @@ namespace {
     }
 
     /**
-     * \brief Comparator class for sorting facets.
+     * \brief Comparator class for detecting duplicated facets.
      */
     class CompareFacets {
     public:
@@ -205,37 +218,6 @@ namespace {
             mesh_(M) {
         }
 
-        /**
-         * \brief Tests the lexicographic order of two facets by their indices.
-         * \param[in] f1 index of the first facet
-         * \param[in] f2 index of the second facet
-         * \return true if facet \p f1 is before facet \p f2 according to
-         *  the lexicographic order of its vertices, false otherwise.
-         */
-        bool is_before(index_t f1, index_t f2) const {
-            index_t c1 = mesh_.facets.corners_begin(f1);
-            index_t c2 = mesh_.facets.corners_begin(f2);
-            while(
-                c1 != mesh_.facets.corners_end(f1) &&
-                c2 != mesh_.facets.corners_end(f2)
-            ) {
-                index_t v1 = mesh_.facet_corners.vertex(c1);
-                index_t v2 = mesh_.facet_corners.vertex(c2);
-                if(v1 > v2) {
-                    return false;
-                }
-                if(v1 < v2) {
-                    return true;
-                }
-                c1++;
-                c2++;
-            }
-            return (
-                c1 == mesh_.facets.corners_end(f1) &&
-                c2 != mesh_.facets.corners_end(f2)
-            ) ;
-        }
-
         /**
          * \brief Tests whether two facets are identical.
          * \param[in] f1 index of the first facet
@@ -262,22 +244,30 @@ namespace {
             return true;
         }
 
-        /**
-         * \brief Tests the lexicographic order of two facets by their indices.
-         * \param[in] f1 index of the first facet
-         * \param[in] f2 index of the second facet
-         * \return true if facet \p f1 is before facet \p f2 according to
-         *  the lexicographic order of its vertices, false otherwise.
-         */
-        bool operator() (index_t f1, index_t f2) const {
-            return is_before(f1, f2);
-        }
-
     private:
         const Mesh& mesh_;
     };
 
 
+    /**
+     * \brief Computes a hash key from the vertices of a facet.
+     * \details Facets with the same sequence of vertices have the same
+     *  hash key. Used to detect duplicated facets after their vertices
+     *  were reordered by normalize_facet_vertices_order().
+     * \param[in] M the mesh
+     * \param[in] f the index of the facet in \p M
+     * \return the hash key of \p f
+     */
+    inline Numeric::uint64 facet_hash_key(const Mesh& M, index_t f) {
+        // FNV-1a on the vertex indices
+        Numeric::uint64 result = 14695981039346656037ull;
+        for(index_t c: M.facets.corners(f)) {
+            result ^= Numeric::uint64(M.facet_corners.vertex(c));
+            result *= 1099511628211ull;
+        }
+        return result;
+    }
+
     /**
      * \brief Finds the non-duplicated vertices of a facet
      * \param[in] M a const reference to a mesh
@@ -364,42 +354,58 @@ namespace {
         if(check_duplicates) {
             // Reorder vertices around each facet to make
             // it easier to compare two facets.
-            for(index_t f: M.facets) {
-                normalize_facet_vertices_order(M, f);
-            }
-            // Indirect-sort the facets in lexicographic
-            // order. 
-            vector<index_t> f_sort(M.facets.nb());
-            for(index_t f: M.facets) {
-                f_sort[f] = f;
-            }
+            parallel_for(
+                0, M.facets.nb(),
+                [&M](index_t f) {
+                    normalize_facet_vertices_order(M, f);
+                }
+            );
+            // Sort the (hash key, facet) pairs. Duplicated facets
+            // have the same hash key, and thus appear in contiguous
+            // sequences, ordered by facet index.
+            vector<std::pair<Numeric::uint64, index_t> > f_sort(
+                M.facets.nb()
+            );
+            parallel_for(
+                0, M.facets.nb(),
+                [&M, &f_sort](index_t f) {
+                    f_sort[f] = std::make_pair(facet_hash_key(M, f), f);
+                }
+            );
+            GEO::sort(f_sort.begin(), f_sort.end());
             CompareFacets compare_facets(M);
-            GEO::sort(f_sort.begin(), f_sort.end(), compare_facets);
-            // Now f_sort[0] ... fsort[nb_facets-1] contains the indices
-            // of the sorted facets. This ensures that the indices of the
-            // facets with the same vertices (i.e. duplicated facets)
-            // appear at contiguous sequences in fsort.
-
-            // Traverse in fsort the sequences of duplicate facets. 
-            // The algorithm detects the sequence of indices 
-            // f_sort[if1] ... f_sort[if2-1] that contain facets 
-            // with the same indices.
+
+            // Traverse in f_sort the sequences of facets with the
+            // same hash key, f_sort[if1] ... f_sort[if2-1]. In each
+            // sequence, all the facets but the first instance of
+            // each set of duplicates are tagged as 'to be removed'.
             index_t if1 = 0;
             while(if1 < M.facets.nb()) {
                 index_t if2 = if1 + 1;
                 while(
                     if2 < M.facets.nb() &&
-                    compare_facets.is_same(f_sort[if1], f_sort[if2])
+                    f_sort[if2].first == f_sort[if1].first
                 ) {
-                    nb_duplicates++;
-                    // Tag all facets in f_sort[if1+1] ... f_sort[if2-1] as
-                    // 'to be removed' (because they all have the same vertices
-                    // as f_sort[if1]).
-                    if(remove_f.size() == 0) {
-                        remove_f.resize(M.facets.nb(), 0);
+                    ++if2;
+                }
+                for(index_t i = if1; i + 1 < if2; ++i) {
+                    index_t f1 = f_sort[i].second;
+                    if(remove_f.size() != 0 && remove_f[f1] != 0) {
+                        continue;
+                    }
+                    for(index_t j = i + 1; j < if2; ++j) {
+                        index_t f2 = f_sort[j].second;
+                        if(
+                            (remove_f.size() == 0 || remove_f[f2] == 0) &&
+                            compare_facets.is_same(f1, f2)
+                        ) {
+                            nb_duplicates++;
+                            if(remove_f.size() == 0) {
+                                remove_f.resize(M.facets.nb(), 0);
+                            }
+                            remove_f[f2] = 1;
+                        }
                     }
-                    remove_f[f_sort[if2]] = 1;
-                    if2++;
                 }
                 if1 = if2;
             }
@@ -408,10 +414,17 @@ namespace {
         // Now, we tag the degenerate facets as 'to be removed'. A
         // facet is degenerate if it is incident to the same vertex several
         // times.
+        vector<Numeric::uint8> degenerate(M.facets.nb());
+        parallel_for(
+            0, M.facets.nb(),
+            [&M, &degenerate](index_t f) {
+                degenerate[f] = facet_is_degenerate(M, f) ? 1 : 0;
+            }
+        );
         for(index_t f: M.facets) {
             if(
                 (remove_f.size() == 0 || remove_f[f] == 0) &&
-                facet_is_degenerate(M, f)
+                degenerate[f] != 0
             ) {
                 nb_degenerate++;
                 if(remove_f.size() == 0) {
@@ -515,21 +528,13 @@ namespace {
     void repair_connect_facets(
         Mesh& M
     ) {
-        const index_t NON_MANIFOLD=index_t(-2);
-
         // Reset all facet-facet adjacencies.
-        for(index_t c: M.facet_corners) {
-            M.facet_corners.set_adjacent_facet(c,NO_FACET);
-        }
-
-        // For each vertex v, v2c[v] gives the index of a 
-        // corner incident to vertex v.
-        vector<index_t> v2c(M.vertices.nb(),NO_CORNER);
-
-        // For each corner c, next_c_around_v[c] is the 
-        // linked list of all the corners incident to 
-        // vertex v.
-        vector<index_t> next_c_around_v(M.facet_corners.nb(),NO_CORNER);
+        parallel_for(
+            0, M.facet_corners.nb(),
+            [&M](index_t c) {
+                M.facet_corners.set_adjacent_facet(c,NO_FACET);
+            }
+        );
 
         // For each corner c, c2f[c] is the index of
         // the facet incident to c (or use c/3 if
@@ -537,80 +542,62 @@ namespace {
         vector<index_t> c2f;
         if(!M.facets.are_simplices()) {
             c2f.assign(M.facet_corners.nb(), NO_FACET);
+            parallel_for(
+                0, M.facets.nb(),
+                [&M, &c2f](index_t f) {
+                    for(index_t c: M.facets.corners(f)) {
+                        c2f[c]=f;
+                    }
+                }
+            );
         }
 
-        // Compute v2c and next_c_around_v
-        for(index_t c: M.facet_corners) {
-            index_t v = M.facet_corners.vertex(c);
-            next_c_around_v[c] = v2c[v];
-            v2c[v] = c;
-        }
-
-        // Compute f2c (only if M is not triangulated, 
-        // because if M is triangulated, we have f2c(c) = c/3).
-        if(!M.facets.are_simplices()) {
-            for(index_t f: M.facets) {
+        //   Each corner c is the origin of a facet edge. The edges are
+        // sorted by their (unoriented) vertices, so that the edges
+        // with the same vertices appear in contiguous sequences,
+        // ordered by corner index.
+        typedef std::pair<index_t, index_t> Edge;
+        vector<std::pair<Edge, index_t> > edges(M.facet_corners.nb());
+        parallel_for(
+            0, M.facets.nb(),
+            [&M, &edges](index_t f) {
                 for(index_t c: M.facets.corners(f)) {
-                    c2f[c]=f;
+                    index_t v1 = M.facet_corners.vertex(c);
+                    index_t v2 = M.facet_corners.vertex(
+                        M.facets.next_corner_around_facet(f,c)
+                    );
+                    edges[c] = std::make_pair(
+                        std::make_pair(std::min(v1,v2), std::max(v1,v2)), c
+                    );
                 }
             }
-        }
-
-        for(index_t f1: M.facets) {
-            for(index_t c1: M.facets.corners(f1)) {
-                if(M.facet_corners.adjacent_facet(c1) == NO_FACET) {
-                    index_t adj_corner = NO_CORNER;
-                    index_t v1=M.facet_corners.vertex(c1);
-                    index_t v2=M.facet_corners.vertex(
-                                   M.facets.next_corner_around_facet(f1,c1)
-                               );
-
-                    index_t c2 = v2c[v1];
-
-                    // Lookup candidate adjacent edges from incident
-                    // edges list.
-                    while(c2 != NO_CORNER) {
-                        if(c2 != c1) {
-                            index_t f2 =
-                                M.facets.are_simplices() ? c2/3 : c2f[c2];
-                            index_t c3 =
-                                M.facets.prev_corner_around_facet(f2,c2);
-                            index_t v3 = M.facet_corners.vertex(c3);
-                            // Check with standard orientation.
-                            if(v3 == v2) {
-                                if(adj_corner == NO_CORNER) {
-                                    adj_corner = c3;
-                                } else {
-                                    adj_corner = NON_MANIFOLD;
-                                }
-                            } else {
-                                // Check with the other ("wrong") orientation
-                                c3 = M.facets.next_corner_around_facet(f2,c2);
-                                v3 = M.facet_corners.vertex(c3);
-                                if(v3 == v2) {
-                                    if(adj_corner == NO_CORNER) {
-                                        adj_corner = c2;
-                                    } else {
-                                        adj_corner = NON_MANIFOLD;
-                                    }
-                                }
-                            }
-                        }
-                        c2 = next_c_around_v[c2];
-                    }
-                    if(
-                        adj_corner != NO_CORNER && 
-                        adj_corner != NON_MANIFOLD
-                    ) {
-                        M.facet_corners.set_adjacent_facet(adj_corner,f1);
-                        index_t f2 = M.facets.are_simplices() ? 
-                                     adj_corner/3 : 
-                                     c2f[adj_corner] ;
-                        M.facet_corners.set_adjacent_facet(c1,f2);
-                    } 
+        );
+        GEO::sort(edges.begin(), edges.end());
+
+        //   Two facets are connected if they share an edge that no
+        // other facet has (with the same or the other orientation).
+        // Sequences of more than two edges are non-manifold and
+        // stay disconnected.
+        index_t nb_edges = index_t(edges.size());
+        parallel_for(
+            0, nb_edges,
+            [&](index_t i) {
+                if(
+                    i+1 >= nb_edges ||
+                    edges[i+1].first != edges[i].first ||
+                    (i > 0 && edges[i-1].first == edges[i].first) ||
+                    (i+2 < nb_edges && edges[i+2].first == edges[i].first)
+                ) {
+                    return;
                 }
+                index_t c1 = edges[i].second;
+                index_t c2 = edges[i+1].second;
+                index_t f1 = M.facets.are_simplices() ? c1/3 : c2f[c1];
+                index_t f2 = M.facets.are_simplices() ? c2/3 : c2f[c2];
+                M.facet_corners.set_adjacent_facet(c1,f2);
+                M.facet_corners.set_adjacent_facet(c2,f1);
             }
-        }
+        );
     }
 
     /************************************************************************/
@@ -674,21 +661,21 @@ namespace {
      * \param[in,out] visited a vector used to mark facets that were
      *  already traversed
      * \param[out] moebius_count number of Moebius loops encountered
-     * \param[out] moebius_facets a pointer to a vector. On exit,
-     *  *moebius_facets[f] has a non-zero value if facet f is
-     *  incident to an edge that could not be consistently oriented.
+     * \param[out] moebius_facets a pointer to a vector of size
+     *  M.facets.nb(). On exit, *moebius_facets[f] is set to 1 if facet f
+     *  is incident to an edge that could not be consistently oriented.
      *  If nullptr, then this information is not returned.
      */
     void repair_propagate_orientation(
-        Mesh& M, index_t f, const std::vector<bool>& visited,
+        Mesh& M, index_t f, const vector<Numeric::uint8>& visited,
         index_t& moebius_count,
-        vector<index_t>* moebius_facets = nullptr
+        vector<Numeric::uint8>* moebius_facets = nullptr
     ) {
         index_t nb_plus = 0;
         index_t nb_minus = 0;
         for(index_t c: M.facets.corners(f)) {
             index_t f2 = M.facet_corners.adjacent_facet(c);
-            if(f2 != NO_FACET && visited[index_t(f2)]) {
+            if(f2 != NO_FACET && visited[f2] != 0) {
                 signed_index_t ori = 
                     repair_relative_orientation(M, f, c, f2);
                 switch(ori) {
@@ -706,7 +693,6 @@ namespace {
         if(nb_plus != 0 && nb_minus != 0) {
             moebius_count++;
             if(moebius_facets != nullptr) {
-                moebius_facets->resize(M.facets.nb(), 0);
                 (*moebius_facets)[f] = 1;
                 for(index_t c: M.facets.corners(f)) {
                     index_t f2 = M.facet_corners.adjacent_facet(c);
@@ -720,7 +706,7 @@ namespace {
                 for(index_t c: M.facets.corners(f)) {
                     index_t f2 = M.facet_corners.adjacent_facet(c);
                     if(
-                        f2 != NO_FACET && visited[f2] &&
+                        f2 != NO_FACET && visited[f2] != 0 &&
                         repair_relative_orientation(M, f, c, f2) < 0
                     ) {
                         repair_dissociate(M, f, f2);
@@ -731,7 +717,7 @@ namespace {
                 for(index_t c: M.facets.corners(f)) {
                     index_t f2 = M.facet_corners.adjacent_facet(c);
                     if(
-                        f2 != NO_FACET && visited[index_t(f2)] &&
+                        f2 != NO_FACET && visited[f2] != 0 &&
                         repair_relative_orientation(M, f, c, f2) > 0
                     ) {
                         repair_dissociate(M, f, f2);
@@ -780,23 +766,37 @@ namespace {
     ) {
         geo_assert(max_iter < 256);
         D.assign(M.facets.nb(), facet_distance_t(max_iter));
-        for(index_t f: M.facets) {
-            if(facet_is_on_border(M, f)) {
-                D[f] = facet_distance_t(0);
+        parallel_for(
+            0, M.facets.nb(),
+            [&M, &D](index_t f) {
+                if(facet_is_on_border(M, f)) {
+                    D[f] = facet_distance_t(0);
+                }
             }
-        }
-        for(signed_index_t i = 1; i < signed_index_t(max_iter); i++) {
-            for(index_t f: M.facets) {
-                if(D[f] == signed_index_t(max_iter)) {
+        );
+        // Each iteration reads the distances of the previous one, so that
+        // facets can be updated in parallel.
+        vector<facet_distance_t> prev_D;
+        for(index_t i = 1; i < max_iter; i++) {
+            prev_D = D;
+            parallel_for(
+                0, M.facets.nb(),
+                [&M, &D, &prev_D, i, max_iter](index_t f) {
+                    if(prev_D[f] != facet_distance_t(max_iter)) {
+                        return;
+                    }
                     for(index_t c: M.facets.corners(f)) {
                         index_t g = M.facet_corners.adjacent_facet(c);
-                        if(g != NO_FACET && D[g] == facet_distance_t(i - 1)) {
+                        if(
+                            g != NO_FACET &&
+                            prev_D[g] == facet_distance_t(i - 1)
+                        ) {
                             D[f] = facet_distance_t(i);
                             break;
                         }
                     }
                 }
-            }
+            );
         }
     }
 
@@ -881,42 +881,70 @@ namespace {
     ) {
         const int max_iter = 5;
         vector<facet_distance_t> D;
-        std::vector<bool> visited(M.facets.nb(), false);
         compute_border_distance(M, D, max_iter);
-        SimplePriorityQueue Q(D, max_iter);
 
-        index_t moebius_count = 0;
-        index_t nb_visited = 0;
-        for(signed_index_t i = max_iter; i >= 0; i--) {
-            for(index_t f: M.facets) {
-                if(!visited[f] && D[f] == i) {
-                    Q.push(f);
-                    visited[f] = true;
-                    nb_visited++;
-                    while(!Q.empty()) {
-                        index_t f1 = Q.pop();
-                        for(index_t c: M.facets.corners(f1)) {
-                            index_t f2 = M.facet_corners.adjacent_facet(c);
-                            if(f2 != NO_FACET && !visited[f2]) {
-                                visited[f2] = true;
-                                nb_visited++;
-                                repair_propagate_orientation(
-                                    M, f2, visited, 
-                                    moebius_count, moebius_facets
-                                );
-                                Q.push(f2);
-                            }
+        //   Each connected component is traversed from its facet that is
+        // the furthest away from the border (the first one if there are
+        // several). The traversal of a connected component only
+        // modifies the facets of the component, thus connected
+        // components are processed in parallel.
+        vector<index_t> component;
+        index_t nb_components = get_connected_components(M, component);
+        vector<index_t> seed(nb_components, NO_FACET);
+        for(index_t f: M.facets) {
+            index_t& s = seed[component[f]];
+            if(s == NO_FACET || D[f] > D[s]) {
+                s = f;
+            }
+        }
+
+        vector<Numeric::uint8> visited(M.facets.nb(), 0);
+        vector<Numeric::uint8> moebius;
+        if(moebius_facets != nullptr) {
+            moebius.assign(M.facets.nb(), 0);
+        }
+        vector<index_t> moebius_count(nb_components, 0);
+
+        parallel_for(
+            0, nb_components,
+            [&](index_t comp) {
+                SimplePriorityQueue Q(D, max_iter);
+                Q.push(seed[comp]);
+                visited[seed[comp]] = 1;
+                while(!Q.empty()) {
+                    index_t f1 = Q.pop();
+                    for(index_t c: M.facets.corners(f1)) {
+                        index_t f2 = M.facet_corners.adjacent_facet(c);
+                        if(f2 != NO_FACET && visited[f2] == 0) {
+                            visited[f2] = 1;
+                            repair_propagate_orientation(
+                                M, f2, visited, moebius_count[comp],
+                                (moebius_facets == nullptr) ?
+                                nullptr : &moebius
+                            );
+                            Q.push(f2);
                         }
                     }
                 }
-                if(nb_visited == M.facets.nb()) {
-                    break;
+            },
+            1, true // interleaved, for load balancing
+        );
+
+        index_t total_moebius_count = 0;
+        for(index_t comp=0; comp<nb_components; ++comp) {
+            total_moebius_count += moebius_count[comp];
+        }
+        if(moebius_facets != nullptr && total_moebius_count != 0) {
+            moebius_facets->resize(M.facets.nb(), 0);
+            for(index_t f: M.facets) {
+                if(moebius[f] != 0) {
+                    (*moebius_facets)[f] = 1;
                 }
             }
         }
-        if(moebius_count != 0) {
+        if(total_moebius_count != 0) {
             Logger::out("Validate")
-                << "Encountered " << moebius_count
+                << "Encountered " << total_moebius_count
                 << " ambiguous facet orientation (Moebius)"
                 << std::endl;
         }
@@ -1036,6 +1064,50 @@ namespace {
             
         }
     }
+
+    /************************************************************************/
+
+    /**
+     * \brief Measures the time spent in the stages of mesh_repair().
+     */
+    class RepairTimings {
+    public:
+        /**
+         * \brief RepairTimings constructor.
+         * \details Starts measuring the time of the first stage.
+         */
+        RepairTimings() : W_("Validate", false), last_time_(0.0) {
+        }
+
+        /**
+         * \brief Records the end of a stage.
+         * \details Starts measuring the time of the next stage.
+         * \param[in] name the name of the stage
+         */
+        void end_stage(const std::string& name) {
+            double t = W_.elapsed_time();
+            stages_.push_back(std::make_pair(name, t - last_time_));
+            last_time_ = t;
+        }
+
+        /**
+         * \brief Displays the time spent in all the recorded stages.
+         */
+        void show() const {
+            std::ostringstream out;
+            for(const std::pair<std::string, double>& stage : stages_) {
+                out << stage.first << ":" << stage.second << "s ";
+            }
+            Logger::out("Validate") << "Timings: " << out.str()
+                                    << "(total:" << last_time_ << "s)"
+                                    << std::endl;
+        }
+
+    private:
+        Stopwatch W_;
+        double last_time_;
+        std::vector<std::pair<std::string, double> > stages_;
+    };
 }
 
 /****************************************************************************/
@@ -1047,20 +1119,27 @@ namespace GEO {
     ) {
         index_t nb_vertices_in = M.vertices.nb();
         index_t nb_facets_in = M.facets.nb();
+        RepairTimings timings;
         
         if(mode & MESH_REPAIR_COLOCATE) {
             repair_colocate_vertices(M, colocate_epsilon);
+            timings.end_stage("colocate");
         }
         if(mode & MESH_REPAIR_TRIANGULATE) {
             M.facets.triangulate();
+            timings.end_stage("triangulate");
         }
         repair_remove_bad_facets(
             M, (mode & MESH_REPAIR_DUP_F) != 0
         );
+        timings.end_stage("bad_facets");
 
         repair_connect_facets(M);
+        timings.end_stage("connect");
         repair_reorient_facets_anti_moebius(M);
+        timings.end_stage("reorient");
         repair_split_non_manifold_vertices(M);
+        timings.end_stage("non_manifold");
 
         if(
             (mode & MESH_REPAIR_RECONSTRUCT) != 0
@@ -1090,7 +1169,7 @@ namespace GEO {
             repair_connect_facets(M);
             repair_reorient_facets_anti_moebius(M);
             repair_split_non_manifold_vertices(M);
-
+            timings.end_stage("reconstruct");
         }
 	
         if((mode & MESH_REPAIR_QUIET) == 0) {
@@ -1100,6 +1179,7 @@ namespace GEO {
 	    ) {
 		M.show_stats("Validate");
 	    }
+            timings.show();
         }
     }
 
@@ -0,0 +1,406 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+
+#include <geogram/mesh/mesh_sampling.h>
+#include <geogram/basic/process.h>
+#include <geogram/basic/algorithm.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Weighted sample elimination [Yuksel 2015].
+     */
+    class SampleElimination {
+    public:
+
+        /**
+         * \brief SampleElimination constructor.
+         * \param[in] candidates the candidate samples
+         * \param[in] nb_candidates number of candidate samples
+         * \param[in] dim dimension of the samples
+         * \param[in] nb_samples number of samples to be kept
+         * \param[in] r_max maximum Poisson-disk radius
+         */
+        SampleElimination(
+            const double* candidates, index_t nb_candidates, index_t dim,
+            index_t nb_samples, double r_max
+        ) :
+            candidates_(candidates),
+            nb_candidates_(nb_candidates),
+            dim_(dim),
+            r_max_(r_max) {
+            // Parameters recommended in [Yuksel 2015]
+            const double alpha_gamma = 1.5;
+            const double beta = 0.65;
+            r_min_ = r_max_ * beta * (
+                1.0 - ::pow(
+                    double(nb_samples) / double(nb_candidates), alpha_gamma
+                )
+            );
+            create_grid();
+        }
+
+        /**
+         * \brief Removes candidates until \p nb_samples remain.
+         * \details Internally, the candidates are indexed in the order
+         *  of the grid cells, for data locality.
+         * \param[out] samples the remaining candidates, in their
+         *  initial order
+         * \param[in] nb_samples number of samples to be kept
+         */
+        void eliminate(double* samples, index_t nb_samples) {
+            // Indexed 4-ary max-heap of the candidates, ordered by weight.
+            heap_.resize(nb_candidates_);
+            heap_pos_.resize(nb_candidates_);
+            parallel_for(
+                0, nb_candidates_,
+                [this](index_t i) {
+                    double w = 0.0;
+                    for_each_neighbor(
+                        i, [&](index_t, double d) { w += weight(d); }
+                    );
+                    heap_[i].weight = w;
+                    heap_[i].candidate = i;
+                    heap_pos_[i] = i;
+                }
+            );
+            for(index_t i = nb_candidates_ / 4 + 1; i > 0; --i) {
+                sift_down(i - 1);
+            }
+
+            vector<bool> removed(nb_candidates_, false);
+            index_t heap_size = nb_candidates_;
+            while(heap_size > nb_samples) {
+                index_t i = heap_[0].candidate;
+                --heap_size;
+                heap_swap(0, heap_size);
+                heap_.resize(heap_size);
+                sift_down(0);
+                removed[i] = true;
+                for_each_neighbor(
+                    i, [&](index_t j, double d) {
+                        if(!removed[j]) {
+                            heap_[heap_pos_[j]].weight -= weight(d);
+                            sift_down(heap_pos_[j]);
+                        }
+                    }
+                );
+            }
+
+            vector<bool> kept(nb_candidates_, false);
+            for(index_t i = 0; i < nb_candidates_; ++i) {
+                kept[sorted_[i]] = !removed[i];
+            }
+            index_t k = 0;
+            for(index_t i = 0; i < nb_candidates_; ++i) {
+                if(kept[i]) {
+                    for(index_t c = 0; c < dim_; ++c) {
+                        samples[k * dim_ + c] = candidates_[i * dim_ + c];
+                    }
+                    ++k;
+                }
+            }
+            geo_assert(k == nb_samples);
+        }
+
+    protected:
+
+        /**
+         * \brief Gets a candidate.
+         * \param[in] i index of the candidate, in the order of the 
+         *  grid cells
+         * \return a const pointer to the coordinates of the candidate
+         */
+        const double* candidate(index_t i) const {
+            return points_.data() + i * dim_;
+        }
+
+        /**
+         * \brief Computes the weight of a neighbor.
+         * \param[in] d the distance to the neighbor
+         * \return the contribution of the neighbor to the weight
+         */
+        double weight(double d) const {
+            // Weight limiting: neighbors closer than 2 r_min all
+            // have the same weight.
+            d = std::max(d, 2.0 * r_min_);
+            double w = 1.0 - d / (2.0 * r_max_);
+            w *= w;
+            w *= w;
+            return w * w;
+        }
+
+        /**
+         * \brief Computes the key of a grid cell.
+         * \param[in] cell the integer coordinates of the cell
+         * \return the key of the cell
+         */
+        static Numeric::uint64 cell_key(const signed_index_t* cell) {
+            return
+                (Numeric::uint64(cell[0]) << 42) |
+                (Numeric::uint64(cell[1]) << 21) |
+                Numeric::uint64(cell[2]);
+        }
+
+        /**
+         * \brief Computes the cell that contains a point.
+         * \param[in] p the coordinates of the point
+         * \param[out] cell the integer coordinates of the cell
+         */
+        void get_cell(const double* p, signed_index_t* cell) const {
+            for(index_t c = 0; c < 3; ++c) {
+                cell[c] = (c < dim_) ? signed_index_t(
+                    (p[c] - origin_[c]) / cell_size_
+                ) : 0;
+            }
+        }
+
+        /**
+         * \brief Sorts the candidates by grid cell.
+         * \details Cells are of size 2 r_max, so that all the
+         *  neighbors of a candidate are in the 27 cells around it.
+         */
+        void create_grid() {
+            const index_t max_cells = index_t(1) << 20;
+            double extent = 0.0;
+            for(index_t c = 0; c < 3; ++c) {
+                origin_[c] = 0.0;
+                if(c >= dim_) {
+                    continue;
+                }
+                double x_min = Numeric::max_float64();
+                double x_max = -Numeric::max_float64();
+                for(index_t i = 0; i < nb_candidates_; ++i) {
+                    x_min = std::min(x_min, candidates_[i * dim_ + c]);
+                    x_max = std::max(x_max, candidates_[i * dim_ + c]);
+                }
+                origin_[c] = x_min;
+                extent = std::max(extent, x_max - x_min);
+            }
+            cell_size_ = std::max(
+                2.0 * r_max_, extent / double(max_cells)
+            );
+
+            vector<std::pair<Numeric::uint64, index_t> > keys(
+                nb_candidates_
+            );
+            parallel_for(
+                0, nb_candidates_,
+                [&](index_t i) {
+                    signed_index_t cell[3];
+                    get_cell(candidates_ + i * dim_, cell);
+                    keys[i] = std::make_pair(cell_key(cell), i);
+                }
+            );
+            GEO::sort(keys.begin(), keys.end());
+
+            sorted_.resize(nb_candidates_);
+            points_.resize(nb_candidates_ * dim_);
+            cell_keys_.clear();
+            cell_begin_.clear();
+            for(index_t k = 0; k < nb_candidates_; ++k) {
+                sorted_[k] = keys[k].second;
+                for(index_t c = 0; c < dim_; ++c) {
+                    points_[k * dim_ + c] =
+                        candidates_[keys[k].second * dim_ + c];
+                }
+                if(k == 0 || keys[k].first != keys[k - 1].first) {
+                    cell_keys_.push_back(keys[k].first);
+                    cell_begin_.push_back(k);
+                }
+            }
+            cell_begin_.push_back(nb_candidates_);
+        }
+
+        /**
+         * \brief Calls a function for each neighbor of a candidate.
+         * \param[in] i index of the candidate
+         * \param[in] f function called with the index of each candidate
+         *  closer than 2 r_max to \p i and its distance to \p i
+         * \tparam FUNC type of the function
+         */
+        template <class FUNC> void for_each_neighbor(
+            index_t i, const FUNC& f
+        ) const {
+            double d2_max = geo_sqr(2.0 * r_max_);
+            signed_index_t cell[3];
+            get_cell(candidate(i), cell);
+            // The three cells along the z axis are consecutive in
+            // the grid order, thus each column of cells is a 
+            // contiguous range of candidates.
+            signed_index_t neigh[3];
+            for(neigh[0] = cell[0] - 1; neigh[0] <= cell[0] + 1; ++neigh[0]) {
+            for(neigh[1] = cell[1] - 1; neigh[1] <= cell[1] + 1; ++neigh[1]) {
+                if(neigh[0] < 0 || neigh[1] < 0) {
+                    continue;
+                }
+                neigh[2] = std::max(cell[2] - 1, signed_index_t(0));
+                Numeric::uint64 key_begin = cell_key(neigh);
+                neigh[2] = cell[2] + 1;
+                Numeric::uint64 key_end = cell_key(neigh) + 1;
+                index_t c_begin = index_t(
+                    std::lower_bound(
+                        cell_keys_.begin(), cell_keys_.end(), key_begin
+                    ) - cell_keys_.begin()
+                );
+                index_t c_end = c_begin;
+                while(
+                    c_end < cell_keys_.size() && cell_keys_[c_end] < key_end
+                ) {
+                    ++c_end;
+                }
+                index_t k_end = cell_begin_[c_end];
+                for(index_t j = cell_begin_[c_begin]; j < k_end; ++j) {
+                    if(j == i) {
+                        continue;
+                    }
+                    double d2 = 0.0;
+                    for(index_t coord = 0; coord < dim_; ++coord) {
+                        d2 += geo_sqr(
+                            candidate(i)[coord] - candidate(j)[coord]
+                        );
+                    }
+                    if(d2 < d2_max) {
+                        f(j, ::sqrt(d2));
+                    }
+                }
+            }
+            }
+        }
+
+        /**
+         * \brief An entry of the heap.
+         * \details The weight is stored in the entry for data locality.
+         */
+        struct HeapEntry {
+            double weight;
+            index_t candidate;
+        };
+
+        /**
+         * \brief Tests the order of two entries of the heap.
+         * \param[in] e1 , e2 two entries
+         * \return true if the candidate of \p e1 should be removed
+         *  before the one of \p e2
+         */
+        static bool heap_less(const HeapEntry& e1, const HeapEntry& e2) {
+            return e1.weight > e2.weight || (
+                e1.weight == e2.weight && e1.candidate < e2.candidate
+            );
+        }
+
+        /**
+         * \brief Swaps two entries of the heap.
+         * \param[in] k1 , k2 the two positions in the heap
+         */
+        void heap_swap(index_t k1, index_t k2) {
+            std::swap(heap_[k1], heap_[k2]);
+            heap_pos_[heap_[k1].candidate] = k1;
+            heap_pos_[heap_[k2].candidate] = k2;
+        }
+
+        /**
+         * \brief Moves down an entry of the heap, after its
+         *  weight decreased.
+         * \param[in] k position in the heap
+         */
+        void sift_down(index_t k) {
+            index_t n = index_t(heap_.size());
+            for(;;) {
+                index_t best = k;
+                index_t first_child = 4 * k + 1;
+                index_t last_child = std::min(first_child + 4, n);
+                for(index_t c = first_child; c < last_child; ++c) {
+                    if(heap_less(heap_[c], heap_[best])) {
+                        best = c;
+                    }
+                }
+                if(best == k) {
+                    return;
+                }
+                heap_swap(k, best);
+                k = best;
+            }
+        }
+
+    private:
+        const double* candidates_;
+        index_t nb_candidates_;
+        index_t dim_;
+        double r_max_;
+        double r_min_;
+
+        double origin_[3];
+        double cell_size_;
+        vector<double> points_;
+        vector<index_t> sorted_;
+        vector<Numeric::uint64> cell_keys_;
+        vector<index_t> cell_begin_;
+
+        vector<HeapEntry> heap_;
+        vector<index_t> heap_pos_;
+    };
+}
+
+namespace GEO {
+
+    void blue_noise_sample_elimination(
+        const double* candidates, index_t nb_candidates, index_t dim,
+        double* samples, index_t nb_samples, double r_max
+    ) {
+        geo_assert(nb_samples <= nb_candidates);
+        if(nb_samples == 0) {
+            return;
+        }
+        SampleElimination elimination(
+            candidates, nb_candidates, dim, nb_samples, r_max
+        );
+        elimination.eliminate(samples, nb_samples);
+    }
+}
+
@@ -51,6 +51,7 @@
 #include <geogram/mesh/mesh_geometry.h>
 #include <geogram/basic/geometry_nd.h>
 #include <geogram/basic/logger.h>
+#include <geogram/basic/process.h>
 #include <algorithm>
 
 /**
@@ -116,6 +117,13 @@ namespace GEO {
      *  index of the facet sequence in which points should be generated.
      *  If left unspecified (-1), points are generated over all the facets
      *  of the mesh.
+     * \details The samples are stratified along the facets: the cumulated
+     *  mass of the facets is split into \p nb_points intervals of equal
+     *  size, and sample i is drawn at random in the i-th interval. Thus
+     *  the samples are sorted by facet, which improves data locality.
+     *  The samples are computed in parallel, using a counter-based 
+     *  random number generator, so that the result does not depend on
+     *  the number of threads.
      * \tparam DIM dimension of the points, specified as a template argument
      *  for efficiency reasons
      * \return true if everything went OK, false otherwise. Whenever all the
@@ -146,55 +154,69 @@ namespace GEO {
 
         typedef vecng<DIM, double> Point;
 
-        // To ensure reproducibility accros successive
-        // runs, reset the random number generator.
-        Numeric::random_reset();
-
-        vector<double> s(nb_points);
-        for(index_t i = 0; i < nb_points; i++) {
-            s[i] = Numeric::random_float64();
-        }
-        std::sort(s.begin(), s.end());
-
-        double Atot = 0.0;
-        for(index_t t = facets_begin; t < facets_end; ++t) {
-            double At = mesh_facet_mass<DIM>(mesh, t, weight);
-            Atot += At;
-        }
-
-        signed_index_t first_t = -1;
-        signed_index_t last_t = 0;
-
-        index_t cur_t = facets_begin;
-        double cur_s =
-            mesh_facet_mass<DIM>(mesh, facets_begin, weight) / Atot;
-        for(index_t i = 0; i < nb_points; i++) {
-            geo_debug_assert(i < s.size());
-            while(s[i] > cur_s && cur_t < facets_end - 1) {
-                cur_t++;
-                geo_debug_assert(cur_t < facets_end);
-                cur_s += mesh_facet_mass<DIM>(mesh, cur_t, weight) / Atot;
+        // Cumulated masses of the facets
+        index_t nb_facets = facets_end - facets_begin;
+        vector<double> cumul(nb_facets);
+        parallel_for(
+            0, nb_facets,
+            [&](index_t i) {
+                cumul[i] = mesh_facet_mass<DIM>(
+                    mesh, facets_begin + i, weight
+                );
             }
-            if(first_t == -1) {
-                first_t = signed_index_t(cur_t);
-            }
-            last_t = std::max(last_t, signed_index_t(cur_t));
-
-            // TODO: take weights into account
-            //  with a new random_point_in_triangle_weighted()
-            //  function.
-            index_t v1 = mesh.facets.vertex(cur_t,0);
-            index_t v2 = mesh.facets.vertex(cur_t,1);
-            index_t v3 = mesh.facets.vertex(cur_t,2);            
-            Point cur_p = Geom::random_point_in_triangle(
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v1)),
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v2)),
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v3))
+        );
+        for(index_t i = 1; i < nb_facets; ++i) {
+            cumul[i] += cumul[i - 1];
+        }
+        double Atot = cumul[nb_facets - 1];
+
+        // Each sample uses three numbers of the random stream:
+        // one to choose the facet and two for the barycentric
+        // coordinates.
+        auto sample_facet = [&](index_t i)->index_t {
+            double s = Atot * (
+                double(i) + Numeric::random_float64(0, 3 * Numeric::uint64(i))
+            ) / double(nb_points);
+            index_t t = index_t(
+                std::upper_bound(cumul.begin(), cumul.end(), s) -
+                cumul.begin()
             );
-            for(coord_index_t coord = 0; coord < DIM; coord++) {
-                p[i * DIM + coord] = cur_p[coord];
+            return facets_begin + std::min(t, nb_facets - 1);
+        };
+
+        parallel_for(
+            0, nb_points,
+            [&](index_t i) {
+                index_t t = sample_facet(i);
+                Numeric::uint64 counter = 3 * Numeric::uint64(i);
+                // TODO: take weights into account
+                //  with a new random_point_in_triangle_weighted()
+                //  function.
+                index_t v1 = mesh.facets.vertex(t,0);
+                index_t v2 = mesh.facets.vertex(t,1);
+                index_t v3 = mesh.facets.vertex(t,2);            
+                Point cur_p = Geom::random_point_in_triangle(
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v1)
+                    ),
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v2)
+                    ),
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v3)
+                    ),
+                    Numeric::random_float64(0, counter + 1),
+                    Numeric::random_float64(0, counter + 2)
+                );
+                for(coord_index_t coord = 0; coord < DIM; coord++) {
+                    p[i * DIM + coord] = cur_p[coord];
+                }
             }
-        }
+        );
+
+        // Samples are sorted by facet.
+        index_t first_t = sample_facet(0);
+        index_t last_t = sample_facet(nb_points - 1);
         if(mesh.facets.nb() > 1 && last_t == first_t) {
             Logger::warn("Sampler")
                 << "Did put all the points in the same triangle"
@@ -284,6 +306,9 @@ namespace GEO {
      *  index of the tetrahedron sequence in which points should be generated.
      *  If left unspecified (-1), points are generated over all the tetrahedra
      *  of the mesh.
+     * \details As in mesh_generate_random_samples_on_surface(), the 
+     *  samples are stratified along the tetrahedra and computed in 
+     *  parallel, independently of the number of threads.
      * \tparam DIM dimension of the points, specified as a template argument
      *  for efficiency reasons
      * \return true if everything went OK, false otherwise. Whenever all the
@@ -313,60 +338,75 @@ namespace GEO {
 
         typedef vecng<DIM, double> Point;
 
-        // To ensure reproducibility accros successive
-        // runs, reset the random number generator.
-        Numeric::random_reset();
-
-        vector<double> s(nb_points);
-        for(index_t i = 0; i < nb_points; i++) {
-            s[i] = Numeric::random_float64();
-        }
-        std::sort(s.begin(), s.end());
-
-        double Vtot = 0.0;
-        for(index_t t = tets_begin; t < tets_end; ++t) {
-            double Vt = mesh_tetra_mass<DIM>(mesh, t, vertex_weight);
-            Vtot += Vt;
-        }
-
-        signed_index_t first_t = -1;
-        signed_index_t last_t = 0;
-
-        index_t cur_t = tets_begin;
-        double cur_s =
-            mesh_tetra_mass<DIM>(mesh, tets_begin, vertex_weight) / Vtot;
-        for(index_t i = 0; i < nb_points; i++) {
-            geo_debug_assert(i < s.size());
-            while(s[i] > cur_s && cur_t < tets_end - 1) {
-                cur_t++;
-                geo_debug_assert(cur_t < tets_end);
-                cur_s += mesh_tetra_mass<DIM>(
-                    mesh, cur_t, vertex_weight
-                ) / Vtot;
-            }
-            if(first_t == -1) {
-                first_t = signed_index_t(cur_t);
+        // Cumulated masses of the tetrahedra
+        index_t nb_tets = tets_end - tets_begin;
+        vector<double> cumul(nb_tets);
+        parallel_for(
+            0, nb_tets,
+            [&](index_t i) {
+                cumul[i] = mesh_tetra_mass<DIM>(
+                    mesh, tets_begin + i, vertex_weight
+                );
             }
-            last_t = std::max(last_t, signed_index_t(cur_t));
-
-            index_t v0 = mesh.cells.vertex(cur_t, 0);
-            index_t v1 = mesh.cells.vertex(cur_t, 1);
-            index_t v2 = mesh.cells.vertex(cur_t, 2);
-            index_t v3 = mesh.cells.vertex(cur_t, 3);
-
-            // TODO: take weights into account
-            //  with a new random_point_in_tetra_weighted()
-            //  function.
-            Point cur_p = Geom::random_point_in_tetra(
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v0)),
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v1)),
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v2)),
-                *reinterpret_cast<const Point*>(mesh.vertices.point_ptr(v3))
+        );
+        for(index_t i = 1; i < nb_tets; ++i) {
+            cumul[i] += cumul[i - 1];
+        }
+        double Vtot = cumul[nb_tets - 1];
+
+        // Each sample uses four numbers of the random stream:
+        // one to choose the tetrahedron and three for the barycentric
+        // coordinates.
+        auto sample_tet = [&](index_t i)->index_t {
+            double s = Vtot * (
+                double(i) + Numeric::random_float64(0, 4 * Numeric::uint64(i))
+            ) / double(nb_points);
+            index_t t = index_t(
+                std::upper_bound(cumul.begin(), cumul.end(), s) -
+                cumul.begin()
             );
-            for(coord_index_t coord = 0; coord < DIM; coord++) {
-                p[i * DIM + coord] = cur_p[coord];
+            return tets_begin + std::min(t, nb_tets - 1);
+        };
+
+        parallel_for(
+            0, nb_points,
+            [&](index_t i) {
+                index_t t = sample_tet(i);
+                Numeric::uint64 counter = 4 * Numeric::uint64(i);
+                index_t v0 = mesh.cells.vertex(t, 0);
+                index_t v1 = mesh.cells.vertex(t, 1);
+                index_t v2 = mesh.cells.vertex(t, 2);
+                index_t v3 = mesh.cells.vertex(t, 3);
+
+                // TODO: take weights into account
+                //  with a new random_point_in_tetra_weighted()
+                //  function.
+                Point cur_p = Geom::random_point_in_tetra(
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v0)
+                    ),
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v1)
+                    ),
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v2)
+                    ),
+                    *reinterpret_cast<const Point*>(
+                        mesh.vertices.point_ptr(v3)
+                    ),
+                    Numeric::random_float64(0, counter + 1),
+                    Numeric::random_float64(0, counter + 2),
+                    Numeric::random_float64(0, counter + 3)
+                );
+                for(coord_index_t coord = 0; coord < DIM; coord++) {
+                    p[i * DIM + coord] = cur_p[coord];
+                }
             }
-        }
+        );
+
+        // Samples are sorted by tetrahedron.
+        index_t first_t = sample_tet(0);
+        index_t last_t = sample_tet(nb_points - 1);
         if(mesh.cells.nb() > 1 && last_t == first_t) {
             Logger::warn("Sampler")
                 << "Did put all the points in the same triangle"
@@ -375,6 +415,134 @@ namespace GEO {
         }
         return true;
     }
+
+    /************************************************************************/
+
+    /**
+     * \brief Selects a blue-noise subset of a set of samples.
+     * \details Uses weighted sample elimination [Yuksel 2015]: the
+     *  samples that have the largest weight, computed from their 
+     *  neighbors closer than 2 \p r_max, are iteratively removed.
+     *  Neighbors are found with a regular grid over the first three
+     *  coordinates, distances use all the coordinates. The computation
+     *  does not depend on the number of threads.
+     * \param[in] candidates the candidate samples, of size 
+     *  \p nb_candidates times \p dim
+     * \param[in] nb_candidates number of candidate samples
+     * \param[in] dim dimension of the samples
+     * \param[out] samples the selected samples, of size \p nb_samples
+     *  times \p dim, in the same order as in \p candidates. To be 
+     *  allocated by the caller.
+     * \param[in] nb_samples number of samples to select, smaller than 
+     *  or equal to \p nb_candidates
+     * \param[in] r_max maximum Poisson-disk radius that can be achieved
+     *  by \p nb_samples samples in the sampled domain 
+     *  (see mesh_generate_blue_noise_samples_on_surface() and
+     *   mesh_generate_blue_noise_samples_in_volume())
+     */
+    void GEOGRAM_API blue_noise_sample_elimination(
+        const double* candidates, index_t nb_candidates, index_t dim,
+        double* samples, index_t nb_samples, double r_max
+    );
+
+    /**
+     * \brief Generates a set of blue-noise samples over a surfacic mesh.
+     * \details Generates \p oversampling times \p nb_points random samples
+     *  with mesh_generate_random_samples_on_surface(), then selects
+     *  \p nb_points of them with blue_noise_sample_elimination(). The
+     *  vertex weights only influence the candidate samples.
+     *  Parameters are the same as in
+     *  mesh_generate_random_samples_on_surface(), plus:
+     * \param[in] oversampling ratio between the number of candidate
+     *  samples and \p nb_points
+     * \tparam DIM dimension of the points, specified as a template argument
+     *  for efficiency reasons
+     * \return true if everything went OK, false otherwise.
+     */
+    template <index_t DIM>
+    inline bool mesh_generate_blue_noise_samples_on_surface(
+        const Mesh& mesh,
+        double* p,
+        index_t nb_points,
+        Attribute<double>& weight,
+        signed_index_t facets_begin_in = -1,
+        signed_index_t facets_end_in = -1,
+        index_t oversampling = 5
+    ) {
+        index_t nb_candidates = nb_points * oversampling;
+        vector<double> candidates(nb_candidates * DIM);
+        bool result = mesh_generate_random_samples_on_surface<DIM>(
+            mesh, candidates.data(), nb_candidates, weight,
+            facets_begin_in, facets_end_in
+        );
+
+        index_t facets_begin = (facets_begin_in == -1) ?
+            0 : index_t(facets_begin_in);
+        index_t facets_end = (facets_end_in == -1) ?
+            mesh.facets.nb() : index_t(facets_end_in);
+        Attribute<double> no_weight;
+        double area = 0.0;
+        for(index_t f = facets_begin; f < facets_end; ++f) {
+            area += mesh_facet_mass<DIM>(mesh, f, no_weight);
+        }
+
+        // Radius of the densest packing of nb_points disks
+        double r_max = ::sqrt(area / (2.0 * ::sqrt(3.0) * double(nb_points)));
+        blue_noise_sample_elimination(
+            candidates.data(), nb_candidates, DIM, p, nb_points, r_max
+        );
+        return result;
+    }
+
+    /**
+     * \brief Generates a set of blue-noise samples in a volumetric mesh.
+     * \details Generates \p oversampling times \p nb_points random samples
+     *  with mesh_generate_random_samples_in_volume(), then selects
+     *  \p nb_points of them with blue_noise_sample_elimination(). The
+     *  vertex weights only influence the candidate samples.
+     *  Parameters are the same as in
+     *  mesh_generate_random_samples_in_volume(), plus:
+     * \param[in] oversampling ratio between the number of candidate
+     *  samples and \p nb_points
+     * \tparam DIM dimension of the points, specified as a template argument
+     *  for efficiency reasons
+     * \return true if everything went OK, false otherwise.
+     */
+    template <index_t DIM>
+    inline bool mesh_generate_blue_noise_samples_in_volume(
+        const Mesh& mesh,
+        double* p,
+        index_t nb_points,
+        Attribute<double>& vertex_weight,
+        signed_index_t tets_begin_in = -1,
+        signed_index_t tets_end_in = -1,
+        index_t oversampling = 5
+    ) {
+        index_t nb_candidates = nb_points * oversampling;
+        vector<double> candidates(nb_candidates * DIM);
+        bool result = mesh_generate_random_samples_in_volume<DIM>(
+            mesh, candidates.data(), nb_candidates, vertex_weight,
+            tets_begin_in, tets_end_in
+        );
+
+        index_t tets_begin = (tets_begin_in == -1) ?
+            0 : index_t(tets_begin_in);
+        index_t tets_end = (tets_end_in == -1) ?
+            mesh.cells.nb() : index_t(tets_end_in);
+        double volume = 0.0;
+        for(index_t t = tets_begin; t < tets_end; ++t) {
+            volume += mesh_tetra_mass<DIM>(mesh, t);
+        }
+
+        // Radius of the densest packing of nb_points spheres
+        double r_max = ::pow(
+            volume / (4.0 * ::sqrt(2.0) * double(nb_points)), 1.0 / 3.0
+        );
+        blue_noise_sample_elimination(
+            candidates.data(), nb_candidates, DIM, p, nb_points, r_max
+        );
+        return result;
+    }
 }
 
 #endif
@@ -45,23 +45,16 @@
 
 #include <geogram/mesh/mesh_smoothing.h>
 #include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_incidence.h>
 #include <geogram/NL/nl.h>
 
 namespace GEO {
 
     void GEOGRAM_API mesh_smooth(Mesh& M) {
-	// Chain corners around vertices
-	vector<index_t> v2c(M.vertices.nb(), index_t(-1));
-	vector<index_t> next_c_around_v(M.facet_corners.nb(), index_t(-1));
-	vector<index_t> c2f(M.facet_corners.nb(), index_t(-1));
-	for(index_t f: M.facets) {
-	    for(index_t c: M.facets.corners(f)) {
-		index_t v = M.facet_corners.vertex(c);
-		next_c_around_v[c] = v2c[v];
-		v2c[v] = c;
-		c2f[c] = f;
-	    }
-	}
+	// Local incidence table, released on exit (mesh_smooth() is not
+	// a repeated pass, no need to keep it cached in the mesh).
+	MeshVertexIncidence v2f(M);
+	v2f.update(MESH_FACETS);
 
 	nlNewContext();
 
@@ -95,12 +88,22 @@ namespace GEO {
 	for(index_t v: M.vertices) {
 	    nlBegin(NL_ROW);
 	    index_t count = 0;
-	    for(index_t c = v2c[v]; c != index_t(-1); c = next_c_around_v[c]) {
-		index_t f = c2f[c];
-		index_t c2 = M.facets.next_corner_around_facet(f,c);
-		index_t w = M.facet_corners.vertex(c2);
-		nlCoefficient(w, 1.0);
-		++count;
+	    index_t prev_f = NO_FACET;
+	    for(index_t f: v2f.facets(v)) {
+		// A facet appears once per corner incident to v
+		if(f == prev_f) {
+		    continue;
+		}
+		prev_f = f;
+		for(index_t c: M.facets.corners(f)) {
+		    if(M.facet_corners.vertex(c) != v) {
+			continue;
+		    }
+		    index_t c2 = M.facets.next_corner_around_facet(f,c);
+		    index_t w = M.facet_corners.vertex(c2);
+		    nlCoefficient(w, 1.0);
+		    ++count;
+		}
 	    }
 	    nlCoefficient(v, -double(count));
 	    nlEnd(NL_ROW);
@@ -47,6 +47,8 @@
 #include <geogram/mesh/mesh.h>
 #include <geogram/basic/memory.h>
 #include <geogram/basic/logger.h>
+#include <geogram/basic/process.h>
+#include <algorithm>
 #include <stack>
 
 namespace {
@@ -72,39 +74,308 @@ namespace {
         }
         return result;
     }
-}
 
-namespace GEO {
+    /**
+     * \brief The adjacency graph of the facets of a mesh.
+     */
+    class FacetGraph {
+    public:
+        /**
+         * \brief FacetGraph constructor.
+         * \param[in] M the mesh
+         */
+        explicit FacetGraph(const Mesh& M) : M_(M) {
+        }
 
-    index_t get_connected_components(
-        const Mesh& M, vector<index_t>& component
+        /**
+         * \brief Gets the number of nodes.
+         * \return the number of facets
+         */
+        index_t nb() const {
+            return M_.facets.nb();
+        }
+
+        /**
+         * \brief Gets the number of neighbors of a node.
+         * \param[in] f a facet
+         * \return the number of edges of \p f
+         */
+        index_t nb_neighbors(index_t f) const {
+            return M_.facets.nb_vertices(f);
+        }
+
+        /**
+         * \brief Gets a neighbor of a node.
+         * \param[in] f a facet
+         * \param[in] le local index of an edge of \p f
+         * \return the facet adjacent to \p f accross edge \p le,
+         *  or NO_FACET if there is no such facet
+         */
+        index_t neighbor(index_t f, index_t le) const {
+            return M_.facets.adjacent(f, le);
+        }
+
+    private:
+        const Mesh& M_;
+    };
+
+    /**
+     * \brief The adjacency graph of the cells of a mesh.
+     */
+    class CellGraph {
+    public:
+        /**
+         * \brief CellGraph constructor.
+         * \param[in] M the mesh
+         */
+        explicit CellGraph(const Mesh& M) : M_(M) {
+        }
+
+        /**
+         * \brief Gets the number of nodes.
+         * \return the number of cells
+         */
+        index_t nb() const {
+            return M_.cells.nb();
+        }
+
+        /**
+         * \brief Gets the number of neighbors of a node.
+         * \param[in] c a cell
+         * \return the number of facets of \p c
+         */
+        index_t nb_neighbors(index_t c) const {
+            return M_.cells.nb_facets(c);
+        }
+
+        /**
+         * \brief Gets a neighbor of a node.
+         * \param[in] c a cell
+         * \param[in] lf local index of a facet of \p c
+         * \return the cell adjacent to \p c accross facet \p lf,
+         *  or NO_CELL if there is no such cell
+         */
+        index_t neighbor(index_t c, index_t lf) const {
+            return M_.cells.adjacent(c, lf);
+        }
+
+    private:
+        const Mesh& M_;
+    };
+
+    /**
+     * \brief Finds the root of an element in a union-find forest
+     *  and shortens the path (path halving).
+     * \param[in,out] parent the parent of each element
+     * \param[in] x an element
+     * \return the root of \p x
+     */
+    inline index_t find_root(vector<index_t>& parent, index_t x) {
+        while(parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    /**
+     * \brief Merges the sets of two elements in a union-find forest.
+     * \details The root of the merged set is its smallest element.
+     * \param[in,out] parent the parent of each element
+     * \param[in] x , y the two elements
+     */
+    inline void merge_sets(vector<index_t>& parent, index_t x, index_t y) {
+        x = find_root(parent, x);
+        y = find_root(parent, y);
+        if(x < y) {
+            parent[y] = x;
+        } else if(y < x) {
+            parent[x] = y;
+        }
+    }
+
+    /**
+     * \brief Computes the connected components of a graph.
+     * \details Each thread computes the connected components of
+     *  the subgraph induced by its slice of nodes, then the edges
+     *  that cross slices are merged with a union-find forest. Since the root of each
+     *  set is its smallest element, the result does not depend on the
+     *  number of threads.
+     * \tparam GRAPH a class with the same member functions as FacetGraph
+     * \param[in] G the graph
+     * \param[out] component component[x] contains the index of the
+     *  connected component that node x belongs to. Components are
+     *  numbered in the order of their smallest node.
+     * \return the number of connected components
+     */
+    template <class GRAPH> index_t get_graph_connected_components(
+        const GRAPH& G, vector<index_t>& component
     ) {
-        static const index_t NO_COMPONENT = index_t(-1);
-        index_t nb_components = 0;
-        component.assign(M.facets.nb(), NO_COMPONENT);
-        for(index_t f: M.facets) {
-            if(component[f] == NO_COMPONENT) {
+        const index_t UNVISITED = index_t(-1);
+        index_t nb = G.nb();
+        vector<index_t> parent(nb);
+        component.resize(nb);
+        std::vector<std::pair<index_t, index_t> > cross_edges;
+        Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+
+        parallel_for_slice(
+            0, nb,
+            [&](index_t b, index_t e) {
+                std::vector<std::pair<index_t, index_t> > slice_cross_edges;
                 std::stack<index_t> S;
-                S.push(f);
-                component[f] = nb_components;
-                do {
-                    index_t cur_f = S.top();
-                    S.pop();
-                    for(index_t c: M.facets.corners(cur_f)) {
-                        index_t adj_f = M.facet_corners.adjacent_facet(c);
-                        if(adj_f != NO_FACET &&
-                           component[adj_f] == NO_COMPONENT
-                        ) {
-                            S.push(index_t(adj_f));
-                            component[adj_f] = nb_components;
+                for(index_t x=b; x<e; ++x) {
+                    parent[x] = UNVISITED;
+                }
+                // Each node of the slice is attached to the smallest
+                // node of its connected component within the slice.
+                for(index_t x=b; x<e; ++x) {
+                    if(parent[x] != UNVISITED) {
+                        continue;
+                    }
+                    parent[x] = x;
+                    S.push(x);
+                    while(!S.empty()) {
+                        index_t z = S.top();
+                        S.pop();
+                        for(index_t i=0; i<G.nb_neighbors(z); ++i) {
+                            index_t y = G.neighbor(z,i);
+                            if(y >= nb) {
+                                continue;
+                            }
+                            if(y < b || y >= e) {
+                                slice_cross_edges.push_back(
+                                    std::make_pair(z,y)
+                                );
+                            } else if(parent[y] == UNVISITED) {
+                                parent[y] = x;
+                                S.push(y);
+                            }
                         }
                     }
-                } while(!S.empty());
-                nb_components++;
+                }
+                Process::acquire_spinlock(lock);
+                cross_edges.insert(
+                    cross_edges.end(),
+                    slice_cross_edges.begin(), slice_cross_edges.end()
+                );
+                Process::release_spinlock(lock);
+            }
+        );
+
+        for(const std::pair<index_t, index_t>& E : cross_edges) {
+            merge_sets(parent, E.first, E.second);
+        }
+
+        // Find the roots (without path compression, since parent
+        // is shared by all threads).
+        parallel_for(
+            0, nb,
+            [&parent, &component](index_t x) {
+                index_t r = x;
+                while(parent[r] != r) {
+                    r = parent[r];
+                }
+                component[x] = r;
+            }
+        );
+
+        // Number the components in the order of their root, that is,
+        // of their smallest node.
+        index_t nb_components = 0;
+        for(index_t x=0; x<nb; ++x) {
+            if(component[x] == x) {
+                parent[x] = nb_components;
+                ++nb_components;
             }
         }
+        parallel_for(
+            0, nb,
+            [&parent, &component](index_t x) {
+                component[x] = parent[component[x]];
+            }
+        );
         return nb_components;
     }
+}
+
+namespace GEO {
+
+    index_t get_connected_components(
+        const Mesh& M, vector<index_t>& component
+    ) {
+        return get_graph_connected_components(FacetGraph(M), component);
+    }
+
+    index_t get_cell_connected_components(
+        const Mesh& M, vector<index_t>& component
+    ) {
+        return get_graph_connected_components(CellGraph(M), component);
+    }
+
+    void parallel_for_each_component(
+        const vector<index_t>& component, index_t nb_components,
+        std::function<void(index_t, range<const index_t*>)> func
+    ) {
+        // Elements of each component, sorted by index
+        // (compressed sparse row format).
+        vector<index_t> ptr(nb_components + 1, 0);
+        for(index_t i=0; i<component.size(); ++i) {
+            ++ptr[component[i]+1];
+        }
+        for(index_t c=0; c<nb_components; ++c) {
+            ptr[c+1] += ptr[c];
+        }
+        vector<index_t> elements(component.size());
+        {
+            vector<index_t> pos(nb_components);
+            for(index_t c=0; c<nb_components; ++c) {
+                pos[c] = ptr[c];
+            }
+            for(index_t i=0; i<component.size(); ++i) {
+                elements[pos[component[i]]++] = i;
+            }
+        }
+
+        // Biggest components first, so that the largest ones do not
+        // end up being processed alone at the end.
+        vector<index_t> order(nb_components);
+        for(index_t c=0; c<nb_components; ++c) {
+            order[c] = c;
+        }
+        std::sort(
+            order.begin(), order.end(),
+            [&ptr](index_t c1, index_t c2) {
+                index_t size1 = ptr[c1+1] - ptr[c1];
+                index_t size2 = ptr[c2+1] - ptr[c2];
+                return (size1 > size2) || (size1 == size2 && c1 < c2);
+            }
+        );
+
+        // Each thread takes the next component to be processed.
+        index_t next = 0;
+        Process::spinlock lock = GEOGRAM_SPINLOCK_INIT;
+        parallel_for(
+            0, std::max(index_t(1), Process::maximum_concurrent_threads()),
+            [&](index_t) {
+                for(;;) {
+                    Process::acquire_spinlock(lock);
+                    index_t i = next;
+                    ++next;
+                    Process::release_spinlock(lock);
+                    if(i >= nb_components) {
+                        break;
+                    }
+                    index_t c = order[i];
+                    const index_t* base = elements.data();
+                    func(
+                        c, range<const index_t*>(
+                            base + ptr[c], base + ptr[c+1]
+                        )
+                    );
+                }
+            }
+        );
+    }
 
     index_t mesh_nb_connected_components(const Mesh& M) {
         vector<index_t> component;
@@ -48,6 +48,8 @@
 
 #include <geogram/basic/common.h>
 #include <geogram/basic/numeric.h>
+#include <geogram/basic/range.h>
+#include <functional>
 
 /**
  * \file geogram/mesh/mesh_topology.h
@@ -62,6 +64,8 @@ namespace GEO {
 
     /**
      * \brief Computes the connected components of a Mesh.
+     * \details Components are computed in parallel, and numbered in
+     *  the order of their smallest facet.
      * \param[in] M the input mesh
      * \param[out] component component[f] contains the index of the
      * connected component that facet f belongs to.
@@ -72,6 +76,51 @@ namespace GEO {
         const Mesh& M, vector<index_t>& component
     );
 
+    /**
+     * \brief Computes the connected components of the volumetric
+     *  part of a Mesh.
+     * \details Components are computed in parallel, and numbered in
+     *  the order of their smallest cell.
+     * \param[in] M the input mesh
+     * \param[out] component component[c] contains the index of the
+     *  connected component that cell c belongs to.
+     * \return the number of connected components
+     * \post component.size() == M.cells.nb()
+     */
+    index_t GEOGRAM_API get_cell_connected_components(
+        const Mesh& M, vector<index_t>& component
+    );
+
+    /**
+     * \brief Calls a function for each connected component, in parallel.
+     * \details The components are dispatched to the threads by
+     *  decreasing size. The function is called in parallel for
+     *  different components, thus it should only modify data
+     *  attached to the elements of the component. Calls to
+     *  parallel_for() in the function run sequentially.
+     * \code
+     *   vector<index_t> component;
+     *   index_t nb = get_connected_components(M, component);
+     *   parallel_for_each_component(
+     *      component, nb,
+     *      [&](index_t comp, range<const index_t*> facets) {
+     *          for(index_t f: facets) {
+     *              ...
+     *          }
+     *      }
+     *   );
+     * \endcode
+     * \param[in] component , nb_components the connected components,
+     *  as computed by get_connected_components() or
+     *  get_cell_connected_components()
+     * \param[in] func the function, called with the index of the
+     *  component and the (sorted) indices of its elements
+     */
+    void GEOGRAM_API parallel_for_each_component(
+        const vector<index_t>& component, index_t nb_components,
+        std::function<void(index_t, range<const index_t*>)> func
+    );
+
     /**
      * \brief Computes the number of connected components of a Mesh.
      */
@@ -47,6 +47,12 @@
 
 namespace GEO {
 
+    const expansion& expansion_nt::zero_rep() {
+        static expansion zero(1);
+        static const expansion& result = zero.assign(0.0);
+        return result;
+    }
+
     expansion_nt& expansion_nt::operator+= (const expansion_nt& rhs) {
         index_t e_capa = expansion::sum_capacity(rep(), rhs.rep());
         expansion* e = expansion::new_expansion_on_heap(e_capa);
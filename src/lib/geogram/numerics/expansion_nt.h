@@ -48,6 +48,7 @@
 
 #include <geogram/basic/common.h>
 #include <geogram/numerics/multi_precision.h>
+#include <algorithm>
 
 /**
  * \file geogram/numerics/expansion_nt.h
@@ -64,10 +65,15 @@ namespace GEO {
      *  sign of polynoms exactly.
      * \details Expansion_nt can be used like float and double. It supports
      *  three arithmetic operations (+,-,*), comparisons (>,>=,<,<=,==,!=)
-     *  and exact sign computation. expansion_nt is a reference-counted
-     *  wrapper around an \ref expansion allocated on the heap. When
-     *  performance is a concern, the lower-level expansion class may be
-     *  used instead.
+     *  and exact sign computation. expansion_nt is a wrapper around an 
+     *  \ref expansion allocated on the heap. The heap allocator uses
+     *  per-thread pools, and temporaries are moved rather than copied, 
+     *  thus expansion_nt can be used from multiple threads without 
+     *  contention. There is no inline storage for short expansions:
+     *  it would make every expansion_nt larger and moves more costly,
+     *  whereas small allocations are already served by the per-thread
+     *  pools. When performance is a concern, the lower-level 
+     *  expansion class may be used instead.
      */
     class GEOGRAM_API expansion_nt {
     public:
@@ -83,16 +89,28 @@ namespace GEO {
 
         /**
          * \brief Copy-constructor.
-         * \details The stored expansion is shared with \p rhs.
+         * \details The stored expansion is copied.
          * \param[in] rhs the expansion to be copied
          */
         expansion_nt(const expansion_nt& rhs) {
             copy(rhs);
         }
+
+        /**
+         * \brief Move-constructor.
+         * \details The stored expansion is stolen from \p rhs, that
+         *  is left empty, without allocating anything. An empty 
+         *  expansion_nt has value zero, and can be used like any
+         *  other one (storage is allocated when it is modified).
+         * \param[in] rhs the expansion to be moved
+         */
+        expansion_nt(expansion_nt&& rhs) GEO_NOEXCEPT : rep_(rhs.rep_) {
+            rhs.rep_ = nullptr;
+        }
         
         /**
          * \brief Assignment operator.
-         * \details The stored expansion is shared with \p rhs.
+         * \details The stored expansion is copied.
          * \param[in] rhs the expansion to be copied
          * \return the new value of this expansion (rhs)
          */
@@ -104,10 +122,22 @@ namespace GEO {
             return *this;
         }
 
+        /**
+         * \brief Move-assignment operator.
+         * \details The stored expansions are exchanged, the
+         *  previous value of this expansion_nt is deallocated
+         *  when \p rhs is destroyed.
+         * \param[in] rhs the expansion to be moved
+         * \return the new value of this expansion (rhs)
+         */
+        expansion_nt& operator= (expansion_nt&& rhs) GEO_NOEXCEPT {
+            std::swap(rep_, rhs.rep_);
+            return *this;
+        }
+        
         /**
          * \brief Expansion_nt destructor.
-         * \details The stored expansion is deallocated whenever
-         *  reference counting reaches 0.
+         * \details The stored expansion is deallocated.
          */
         ~expansion_nt() {
             cleanup();
@@ -346,12 +376,18 @@ namespace GEO {
         /**
          * \brief Gets the internal expansion that represents this
          *  expansion_nt.
+         * \details If this expansion_nt is empty (moved-from), a
+         *  zero expansion is allocated.
          * \return a reference to the expansion that represents
          *  this expansion_nt
          * \note most client code will not need to use this
          *  (advanced use only).
          */
         expansion& rep() {
+            if(rep_ == nullptr) {
+                rep_ = expansion::new_expansion_on_heap(1);
+                rep_->assign(0.0);
+            }
             return *rep_;
         }
 
@@ -359,12 +395,13 @@ namespace GEO {
          * \brief Gets the internal expansion that represents
          *  this expansion_nt.
          * \return a const reference to the expansion that represents
-         *  this expansion_nt
+         *  this expansion_nt, or to a zero expansion if this
+         *  expansion_nt is empty (moved-from)
          * \note most client code will not need to use this
          *  (advanced use only).
          */
         const expansion& rep() const {
-            return *rep_;
+            return (rep_ == nullptr) ? zero_rep() : *rep_;
         }
 
 
@@ -377,7 +414,9 @@ namespace GEO {
          * \param[in] rhs a const reference to the expansion to be copied
          */
         void copy(const expansion_nt& rhs) {
-            rep_ = expansion::new_expansion_on_heap(rhs.rep().capacity());
+            rep_ = expansion::new_expansion_on_heap(
+		std::max(rhs.rep().length(), index_t(1))
+	    );
             rep_->set_length(rhs.rep().length());
             for(index_t i=0; i<rep_->length(); ++i) {
                 (*rep_)[i] = rhs.rep()[i];
@@ -388,9 +427,18 @@ namespace GEO {
          * \brief Cleanups the memory associated with this expansion_nt.
          */
         void cleanup() {
-            expansion::delete_expansion_on_heap(rep_);
-            rep_ = nullptr;
+            if(rep_ != nullptr) {
+                expansion::delete_expansion_on_heap(rep_);
+                rep_ = nullptr;
+            }
         }
+
+        /**
+         * \brief Gets the zero expansion that represents empty
+         *  (moved-from) expansion_nt%s.
+         * \return a const reference to an expansion of value zero
+         */
+        static const expansion& zero_rep();
         
     private:
         expansion* rep_;
@@ -736,8 +784,19 @@ namespace GEO {
          * \brief Copy-constructor.
          * \param[in] rhs the rational to be copied
          */
-        rational_nt(const rational_nt& rhs) {
-            copy(rhs);
+        rational_nt(const rational_nt& rhs) :
+	    num_(rhs.num_), denom_(rhs.denom_) {
+        }
+
+        /**
+         * \brief Move-constructor.
+         * \details \p rhs is left empty, without allocating anything.
+         *  An empty rational_nt can be destroyed or assigned, but
+         *  not used in arithmetic operations (its denominator is zero).
+         * \param[in] rhs the rational to be moved
+         */
+        rational_nt(rational_nt&& rhs) GEO_NOEXCEPT :
+	    num_(std::move(rhs.num_)), denom_(std::move(rhs.denom_)) {
         }
         
         /**
@@ -753,6 +812,17 @@ namespace GEO {
             return *this;
         }
 
+        /**
+         * \brief Move-assignment operator.
+         * \param[in] rhs the rational to be moved
+         * \return the new value of this rational (rhs)
+         */
+        rational_nt& operator= (rational_nt&& rhs) GEO_NOEXCEPT {
+	    num_ = std::move(rhs.num_);
+	    denom_ = std::move(rhs.denom_);
+            return *this;
+        }
+
         /**
          * \brief rational_nt destructor.
          * \details The stored rational is deallocated whenever
@@ -0,0 +1,283 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+
+#ifndef GEOGRAM_NUMERICS_INTERVAL_NT
+#define GEOGRAM_NUMERICS_INTERVAL_NT
+
+#include <geogram/basic/common.h>
+#include <geogram/numerics/expansion_nt.h>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+/**
+ * \file geogram/numerics/interval_nt.h
+ * \brief Interval arithmetics, used to filter exact computations
+ * \details
+ *  This file provides a "number-type" that encapsulates an interval
+ *  with certified bounds, and a function that uses it to compute
+ *  the sign of an expression before falling back to expansion_nt.
+ */
+
+namespace GEO {
+
+    /**
+     * \brief Interval_nt (interval Number Type) is used to compute
+     *  certified bounds of polynoms.
+     * \details Interval_nt supports the three arithmetic operations 
+     *  (+,-,*). Each result is rounded outwards by one ulp, so that 
+     *  the bounds are certified whatever the current rounding mode
+     *  of the FPU (the rounding mode is never changed). Overflows 
+     *  result in infinite or NaN bounds, for which the sign is not
+     *  determined.
+     */
+    class interval_nt {
+    public:
+        /**
+         * \brief Constructs a new interval_nt from a double.
+         * \param[in] x the value to initialize this interval.
+         */
+        explicit interval_nt(double x = 0.0) :
+            lb_(x), ub_(x) {
+        }
+
+        /**
+         * \brief Constructs a new interval_nt from its bounds.
+         * \param[in] lb , ub the lower and upper bounds
+         */
+        interval_nt(double lb, double ub) :
+            lb_(lb), ub_(ub) {
+        }
+
+        /**
+         * \brief Gets the lower bound.
+         * \return the lower bound of this interval
+         */
+        double lb() const {
+            return lb_;
+        }
+
+        /**
+         * \brief Gets the upper bound.
+         * \return the upper bound of this interval
+         */
+        double ub() const {
+            return ub_;
+        }
+
+        /**
+         * \brief Gets an approximation of the represented number.
+         * \return the center of this interval
+         */
+        double estimate() const {
+            return 0.5 * (lb_ + ub_);
+        }
+        
+        /**
+         * \brief Adds an interval_nt to this interval_nt
+         * \param[in] rhs the interval_nt to be added to this interval_nt
+         * \return the new value of this interval_nt (*this + \p rhs)
+         */
+        interval_nt& operator+= (const interval_nt& rhs) {
+            lb_ = round_down(lb_ + rhs.lb_);
+            ub_ = round_up(ub_ + rhs.ub_);
+            return *this;
+        }
+
+        /**
+         * \brief Subtracts an interval_nt from this interval_nt
+         * \param[in] rhs the interval_nt to be subtracted
+         * \return the new value of this interval_nt (*this - \p rhs)
+         */
+        interval_nt& operator-= (const interval_nt& rhs) {
+            lb_ = round_down(lb_ - rhs.ub_);
+            ub_ = round_up(ub_ - rhs.lb_);
+            return *this;
+        }
+
+        /**
+         * \brief Multiplies this interval_nt by another one
+         * \param[in] rhs the interval_nt to multiply this interval_nt by
+         * \return the new value of this interval_nt (*this * \p rhs)
+         */
+        interval_nt& operator*= (const interval_nt& rhs) {
+            double a = lb_ * rhs.lb_;
+            double b = lb_ * rhs.ub_;
+            double c = ub_ * rhs.lb_;
+            double d = ub_ * rhs.ub_;
+            lb_ = round_down(std::min(std::min(a,b),std::min(c,d)));
+            ub_ = round_up(std::max(std::max(a,b),std::max(c,d)));
+            return *this;
+        }
+
+        /**
+         * \brief Computes the sum of two interval_nt
+         * \param[in] rhs the interval_nt to be added to this interval_nt
+         * \return the sum of this interval_nt and \p rhs
+         */
+        interval_nt operator+ (const interval_nt& rhs) const {
+            interval_nt result(*this);
+            result += rhs;
+            return result;
+        }
+
+        /**
+         * \brief Computes the difference of two interval_nt
+         * \param[in] rhs the interval_nt to be subtracted
+         * \return the difference between this interval_nt and \p rhs
+         */
+        interval_nt operator- (const interval_nt& rhs) const {
+            interval_nt result(*this);
+            result -= rhs;
+            return result;
+        }
+
+        /**
+         * \brief Computes the product of two interval_nt
+         * \param[in] rhs the interval_nt to be multiplied by this one
+         * \return the product of this interval_nt and \p rhs
+         */
+        interval_nt operator* (const interval_nt& rhs) const {
+            interval_nt result(*this);
+            result *= rhs;
+            return result;
+        }
+
+        /**
+         * \brief Computes the opposite of this interval_nt
+         * \return the opposite of this interval_nt
+         */
+        interval_nt operator- () const {
+            return interval_nt(-ub_, -lb_);
+        }
+
+        /**
+         * \brief Tests whether the sign of this interval_nt is certified.
+         * \retval true if the interval does not contain zero, or if 
+         *  it is exactly zero.
+         * \retval false otherwise (including the case where one of 
+         *  the bounds is NaN).
+         */
+        bool sign_is_determined() const {
+            return 
+                (lb_ > 0.0) || (ub_ < 0.0) ||
+                (lb_ == 0.0 && ub_ == 0.0);
+        }
+
+        /**
+         * \brief Gets the sign of this interval_nt.
+         * \return the sign of all the numbers in this interval
+         * \pre sign_is_determined()
+         */
+        Sign sign() const {
+            geo_debug_assert(sign_is_determined());
+            return (lb_ > 0.0) ? POSITIVE : ((ub_ < 0.0) ? NEGATIVE : ZERO);
+        }
+        
+    protected:
+        /**
+         * \brief Rounds a number downwards.
+         * \param[in] x a number computed with the current rounding mode
+         * \return the largest double strictly smaller than \p x, that 
+         *  is a lower bound of the exact result of the operation that
+         *  computed \p x.
+         */
+        static double round_down(double x) {
+            return std::nextafter(x, -std::numeric_limits<double>::infinity());
+        }
+
+        /**
+         * \brief Rounds a number upwards.
+         * \param[in] x a number computed with the current rounding mode
+         * \return the smallest double strictly larger than \p x, that 
+         *  is an upper bound of the exact result of the operation that
+         *  computed \p x.
+         */
+        static double round_up(double x) {
+            return std::nextafter(x, std::numeric_limits<double>::infinity());
+        }
+        
+    private:
+        double lb_;
+        double ub_;
+    };
+
+    /**
+     * \brief Computes the sign of an expression exactly, using
+     *  interval arithmetics first.
+     * \details The expression is first evaluated with interval_nt. 
+     *  It is evaluated with expansion_nt only if the sign of the
+     *  interval is not determined.
+     * \tparam F a functional object with a templated 
+     *  operator()(NT& result) const, that evaluates the expression with
+     *  number type NT (constructed from doubles as NT(x)) and stores 
+     *  it in result.
+     * \param[in] f the expression
+     * \return the sign of the expression, computed exactly
+     */
+    template <class F> inline Sign filtered_sign(const F& f) {
+        interval_nt I;
+        f(I);
+        if(I.sign_is_determined()) {
+            return I.sign();
+        }
+        expansion_nt E;
+        f(E);
+        return E.sign();
+    }
+
+    /**
+     * \brief Specialization of geo_sgn() for interval_nt.
+     * \param x a const reference to an interval_nt
+     * \return the sign of x (one of POSITIVE, ZERO, NEGATIVE)
+     * \pre x.sign_is_determined()
+     */
+    template <> inline Sign geo_sgn(const interval_nt& x) {
+        return x.sign();
+    }
+}
+
+#endif
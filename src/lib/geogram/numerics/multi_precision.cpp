@@ -94,15 +94,27 @@ namespace {
      * \details It is used by the high-level class expansion_nt
      *  that allocates expansion objects on the heap. PCK predicates
      *  do not use it (they use the more efficient low-level API 
-     *  that allocates expansion objects on the stack).
+     *  that allocates expansion objects on the stack). Each thread
+     *  has its own free lists (see ThreadPools), this class manages
+     *  the memory chunks and the free lists shared by all the threads,
+     *  used to refill the free lists of the threads.
      */
     class Pools {
     public:
 
+        /**
+         * \brief Number of pools. 
+         * \details Pool i has elements of size i*8 bytes. 
+         *  Larger elements are allocated with the system's malloc().
+         */
+        static const index_t NB_POOLS = 128;
+
         /**
          * \brief Creates a new Pools object
          */
-        Pools() : pools_(1024,nullptr) {
+        Pools() : 
+	    free_lists_(NB_POOLS,nullptr),
+	    lock_(GEOGRAM_SPINLOCK_INIT) {
             chunks_.reserve(1024);
         }
 
@@ -116,39 +128,85 @@ namespace {
         }
 
         /**
-         * \brief Allocates an element.
-         * \param[in] size size in bytes of the element to be allocated
-         * \return a pointer to the allocated element
-         * \note elements allocated with fast_malloc() should be deallocated
-         *  with fast_free()
+         * \brief Gets the pool used for a given element size.
+         * \param[in] size size in bytes of the element
+         * \return the index of the pool, or NB_POOLS if 
+         *  the element should be allocated with the system's malloc().
          */
-        void* malloc(size_t size) {
-            if(size >= pools_.size()) {
-                return ::malloc(size);
+        static index_t pool(size_t size) {
+            size_t result = std::max(size_t(1), (size + 7) / 8);
+            return (result < NB_POOLS) ? index_t(result) : NB_POOLS;
+        }
+        
+        /**
+         * \brief Maximum number of elements in the lists exchanged
+         *  between the threads and the Pools.
+         */
+        static const index_t BATCH_SIZE = 256;
+
+        /**
+         * \brief Gets a list of free elements from a pool.
+         * \details The list, of at most BATCH_SIZE elements, is removed
+         *  from the pool. A new chunk of elements is allocated if the 
+         *  pool is empty.
+         * \param[in] pool the index of the pool
+         * \param[out] nb the number of elements in the list
+         * \return a pointer to the first element of the list. Each
+         *  element of the list starts with a pointer to the next one.
+         */
+        void* get_free_list(index_t pool, index_t& nb) {
+            Process::acquire_spinlock(lock_);
+            if(free_lists_[pool] == nullptr) {
+                new_chunk(pool);
             }
-            if(pools_[size] == nullptr) {
-                new_chunk(size);
+            void* result = free_lists_[pool];
+            void* tail = result;
+            nb = 1;
+            while(nb < BATCH_SIZE && *static_cast<void**>(tail) != nullptr) {
+                tail = *static_cast<void**>(tail);
+                ++nb;
             }
-            void* result = pools_[size];
-            pools_[size] = *static_cast<void**>(pools_[size]);
+            free_lists_[pool] = *static_cast<void**>(tail);
+            *static_cast<void**>(tail) = nullptr;
+            Process::release_spinlock(lock_);
             return result;
         }
 
         /**
-         * \brief Deallocates an element.
-         * \param[in] ptr a pointer to the element to be deallocated
-         * \param[in] size number of bytes of the element, as specified
-         *   in the call to fast_malloc() that allocated it
+         * \brief Gets a single free element from a pool.
+         * \param[in] pool the index of the pool
+         * \return a pointer to the element
          */
-        void free(void* ptr, size_t size) {
-            if(size >= pools_.size()) {
-                ::free(ptr);
+        void* get_free_element(index_t pool) {
+            Process::acquire_spinlock(lock_);
+            if(free_lists_[pool] == nullptr) {
+                new_chunk(pool);
+            }
+            void* result = free_lists_[pool];
+            free_lists_[pool] = *static_cast<void**>(result);
+            Process::release_spinlock(lock_);
+            return result;
+        }
+        
+        /**
+         * \brief Gives a list of free elements back to a pool.
+         * \param[in] pool the index of the pool
+         * \param[in] list a pointer to the first element of the list,
+         *  or nullptr if the list is empty.
+         */
+        void release_free_list(index_t pool, void* list) {
+            if(list == nullptr) {
                 return;
             }
-            *static_cast<void**>(ptr) = pools_[size];
-            pools_[size] = ptr;
+            void* tail = list;
+            while(*static_cast<void**>(tail) != nullptr) {
+                tail = *static_cast<void**>(tail);
+            }
+            Process::acquire_spinlock(lock_);
+            *static_cast<void**>(tail) = free_lists_[pool];
+            free_lists_[pool] = list;
+            Process::release_spinlock(lock_);
         }
-
         
     protected:
         /**
@@ -159,31 +217,29 @@ namespace {
         
         /**
          * \brief Allocates a new chunk of elements and prepends
-         *  it to the free list for allocations of the specified 
-         *  size.
-         * \param[in] size_in size of the elements to be allocated.
+         *  it to the free list of a pool.
+         * \param[in] pool the index of the pool.
          */
-        void new_chunk(size_t size_in) {
-            size_t size = (size_in / 8 + 1)*8; // Align memory.
+        void new_chunk(index_t pool) {
+            size_t size = size_t(pool) * 8;
             Memory::pointer chunk = new Memory::byte[size * POOL_CHUNK_SIZE];
             for(index_t i=0; i<POOL_CHUNK_SIZE-1; ++i) {
                 Memory::pointer cur = chunk + size * i;
                 Memory::pointer next = cur + size;
                 *reinterpret_cast<void**>(cur) = next;
             }
-            *reinterpret_cast<void**>(chunk + (size-1)*POOL_CHUNK_SIZE) =
-		pools_[size_in];
-            pools_[size_in] = chunk;
+            *reinterpret_cast<void**>(chunk + size * (POOL_CHUNK_SIZE-1)) =
+		free_lists_[pool];
+            free_lists_[pool] = chunk;
             chunks_.push_back(chunk);
         }
 
         
     private:
         /**
-         * \brief The free lists of the pools. Index corresponds
-         *  to element size in bytes.
+         * \brief The free lists of the pools. 
          */
-        std::vector<void*> pools_;
+        std::vector<void*> free_lists_;
         
         /**
          * \brief Pointers to all the allocated chunks.
@@ -192,9 +248,145 @@ namespace {
          */
         std::vector<Memory::pointer> chunks_;
 
+        Process::spinlock lock_;
     };
 
     static Pools pools_;
+
+    /**
+     * \brief The free lists of the current thread.
+     * \details It is a plain array, so that it is still accessible
+     *  after the destructors of the thread-local objects were called.
+     */
+    thread_local void* thread_free_lists_[Pools::NB_POOLS];
+
+    /**
+     * \brief The number of elements in the free lists of the current
+     *  thread.
+     */
+    thread_local index_t thread_free_lists_size_[Pools::NB_POOLS];
+
+    /**
+     * \brief True if the free lists of the current thread were
+     *  given back to the global Pools (then the global Pools is used
+     *  directly).
+     */
+    thread_local bool thread_pools_terminated_ = false;
+
+    /**
+     * \brief Gives the free lists of a thread back to the global
+     *  Pools when the thread terminates.
+     * \details An instance of this class is declared as a thread-local
+     *  variable. It is constructed the first time one of the free
+     *  lists of a thread becomes non-empty (in malloc() or in free()).
+     */
+    class ThreadPools {
+    public:
+        /**
+         * \brief ThreadPools constructor.
+         * \details Does nothing, but referencing the object
+         *  makes its destructor called when the thread terminates.
+         */
+        ThreadPools() {
+        }
+
+        /**
+         * \brief ThreadPools destructor.
+         */
+        ~ThreadPools() {
+            for(index_t i=0; i<Pools::NB_POOLS; ++i) {
+                pools_.release_free_list(i, thread_free_lists_[i]);
+                thread_free_lists_[i] = nullptr;
+                thread_free_lists_size_[i] = 0;
+            }
+            thread_pools_terminated_ = true;
+        }
+
+        /**
+         * \brief Allocates an element.
+         * \param[in] size size in bytes of the element to be allocated
+         * \return a pointer to the allocated element
+         * \note elements allocated with malloc() should be deallocated
+         *  with free()
+         */
+        static void* malloc(size_t size) {
+            index_t pool = Pools::pool(size);
+            if(pool == Pools::NB_POOLS) {
+                return ::malloc(size);
+            }
+            if(thread_pools_terminated_) {
+                return pools_.get_free_element(pool);
+            }
+            void*& free_list = thread_free_lists_[pool];
+            index_t& free_list_size = thread_free_lists_size_[pool];
+            if(free_list == nullptr) {
+                free_list = pools_.get_free_list(pool, free_list_size);
+                instance_.activate();
+            }
+            void* result = free_list;
+            free_list = *static_cast<void**>(result);
+            --free_list_size;
+            return result;
+        }
+
+        /**
+         * \brief Deallocates an element.
+         * \param[in] ptr a pointer to the element to be deallocated
+         * \param[in] size number of bytes of the element, as specified
+         *   in the call to malloc() that allocated it
+         * \details The element can be deallocated by a thread different
+         *   from the one that allocated it.
+         */
+        static void free(void* ptr, size_t size) {
+            index_t pool = Pools::pool(size);
+            if(pool == Pools::NB_POOLS) {
+                ::free(ptr);
+                return;
+            }
+            if(thread_pools_terminated_) {
+                *static_cast<void**>(ptr) = nullptr;
+                pools_.release_free_list(pool, ptr);
+                return;
+            }
+            void*& free_list = thread_free_lists_[pool];
+            if(free_list == nullptr) {
+                // A thread that only frees elements (allocated by
+                // another thread) also needs to give its free lists
+                // back when it terminates.
+                instance_.activate();
+            }
+            *static_cast<void**>(ptr) = free_list;
+            free_list = ptr;
+            index_t& free_list_size = thread_free_lists_size_[pool];
+            ++free_list_size;
+            // A thread that frees more elements than it allocates
+            // gives them back by batches, so that they can be used
+            // by the other threads.
+            if(free_list_size > 2 * Pools::BATCH_SIZE) {
+                void* tail = free_list;
+                for(index_t i=1; i<Pools::BATCH_SIZE; ++i) {
+                    tail = *static_cast<void**>(tail);
+                }
+                void* batch = free_list;
+                free_list = *static_cast<void**>(tail);
+                *static_cast<void**>(tail) = nullptr;
+                free_list_size -= Pools::BATCH_SIZE;
+                pools_.release_free_list(pool, batch);
+            }
+        }
+        
+    protected:
+        /**
+         * \brief Makes sure the thread-local instance is constructed.
+         */
+        void activate() {
+        }
+        
+    private:
+        static thread_local ThreadPools instance_;
+    };
+
+    thread_local ThreadPools ThreadPools::instance_;
     
     /************************************************************************/
     
@@ -751,25 +943,23 @@ namespace GEO {
     static Process::spinlock expansions_lock = GEOGRAM_SPINLOCK_INIT;
     
     expansion* expansion::new_expansion_on_heap(index_t capa) {
-	Process::acquire_spinlock(expansions_lock);
         if(expansion_length_stat_) {
+	    Process::acquire_spinlock(expansions_lock);
             if(capa >= expansion_length_histo_.size()) {
                 expansion_length_histo_.resize(capa + 1);
             }
             expansion_length_histo_[capa]++;
+	    Process::release_spinlock(expansions_lock);
         }
         Memory::pointer addr = Memory::pointer(
-            pools_.malloc(expansion::bytes(capa))
+            ThreadPools::malloc(expansion::bytes(capa))
         );
-	Process::release_spinlock(expansions_lock);
         expansion* result = new(addr)expansion(capa);
         return result;
     }
 
     void expansion::delete_expansion_on_heap(expansion* e) {
-	Process::acquire_spinlock(expansions_lock);	
-        pools_.free(e, expansion::bytes(e->capacity()));
-	Process::release_spinlock(expansions_lock);	
+        ThreadPools::free(e, expansion::bytes(e->capacity()));
     }
 
     // ====== Initialization from expansion and double ===============
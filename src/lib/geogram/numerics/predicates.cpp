@@ -54,11 +54,15 @@
 
 #include <geogram/numerics/predicates.h>
 #include <geogram/numerics/multi_precision.h>
+#include <geogram/numerics/interval_nt.h>
 #include <geogram/basic/assert.h>
 #include <geogram/basic/logger.h>
 #include <geogram/basic/command_line.h>
 #include <geogram/basic/matrix.h>
+#include <geogram/basic/process.h>
 #include <algorithm>
+#include <chrono>
+#include <atomic>
 
 #define FPG_UNCERTAIN_VALUE 0
 
@@ -326,10 +330,11 @@ namespace {
 
 	// Absolute values by masking sign bit.
 	__m256d sign_mask = _mm256_set1_pd(-0.);
-	__m256d absPT     = _mm256_andnot_pd(PT, sign_mask);
-	__m256d absQT     = _mm256_andnot_pd(QT, sign_mask);
-	__m256d absRT     = _mm256_andnot_pd(RT, sign_mask);
-	__m256d absST     = _mm256_andnot_pd(ST, sign_mask);	
+	// (note: _mm256_andnot_pd(a,b) computes (~a) & b)
+	__m256d absPT     = _mm256_andnot_pd(sign_mask, PT);
+	__m256d absQT     = _mm256_andnot_pd(sign_mask, QT);
+	__m256d absRT     = _mm256_andnot_pd(sign_mask, RT);
+	__m256d absST     = _mm256_andnot_pd(sign_mask, ST);	
 	__m256d maxXYZ    = _mm256_max_pd(
 	    _mm256_max_pd(absPT, absQT), _mm256_max_pd(absRT, absST)
 	);
@@ -373,6 +378,133 @@ namespace {
 	return (det > epsval) * -1 + (det < -epsval);
     }
 
+    /**
+     * \brief Gathers the same coordinate of four points in an 
+     *  AVX2 register.
+     * \param[in] p an array of pointers to points
+     * \param[in] stride the number of pointers between two 
+     *  consecutive points to be gathered
+     * \param[in] coord the index of the coordinate
+     * \return an AVX2 register with p[0][coord], p[stride][coord],
+     *  p[2*stride][coord], p[3*stride][coord]
+     */
+    inline __m256d avx2_gather(
+	const double* const* p, index_t stride, index_t coord
+    ) {
+	return _mm256_set_pd(
+	    p[3*stride][coord], p[2*stride][coord],
+	    p[stride][coord], p[0][coord]
+	);
+    }
+
+    /**
+     * \brief Computes the absolute values of four numbers stored
+     *  in an AVX2 register.
+     */
+    inline __m256d avx2_abs(__m256d x) {
+	return _mm256_andnot_pd(_mm256_set1_pd(-0.), x);
+    }
+
+    /**
+     * \brief Converts the results of the comparisons of a 
+     *  semi-static filter into signs.
+     * \param[in] pos , neg masks with the lanes that were determined
+     *  to be positive, respectively negative
+     * \param[in] bad mask with the lanes that could not be determined
+     *  (because of underflow or overflow)
+     * \param[out] result the four signs, where FPG_UNCERTAIN_VALUE 
+     *  corresponds to the lanes that could not be determined
+     */
+    inline void avx2_filter_result(
+	__m256d pos, __m256d neg, __m256d bad, int* result
+    ) {
+	int pos_bits = _mm256_movemask_pd(_mm256_andnot_pd(bad, pos));
+	int neg_bits = _mm256_movemask_pd(_mm256_andnot_pd(bad, neg));
+	for(index_t i=0; i<4; ++i) {
+	    result[i] = ((pos_bits >> i) & 1) - ((neg_bits >> i) & 1);
+	}
+    }
+
+    /**
+     * \brief Arithmetic filter for the orient_3d() predicate 
+     *  applied to four tetrahedra simultaneously.
+     * \details Computes in each lane of the AVX2 registers the 
+     *  same operations as orient_3d_filter(), thus it has the
+     *  same error bound.
+     * \param[in] p an array of 16 pointers, with the four vertices
+     *  of each tetrahedron
+     * \param[out] result the four signs, or FPG_UNCERTAIN_VALUE for
+     *  the tetrahedra that could not be determined
+     */
+    inline void orient_3d_filter_avx2_4(
+	const double* const* p, int* result
+    ) {
+	__m256d p0x = avx2_gather(p,   4, 0);
+	__m256d p0y = avx2_gather(p,   4, 1);
+	__m256d p0z = avx2_gather(p,   4, 2);
+	__m256d a11 = _mm256_sub_pd(avx2_gather(p+1, 4, 0), p0x);
+	__m256d a12 = _mm256_sub_pd(avx2_gather(p+1, 4, 1), p0y);
+	__m256d a13 = _mm256_sub_pd(avx2_gather(p+1, 4, 2), p0z);
+	__m256d a21 = _mm256_sub_pd(avx2_gather(p+2, 4, 0), p0x);
+	__m256d a22 = _mm256_sub_pd(avx2_gather(p+2, 4, 1), p0y);
+	__m256d a23 = _mm256_sub_pd(avx2_gather(p+2, 4, 2), p0z);
+	__m256d a31 = _mm256_sub_pd(avx2_gather(p+3, 4, 0), p0x);
+	__m256d a32 = _mm256_sub_pd(avx2_gather(p+3, 4, 1), p0y);
+	__m256d a33 = _mm256_sub_pd(avx2_gather(p+3, 4, 2), p0z);
+
+	__m256d m1 = _mm256_sub_pd(
+	    _mm256_mul_pd(a22,a33), _mm256_mul_pd(a23,a32)
+	);
+	__m256d m2 = _mm256_sub_pd(
+	    _mm256_mul_pd(a12,a33), _mm256_mul_pd(a13,a32)
+	);
+	__m256d m3 = _mm256_sub_pd(
+	    _mm256_mul_pd(a12,a23), _mm256_mul_pd(a13,a22)
+	);
+	__m256d Delta = _mm256_add_pd(
+	    _mm256_sub_pd(_mm256_mul_pd(a11,m1), _mm256_mul_pd(a21,m2)),
+	    _mm256_mul_pd(a31,m3)
+	);
+
+	__m256d max1 = _mm256_max_pd(
+	    _mm256_max_pd(avx2_abs(a11), avx2_abs(a21)), avx2_abs(a31)
+	);
+	__m256d max2 = _mm256_max_pd(
+	    _mm256_max_pd(avx2_abs(a12), avx2_abs(a13)),
+	    _mm256_max_pd(avx2_abs(a22), avx2_abs(a23))
+	);
+	__m256d max3 = _mm256_max_pd(
+	    _mm256_max_pd(avx2_abs(a22), avx2_abs(a23)),
+	    _mm256_max_pd(avx2_abs(a32), avx2_abs(a33))
+	);
+	__m256d lower_bound = _mm256_min_pd(_mm256_min_pd(max1,max2),max3);
+	__m256d upper_bound = _mm256_max_pd(_mm256_max_pd(max1,max2),max3);
+
+	__m256d bad = _mm256_or_pd(
+	    _mm256_cmp_pd(
+		lower_bound, _mm256_set1_pd(1.63288018496748314939e-98),
+		_CMP_LT_OQ
+	    ),
+	    _mm256_cmp_pd(
+		upper_bound, _mm256_set1_pd(5.59936185544450928309e+101),
+		_CMP_GT_OQ
+	    )
+	);
+	
+	__m256d eps = _mm256_mul_pd(
+	    _mm256_set1_pd(5.11071278299732992696e-15),
+	    _mm256_mul_pd(_mm256_mul_pd(max2,max3),max1)
+	);
+	__m256d minus_eps = _mm256_sub_pd(_mm256_setzero_pd(), eps);
+
+	avx2_filter_result(
+	    _mm256_cmp_pd(Delta, eps, _CMP_GT_OQ),
+	    _mm256_cmp_pd(Delta, minus_eps, _CMP_LT_OQ),
+	    bad, result
+	);
+    }
+
+    
 #endif
     
     /**
@@ -470,53 +602,244 @@ namespace {
 
     using namespace GEO;
 
-    index_t cnt_side1_total = 0;
-    index_t cnt_side1_exact = 0;
-    index_t cnt_side1_SOS = 0;
-    index_t len_side1 = 0;
-
-    index_t cnt_side2_total = 0;
-    index_t cnt_side2_exact = 0;
-    index_t cnt_side2_SOS = 0;
-    index_t len_side2_num = 0;
-    index_t len_side2_denom = 0;
-    index_t len_side2_SOS = 0;
-
-    index_t cnt_side3_total = 0;
-    index_t cnt_side3_exact = 0;
-    index_t cnt_side3_SOS = 0;
-    index_t len_side3_num = 0;
-    index_t len_side3_denom = 0;
-    index_t len_side3_SOS = 0;
-
-    index_t cnt_side3h_total = 0;
-    index_t cnt_side3h_exact = 0;
-    index_t cnt_side3h_SOS = 0;
-    index_t len_side3h_num = 0;
-    index_t len_side3h_denom = 0;
-    index_t len_side3h_SOS = 0;
-    
-    index_t cnt_side4_total = 0;
-    index_t cnt_side4_exact = 0;
-    index_t cnt_side4_SOS = 0;
-    index_t len_side4_num = 0;
-    index_t len_side4_denom = 0;
-    index_t len_side4_SOS = 0;
-
-    index_t cnt_orient2d_total = 0;
-    index_t cnt_orient2d_exact = 0;
-    index_t len_orient2d = 0;
-
-    index_t cnt_orient3d_total = 0;
-    index_t cnt_orient3d_exact = 0;
-    index_t len_orient3d = 0;
-
-    index_t cnt_orient3dh_total = 0;
-    index_t cnt_orient3dh_exact = 0;
-    index_t cnt_orient3dh_SOS = 0;
-    index_t len_orient3dh_num = 0;
-    index_t len_orient3dh_denom = 0;
-    index_t len_orient3dh_SOS = 0;
+#ifdef GEOGRAM_WITH_PREDICATE_STATS
+
+    /**
+     * \brief The counters of a predicate for one thread.
+     * \details Counters are only modified by their thread, with relaxed
+     *  loads and stores (no read-modify-write), and are read by
+     *  get_stats() from other threads.
+     */
+    struct ThreadPredicateStats {
+        std::atomic<Numeric::uint64> nb_total;
+        std::atomic<Numeric::uint64> nb_exact;
+        std::atomic<Numeric::uint64> nb_SOS;
+        std::atomic<double> exact_time;
+        std::atomic<index_t> max_len_num;
+        std::atomic<index_t> max_len_denom;
+        std::atomic<index_t> max_len_SOS;
+
+        /**
+         * \brief Sets all the counters to zero.
+         */
+        void clear() {
+            nb_total.store(0, std::memory_order_relaxed);
+            nb_exact.store(0, std::memory_order_relaxed);
+            nb_SOS.store(0, std::memory_order_relaxed);
+            exact_time.store(0.0, std::memory_order_relaxed);
+            max_len_num.store(0, std::memory_order_relaxed);
+            max_len_denom.store(0, std::memory_order_relaxed);
+            max_len_SOS.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief Accumulates the counters into a PredicateStats.
+         * \param[in,out] S the PredicateStats
+         */
+        void merge_into(PCK::PredicateStats& S) const {
+            PCK::PredicateStats P;
+            P.nb_total = nb_total.load(std::memory_order_relaxed);
+            P.nb_exact = nb_exact.load(std::memory_order_relaxed);
+            P.nb_SOS = nb_SOS.load(std::memory_order_relaxed);
+            P.exact_time = exact_time.load(std::memory_order_relaxed);
+            P.max_len_num = max_len_num.load(std::memory_order_relaxed);
+            P.max_len_denom = max_len_denom.load(std::memory_order_relaxed);
+            P.max_len_SOS = max_len_SOS.load(std::memory_order_relaxed);
+            S.merge(P);
+        }
+    };
+
+    /**
+     * \brief The statistics of all the predicates for the current thread.
+     * \details Each thread that uses a predicate has its own instance,
+     *  that registers itself in a global list, so that get_stats() can
+     *  merge them. When a thread terminates, its statistics are merged
+     *  into a global accumulator.
+     */
+    class ThreadStats {
+    public:
+        /**
+         * \brief ThreadStats constructor.
+         * \details Registers this ThreadStats in the global list.
+         */
+        ThreadStats();
+
+        /**
+         * \brief ThreadStats destructor.
+         * \details Merges the statistics into the global accumulator
+         *  and unregisters this ThreadStats from the global list.
+         */
+        ~ThreadStats();
+
+        ThreadPredicateStats predicate[PCK::PRED_NB];
+    };
+
+    Process::spinlock stats_lock = GEOGRAM_SPINLOCK_INIT;
+    std::vector<ThreadStats*> all_thread_stats;
+    PCK::Stats terminated_threads_stats;
+
+    ThreadStats::ThreadStats() {
+        for(index_t i=0; i<PCK::PRED_NB; ++i) {
+            predicate[i].clear();
+        }
+        Process::acquire_spinlock(stats_lock);
+        all_thread_stats.push_back(this);
+        Process::release_spinlock(stats_lock);
+    }
+
+    ThreadStats::~ThreadStats() {
+        Process::acquire_spinlock(stats_lock);
+        for(index_t i=0; i<PCK::PRED_NB; ++i) {
+            predicate[i].merge_into(terminated_threads_stats.predicate[i]);
+        }
+        all_thread_stats.erase(
+            std::find(all_thread_stats.begin(), all_thread_stats.end(), this)
+        );
+        Process::release_spinlock(stats_lock);
+    }
+
+    thread_local ThreadStats thread_stats;
+
+    /**
+     * \brief Gets the statistics of a predicate for the current thread.
+     * \param[in] id the predicate
+     * \return a modifiable reference to the counters
+     */
+    inline ThreadPredicateStats& stats(PCK::PredicateId id) {
+        return thread_stats.predicate[id];
+    }
+
+    /**
+     * \brief Increments a counter of the current thread.
+     * \param[in,out] counter the counter
+     */
+    template <class T> inline void increment(
+        std::atomic<T>& counter, T value
+    ) {
+        counter.store(
+            counter.load(std::memory_order_relaxed) + value,
+            std::memory_order_relaxed
+        );
+    }
+
+    /**
+     * \brief Counts an invocation of a predicate.
+     * \param[in] id the predicate
+     */
+    inline void count_total(PCK::PredicateId id) {
+        increment(stats(id).nb_total, Numeric::uint64(1));
+    }
+
+    /**
+     * \brief Counts an invocation of a predicate that used symbolic
+     *  perturbation.
+     * \param[in] id the predicate
+     */
+    inline void count_SOS(PCK::PredicateId id) {
+        increment(stats(id).nb_SOS, Numeric::uint64(1));
+    }
+
+    /**
+     * \brief Updates a maximum expansion length of the current thread.
+     * \param[in,out] len the maximum length to be updated
+     * \param[in] e the expansion
+     */
+    inline void update_len(std::atomic<index_t>& len, const expansion& e) {
+        if(e.length() > len.load(std::memory_order_relaxed)) {
+            len.store(e.length(), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * \brief Updates the maximum length of the numerator of a predicate.
+     * \param[in] id the predicate
+     * \param[in] e the expansion
+     */
+    inline void update_len_num(PCK::PredicateId id, const expansion& e) {
+        update_len(stats(id).max_len_num, e);
+    }
+
+    /**
+     * \brief Updates the maximum length of the denominator of a predicate.
+     * \param[in] id the predicate
+     * \param[in] e the expansion
+     */
+    inline void update_len_denom(PCK::PredicateId id, const expansion& e) {
+        update_len(stats(id).max_len_denom, e);
+    }
+
+    /**
+     * \brief Updates the maximum length of the SOS terms of a predicate.
+     * \param[in] id the predicate
+     * \param[in] e the expansion
+     */
+    inline void update_len_SOS(PCK::PredicateId id, const expansion& e) {
+        update_len(stats(id).max_len_SOS, e);
+    }
+
+    /**
+     * \brief Counts an invocation of the exact version of a predicate
+     *  and measures the time spent in it.
+     * \details To be declared at the beginning of the function that
+     *  implements the exact version of a predicate. Time is accumulated
+     *  when it goes out of scope.
+     */
+    class ExactTimer {
+    public:
+        /**
+         * \brief ExactTimer constructor.
+         * \param[in] id the predicate
+         */
+        ExactTimer(PCK::PredicateId id) :
+            stats_(stats(id)),
+            start_(std::chrono::steady_clock::now()) {
+            increment(stats_.nb_exact, Numeric::uint64(1));
+        }
+
+        /**
+         * \brief ExactTimer destructor.
+         */
+        ~ExactTimer() {
+            increment(
+                stats_.exact_time,
+                std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start_
+                ).count()
+            );
+        }
+
+    private:
+        ThreadPredicateStats& stats_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+#else
+
+    // Statistics are disabled, the counting functions do nothing
+    // and are optimized out.
+
+    inline void count_total(PCK::PredicateId) {
+    }
+
+    inline void count_SOS(PCK::PredicateId) {
+    }
+
+    inline void update_len_num(PCK::PredicateId, const expansion&) {
+    }
+
+    inline void update_len_denom(PCK::PredicateId, const expansion&) {
+    }
+
+    inline void update_len_SOS(PCK::PredicateId, const expansion&) {
+    }
+
+    class ExactTimer {
+    public:
+        ExactTimer(PCK::PredicateId) {
+        }
+    };
+
+#endif
 
     // ================= side1 =========================================
 
@@ -529,17 +852,17 @@ namespace {
         const double* q0,
         coord_index_t dim
     ) {
-        cnt_side1_exact++;
+        ExactTimer timer(PCK::PRED_SIDE1);
         expansion& l = expansion_sq_dist(p0, p1, dim);
         expansion& a = expansion_dot_at(p1, q0, p0, dim).scale_fast(2.0);
         expansion& r = expansion_diff(l, a);
         Sign r_sign = r.sign();
         // Symbolic perturbation, Simulation of Simplicity
         if(r_sign == ZERO) {
-            cnt_side1_SOS++;
+            count_SOS(PCK::PRED_SIDE1);
             return (p0 < p1) ? POSITIVE : NEGATIVE;
         }
-        len_side1 = std::max(len_side1, r.length());
+        update_len_num(PCK::PRED_SIDE1, r);
         return r_sign;
     }
 
@@ -619,7 +942,7 @@ namespace {
         const double* q0, const double* q1,
         coord_index_t dim
     ) {
-        cnt_side2_exact++;
+        ExactTimer timer(PCK::PRED_SIDE2);
 
         const expansion& l1 = expansion_sq_dist(p1, p0, dim);
         const expansion& l2 = expansion_sq_dist(p2, p0, dim);
@@ -653,12 +976,12 @@ namespace {
         Sign r_sign = r.sign();
 
         // Statistics
-        len_side2_num = std::max(len_side2_num, r.length());
-        len_side2_denom = std::max(len_side2_denom, Delta.length());
+        update_len_num(PCK::PRED_SIDE2, r);
+        update_len_denom(PCK::PRED_SIDE2, Delta);
 
         // Simulation of Simplicity (symbolic perturbation)
         if(r_sign == ZERO) {
-            cnt_side2_SOS++;
+            count_SOS(PCK::PRED_SIDE2);
             const double* p_sort[3];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -671,7 +994,7 @@ namespace {
                     const expansion& z1 = expansion_diff(Delta, a21);
                     const expansion& z = expansion_sum(z1, a20);
                     Sign z_sign = z.sign();
-                    len_side2_SOS = std::max(len_side2_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE2, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -679,7 +1002,7 @@ namespace {
                 if(p_sort[i] == p1) {
                     const expansion& z = expansion_diff(a21, a20);
                     Sign z_sign = z.sign();
-                    len_side2_SOS = std::max(len_side2_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE2, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -775,7 +1098,7 @@ namespace {
         const double* q0, const double* q1, const double* q2,
         coord_index_t dim
     ) {
-        cnt_side3_exact++;
+        ExactTimer timer(PCK::PRED_SIDE3);
 
         const expansion& l1 = expansion_sq_dist(p1, p0, dim);
         const expansion& l2 = expansion_sq_dist(p2, p0, dim);
@@ -838,12 +1161,12 @@ namespace {
         Sign r_sign = r.sign();
 
         // Statistics
-        len_side3_num = std::max(len_side3_num, r.length());
-        len_side3_denom = std::max(len_side3_denom, Delta.length());
+        update_len_num(PCK::PRED_SIDE3, r);
+        update_len_denom(PCK::PRED_SIDE3, Delta);
 
         // Simulation of Simplicity (symbolic perturbation)
         if(r_sign == ZERO) {
-            cnt_side3_SOS++;
+            count_SOS(PCK::PRED_SIDE3);
             const double* p_sort[4];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -860,7 +1183,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, z3_0).negate();
                     const expansion& z = expansion_sum4(Delta, z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3_SOS = std::max(len_side3_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -870,7 +1193,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, b21);
                     const expansion& z = expansion_sum3(z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3_SOS = std::max(len_side3_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -880,7 +1203,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, b22);
                     const expansion& z = expansion_sum3(z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3_SOS = std::max(len_side3_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -903,7 +1226,7 @@ namespace {
         double h0, double h1, double h2, double h3,
         const double* q0, const double* q1, const double* q2
     ) {
-        cnt_side3h_exact++;
+        ExactTimer timer(PCK::PRED_SIDE3H);
 
         const expansion& l1 = expansion_diff(h1,h0);
         const expansion& l2 = expansion_diff(h2,h0);
@@ -966,12 +1289,12 @@ namespace {
         Sign r_sign = r.sign();
 
         // Statistics
-        len_side3h_num = std::max(len_side3h_num, r.length());
-        len_side3h_denom = std::max(len_side3h_denom, Delta.length());
+        update_len_num(PCK::PRED_SIDE3H, r);
+        update_len_denom(PCK::PRED_SIDE3H, Delta);
 
         // Simulation of Simplicity (symbolic perturbation)
         if(r_sign == ZERO) {
-            cnt_side3h_SOS++;
+            count_SOS(PCK::PRED_SIDE3H);
             const double* p_sort[4];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -989,7 +1312,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, z3_0).negate();
                     const expansion& z = expansion_sum4(Delta, z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3h_SOS = std::max(len_side3h_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3H, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -999,7 +1322,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, b21);
                     const expansion& z = expansion_sum3(z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3h_SOS = std::max(len_side3h_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3H, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1009,7 +1332,7 @@ namespace {
                     const expansion& z3 = expansion_product(a32, b22);
                     const expansion& z = expansion_sum3(z1, z2, z3);
                     Sign z_sign = z.sign();
-                    len_side3h_SOS = std::max(len_side3h_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE3H, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1106,7 +1429,7 @@ namespace {
         const double* p0, const double* p1, const double* p2, const double* p3,
         const double* p4, bool sos = true
     ) {
-        cnt_side4_exact++;
+        ExactTimer timer(PCK::PRED_SIDE4);
 
         const expansion& a11 = expansion_diff(p1[0], p0[0]);
         const expansion& a12 = expansion_diff(p1[1], p0[1]);
@@ -1195,12 +1518,12 @@ namespace {
         Sign r_sign = r.sign();
 
         // Statistics
-        len_side4_num = std::max(len_side4_num, r.length());
-        len_side4_denom = std::max(len_side4_denom, Delta1.length());
+        update_len_num(PCK::PRED_SIDE4, r);
+        update_len_denom(PCK::PRED_SIDE4, Delta1);
 
         // Simulation of Simplicity (symbolic perturbation)
         if(sos && r_sign == ZERO) {
-            cnt_side4_SOS++;
+            count_SOS(PCK::PRED_SIDE4);
             const double* p_sort[5];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -1214,26 +1537,26 @@ namespace {
                     const expansion& z2 = expansion_diff(Delta4, Delta3);
                     const expansion& z = expansion_sum(z1, z2);
                     Sign z_sign = z.sign();
-                    len_side4_SOS = std::max(len_side4_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE4, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta4_sign * z_sign);
                     }
                 } else if(p_sort[i] == p1) {
                     Sign Delta1_sign = Delta1.sign();
                     if(Delta1_sign != ZERO) {
-                        len_side4_SOS = std::max(len_side4_SOS, Delta1.length());
+                        update_len_SOS(PCK::PRED_SIDE4, Delta1);
                         return Sign(Delta4_sign * Delta1_sign);
                     }
                 } else if(p_sort[i] == p2) {
                     Sign Delta2_sign = Delta2.sign();
                     if(Delta2_sign != ZERO) {
-                        len_side4_SOS = std::max(len_side4_SOS, Delta2.length());
+                        update_len_SOS(PCK::PRED_SIDE4, Delta2);
                         return Sign(-Delta4_sign * Delta2_sign);
                     }
                 } else if(p_sort[i] == p3) {
                     Sign Delta3_sign = Delta3.sign();
                     if(Delta3_sign != ZERO) {
-                        len_side4_SOS = std::max(len_side4_SOS, Delta3.length());
+                        update_len_SOS(PCK::PRED_SIDE4, Delta3);
                         return Sign(Delta4_sign * Delta3_sign);
                     }
                 } else if(p_sort[i] == p4) {
@@ -1254,7 +1577,7 @@ namespace {
         const double* q0, const double* q1, const double* q2, const double* q3,
         coord_index_t dim
     ) {
-        cnt_side4_exact++;
+        ExactTimer timer(PCK::PRED_SIDE4);
 
         const expansion& l1 = expansion_sq_dist(p1, p0, dim);
         const expansion& l2 = expansion_sq_dist(p2, p0, dim);
@@ -1357,7 +1680,7 @@ namespace {
 
         // Simulation of Simplicity (symbolic perturbation)
         if(r_sign == ZERO) {
-            cnt_side4_SOS++;
+            count_SOS(PCK::PRED_SIDE4);
             const double* p_sort[5];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -1378,7 +1701,7 @@ namespace {
                     const expansion& z1234 = expansion_sum4(z1, z2, z3, z4);
                     const expansion& z = expansion_diff(Delta, z1234);
                     Sign z_sign = z.sign();
-                    len_side4_SOS = std::max(len_side4_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE4, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1389,7 +1712,7 @@ namespace {
                     const expansion& z4 = expansion_product(a33, b31);
                     const expansion& z = expansion_sum4(z1, z2, z3, z4);
                     Sign z_sign = z.sign();
-                    len_side4_SOS = std::max(len_side4_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE4, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1400,7 +1723,7 @@ namespace {
                     const expansion& z4 = expansion_product(a33, b32);
                     const expansion& z = expansion_sum4(z1, z2, z3, z4);
                     Sign z_sign = z.sign();
-                    len_side4_SOS = std::max(len_side4_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE4, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1411,7 +1734,7 @@ namespace {
                     const expansion& z4 = expansion_product(a33, b33);
                     const expansion& z = expansion_sum4(z1, z2, z3, z4);
                     Sign z_sign = z.sign();
-                    len_side4_SOS = std::max(len_side4_SOS, z.length());
+                    update_len_SOS(PCK::PRED_SIDE4, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta_sign * z_sign);
                     }
@@ -1489,7 +1812,7 @@ namespace {
     Sign orient_2d_exact(
         const double* p0, const double* p1, const double* p2
     ) {
-        cnt_orient2d_exact++;
+        ExactTimer timer(PCK::PRED_ORIENT2D);
 
         const expansion& a11 = expansion_diff(p1[0], p0[0]);
         const expansion& a12 = expansion_diff(p1[1], p0[1]);
@@ -1501,7 +1824,7 @@ namespace {
             a11, a12, a21, a22
         );
 
-        len_orient2d = std::max(len_orient2d, Delta.length());
+        update_len_num(PCK::PRED_ORIENT2D, Delta);
 
         return Delta.sign();
     }
@@ -1513,7 +1836,7 @@ namespace {
         const double* p0, const double* p1,
         const double* p2, const double* p3
     ) {
-        cnt_orient3d_exact++;
+        ExactTimer timer(PCK::PRED_ORIENT3D);
 
         const expansion& a11 = expansion_diff(p1[0], p0[0]);
         const expansion& a12 = expansion_diff(p1[1], p0[1]);
@@ -1531,7 +1854,7 @@ namespace {
             a11, a12, a13, a21, a22, a23, a31, a32, a33
         );
 
-        len_orient3d = std::max(len_orient3d, Delta.length());
+        update_len_num(PCK::PRED_ORIENT3D, Delta);
 
         return Delta.sign();
     }
@@ -1542,7 +1865,7 @@ namespace {
         double h0, double h1, double h2, double h3, double h4,
         bool sos = true
     ) {
-        cnt_orient3dh_exact++;
+        ExactTimer timer(PCK::PRED_ORIENT3DH);
 
         const expansion& a11 = expansion_diff(p1[0], p0[0]);
         const expansion& a12 = expansion_diff(p1[1], p0[1]);
@@ -1600,12 +1923,12 @@ namespace {
         Sign r_sign = r.sign();
 
         // Statistics
-        len_orient3dh_num = std::max(len_orient3dh_num, r.length());
-        len_orient3dh_denom = std::max(len_orient3dh_denom, Delta1.length());
+        update_len_num(PCK::PRED_ORIENT3DH, r);
+        update_len_denom(PCK::PRED_ORIENT3DH, Delta1);
 
         // Simulation of Simplicity (symbolic perturbation)
         if(sos && r_sign == ZERO) {
-            cnt_orient3dh_SOS++;
+            count_SOS(PCK::PRED_ORIENT3DH);
             const double* p_sort[5];
             p_sort[0] = p0;
             p_sort[1] = p1;
@@ -1620,26 +1943,26 @@ namespace {
                     const expansion& z2 = expansion_diff(Delta4, Delta3);
                     const expansion& z = expansion_sum(z1, z2);
                     Sign z_sign = z.sign();
-                    len_orient3dh_SOS = std::max(len_orient3dh_SOS, z.length());
+                    update_len_SOS(PCK::PRED_ORIENT3DH, z);
                     if(z_sign != ZERO) {
                         return Sign(Delta4_sign * z_sign);
                     }
                 } else if(p_sort[i] == p1) {
                     Sign Delta1_sign = Delta1.sign();
                     if(Delta1_sign != ZERO) {
-                        len_orient3dh_SOS = std::max(len_orient3dh_SOS, Delta1.length());
+                        update_len_SOS(PCK::PRED_ORIENT3DH, Delta1);
                         return Sign(Delta4_sign * Delta1_sign);
                     }
                 } else if(p_sort[i] == p2) {
                     Sign Delta2_sign = Delta2.sign();
                     if(Delta2_sign != ZERO) {
-                        len_orient3dh_SOS = std::max(len_orient3dh_SOS, Delta2.length());
+                        update_len_SOS(PCK::PRED_ORIENT3DH, Delta2);
                         return Sign(-Delta4_sign * Delta2_sign);
                     }
                 } else if(p_sort[i] == p3) {
                     Sign Delta3_sign = Delta3.sign();
                     if(Delta3_sign != ZERO) {
-                        len_orient3dh_SOS = std::max(len_orient3dh_SOS, Delta3.length());
+                        update_len_SOS(PCK::PRED_ORIENT3DH, Delta3);
                         return Sign(Delta4_sign * Delta3_sign);
                     }
                 } else if(p_sort[i] == p4) {
@@ -1761,33 +2084,46 @@ namespace {
     
 
     /**
-     * \brief Tests whether three points are aligned using 
-     *  exact arithmetics.
-     * \param[in] p0 , p1 , p2 the three points
-     * \retval true if the three points are aligned.
-     * \retval false otherwise.
+     * \brief Computes one of the coordinates of the normal vector 
+     *  of a triangle.
+     * \details Used with filtered_sign() to test whether three points 
+     *  are aligned with interval arithmetics, then with exact 
+     *  arithmetics if the interval does not determine the sign.
      */
-    bool aligned_3d_exact(
-	const double* p0, const double* p1, const double* p2
-    ) {
-	const expansion& U_0 = expansion_diff(p1[0],p0[0]);
-	const expansion& U_1 = expansion_diff(p1[1],p0[1]);
-	const expansion& U_2 = expansion_diff(p1[2],p0[2]);
-	
-	const expansion& V_0 = expansion_diff(p2[0],p0[0]);
-	const expansion& V_1 = expansion_diff(p2[1],p0[1]);
-	const expansion& V_2 = expansion_diff(p2[2],p0[2]);
-
-	const expansion& N_0 = expansion_det2x2(U_1, V_1, U_2, V_2);
-	const expansion& N_1 = expansion_det2x2(U_2, V_2, U_0, V_0);
-	const expansion& N_2 = expansion_det2x2(U_0, V_0, U_1, V_1);
+    class TriangleNormalCoord {
+    public:
+	/**
+	 * \brief TriangleNormalCoord constructor.
+	 * \param[in] p0 , p1 , p2 the three vertices of the triangle
+	 * \param[in] coord the coordinate of the normal vector, in 0,1,2
+	 */
+	TriangleNormalCoord(
+	    const double* p0, const double* p1, const double* p2,
+	    coord_index_t coord
+	) : p0_(p0), p1_(p1), p2_(p2), coord_(coord) {
+	}
 
-	return(
-	    N_0.sign() == 0 &&
-	    N_1.sign() == 0 &&
-	    N_2.sign() == 0
-	);
-    }
+	/**
+	 * \brief Computes the coordinate of the normal vector.
+	 * \tparam NT the number type used for the computation
+	 * \param[out] result the coordinate of the normal vector
+	 */
+	template <class NT> void operator()(NT& result) const {
+	    coord_index_t c1 = coord_index_t((coord_ + 1) % 3);
+	    coord_index_t c2 = coord_index_t((coord_ + 2) % 3);
+	    NT U_1 = NT(p1_[c1]) - NT(p0_[c1]);
+	    NT U_2 = NT(p1_[c2]) - NT(p0_[c2]);
+	    NT V_1 = NT(p2_[c1]) - NT(p0_[c1]);
+	    NT V_2 = NT(p2_[c2]) - NT(p0_[c2]);
+	    result = U_1 * V_2 - V_1 * U_2;
+	}
+	
+    private:
+	const double* p0_;
+	const double* p1_;
+	const double* p2_;
+	coord_index_t coord_;
+    };
     
     /**
      * \brief Computes the sign of the dot product between two
@@ -1843,11 +2179,13 @@ namespace {
     
     // ================================ statistics ========================
 
+#ifdef GEOGRAM_WITH_PREDICATE_STATS
+
     /**
      * \brief Returns the percentage that a number represents
      *   relative to another one.
      */
-    inline double percent(index_t a, index_t b) {
+    inline double percent(Numeric::uint64 a, Numeric::uint64 b) {
         if(a == 0 && b == 0) {
             return 0;
         }
@@ -1856,97 +2194,46 @@ namespace {
 
     /**
      * \brief Displays statistic counters for exact predicates
-     * \param[in] name name of the predicate
-     * \param[in] cnt1 total number of invocations
-     * \param[in] cnt2 number of exact invocations
+     * \param[in] S the statistics of all the predicates
+     * \param[in] id the predicate to be displayed
+     * \param[in] SOS true if the predicate uses symbolic perturbation
+     * \param[in] denom true if the predicate computes expansions for
+     *  a numerator, a denominator and SOS terms, false if it computes 
+     *  a single expansion
      */
-    void show_stats_plain(
-        const std::string& name, index_t cnt1, index_t cnt2
+    void show_predicate_stats(
+        const PCK::Stats& S, PCK::PredicateId id, bool SOS, bool denom
     ) {
+        const PCK::PredicateStats& P = S[id];
+        std::string name = PCK::predicate_name(id);
         Logger::out(name)
-            << "Tot:" << cnt1
-            << " Exact:" << cnt2
-            << std::endl;
-        Logger::out(name)
-            << " Exact: " << percent(cnt2, cnt1) << "% "
-            << std::endl;
-    }
-
-    /**
-     * \brief Displays statistic counters for exact predicates
-     * \param[in] name name of the predicate
-     * \param[in] cnt1 total number of invocations
-     * \param[in] cnt2 number of exact invocations
-     * \param[in] cnt3 number of SOS invocations
-     */
-    void show_stats_sos(
-        const std::string& name, index_t cnt1, index_t cnt2, index_t cnt3
-    ) {
+            << "Tot:" << P.nb_total
+            << " Exact:" << P.nb_exact;
+        if(SOS) {
+            Logger::out(name) << " SOS:" << P.nb_SOS;
+        }
+        Logger::out(name) << std::endl;
         Logger::out(name)
-            << "Tot:" << cnt1
-            << " Exact:" << cnt2
-            << " SOS:" << cnt3 << std::endl;
+            << " Exact: " << percent(P.nb_exact, P.nb_total) << "% ";
+        if(SOS) {
+            Logger::out(name)
+                << " SOS: " << percent(P.nb_SOS, P.nb_total) << "% ";
+        }
         Logger::out(name)
-            << " Exact: " << percent(cnt2, cnt1) << "% "
-            << " SOS: " << percent(cnt3, cnt1) << "% "
+            << " Exact time: " << P.exact_time << "s"
             << std::endl;
+        if(denom) {
+            Logger::out(name)
+                << " Num len: " << P.max_len_num
+                << " Denom len: " << P.max_len_denom
+                << " SOS len: " << P.max_len_SOS
+                << std::endl;
+        } else {
+            Logger::out(name) << " Len: " << P.max_len_num << std::endl;
+        }
     }
 
-    /**
-     * \brief Displays statistic counters for exact predicates
-     * \param[in] name name of the predicate
-     * \param[in] cnt1 total number of invocations
-     * \param[in] cnt2 number of exact invocations
-     * \param[in] cnt3 number of SOS invocations
-     * \param[in] len maximum length of the expansions during exact computations
-     */
-    void show_stats_sos(
-        const std::string& name, index_t cnt1, index_t cnt2, index_t cnt3,
-        index_t len
-    ) {
-        show_stats_sos(name, cnt1, cnt2, cnt3);
-        Logger::out(name) << " Len: " << len << std::endl;
-    }
-
-    /**
-     * \brief Displays statistic counters for exact predicates
-     * \param[in] name name of the predicate
-     * \param[in] cnt1 total number of invocations
-     * \param[in] cnt2 number of exact invocations
-     * \param[in] len maximum length of the expansions during exact computations
-     */
-    void show_stats_plain(
-        const std::string& name, index_t cnt1, index_t cnt2,
-        index_t len
-    ) {
-        show_stats_plain(name, cnt1, cnt2);
-        Logger::out(name) << " Len: " << len << std::endl;
-    }
-
-    /**
-     * \brief Displays statistic counters for exact predicates
-     * \param[in] name name of the predicate
-     * \param[in] cnt1 total number of invocations
-     * \param[in] cnt2 number of exact invocations
-     * \param[in] cnt3 number of SOS invocations
-     * \param[in] num_len maximum length of the expansions
-     *   that represent the numerator
-     * \param[in] denom_len maximum length of the expansions
-     *   that represent the denominator
-     * \param[in] SOS_len maximum length of the expansions
-     *   that represent the SOS terms
-     */
-    void show_stats_sos(
-        const std::string& name, index_t cnt1, index_t cnt2, index_t cnt3,
-        index_t num_len, index_t denom_len, index_t SOS_len
-    ) {
-        show_stats_sos(name, cnt1, cnt2, cnt3);
-        Logger::out(name)
-            << " Num len: " << num_len
-            << " Denom len: " << denom_len
-            << " SOS len: " << SOS_len
-            << std::endl;
-    }
+#endif
 }
 
 /****************************************************************************/
@@ -1969,7 +2256,7 @@ namespace GEO {
             const double* q0,
             coord_index_t DIM
         ) {
-            cnt_side1_total++;
+            count_total(PCK::PRED_SIDE1);
             switch(DIM) {
             case 3:
                 return side1_3d_SOS(p0, p1, q0);
@@ -1990,7 +2277,7 @@ namespace GEO {
             const double* q0, const double* q1,
             coord_index_t DIM
         ) {
-            cnt_side2_total++;
+            count_total(PCK::PRED_SIDE2);
             switch(DIM) {
             case 3:
                 return side2_3d_SOS(p0, p1, p2, q0, q1);
@@ -2011,7 +2298,7 @@ namespace GEO {
             const double* q0, const double* q1, const double* q2,
             coord_index_t DIM
         ) {
-            cnt_side3_total++;
+            count_total(PCK::PRED_SIDE3);
             switch(DIM) {
             case 3:
                 return side3_3d_SOS(p0, p1, p2, p3, q0, q1, q2);
@@ -2053,21 +2340,21 @@ namespace GEO {
                 // 3d is a special case for side4()
                 //   (intrinsic dim == ambient dim)
                 // therefore embedding tet q0,q1,q2,q3 is not needed.
-                // WARNING: cnt_side4_total is not incremented here,
+                // WARNING: side4 total count is not incremented here,
                 // because it is
                 // incremented in side4_3d_SOS().
                 return side4_3d_SOS(p0, p1, p2, p3, p4);
             case 4:
-                cnt_side4_total++;
+                count_total(PCK::PRED_SIDE4);
                 return side4_4d_SOS(p0, p1, p2, p3, p4, q0, q1, q2, q3);
             case 6:
-                cnt_side4_total++;
+                count_total(PCK::PRED_SIDE4);
                 return side4_6d_SOS(p0, p1, p2, p3, p4, q0, q1, q2, q3);
             case 7:
-                cnt_side4_total++;
+                count_total(PCK::PRED_SIDE4);
                 return side4_7d_SOS(p0, p1, p2, p3, p4, q0, q1, q2, q3);
             case 8:
-                cnt_side4_total++;
+                count_total(PCK::PRED_SIDE4);
                 return side4_8d_SOS(p0, p1, p2, p3, p4, q0, q1, q2, q3);
             }
             geo_assert_not_reached;
@@ -2078,7 +2365,7 @@ namespace GEO {
             const double* p0, const double* p1, const double* p2, const double* p3,
             const double* p4
         ) {
-            cnt_side4_total++;
+            count_total(PCK::PRED_SIDE4);
             Sign result = Sign(side4_3d_filter(p0, p1, p2, p3, p4));
             if(result == 0) {
                 // last argument is false: do not apply symbolic perturbation
@@ -2092,7 +2379,7 @@ namespace GEO {
             const double* p2, const double* p3,
             const double* p4
         ) {
-            cnt_side4_total++;
+            count_total(PCK::PRED_SIDE4);
             Sign result = Sign(side4_3d_filter(p0, p1, p2, p3, p4));
             if(result == 0) {
                 result = side4_3d_exact_SOS(p0, p1, p2, p3, p4);
@@ -2119,7 +2406,7 @@ namespace GEO {
             // Therefore:
             // in_sphere_3d(p0,p1,p2,p3,p4) = -side4_3d(p0,p1,p2,p3,p4)
 
-            cnt_side4_total++;
+            count_total(PCK::PRED_SIDE4);
             
             // This specialized filter supposes that orient_3d(p0,p1,p2,p3) > 0
 
@@ -2196,7 +2483,7 @@ namespace GEO {
         Sign orient_2d(
             const double* p0, const double* p1, const double* p2
         ) {
-            cnt_orient2d_total++;
+            count_total(PCK::PRED_ORIENT2D);
             Sign result = Sign(orient_2d_filter(p0, p1, p2));
             if(result == 0) {
                 result = orient_2d_exact(p0, p1, p2);
@@ -2230,7 +2517,7 @@ namespace GEO {
             const double* p0, const double* p1,
             const double* p2, const double* p3
             ) {
-            cnt_orient3d_total++;
+            count_total(PCK::PRED_ORIENT3D);
             Sign result = Sign(orient_3d_filter(p0, p1, p2, p3));
             if(result == 0) {
                 result = orient_3d_exact(p0, p1, p2, p3);
@@ -2239,12 +2526,39 @@ namespace GEO {
         }
 
 
+        void orient_3d_tet_facets_filter(
+            const double* const* pv, const double* q, Sign* result
+        ) {
+            const double* p[16] = {
+                q,     pv[1], pv[2], pv[3],
+                pv[0], q,     pv[2], pv[3],
+                pv[0], pv[1], q,     pv[3],
+                pv[0], pv[1], pv[2], q
+            };
+            int filter_result[4];
+#ifdef __AVX2__
+            orient_3d_filter_avx2_4(p, filter_result);
+#else
+            for(index_t f=0; f<4; ++f) {
+                const double* const* T = p+4*f;
+                filter_result[f] = orient_3d_filter(T[0], T[1], T[2], T[3]);
+            }
+#endif
+            for(index_t f=0; f<4; ++f) {
+                result[f] = Sign(filter_result[f]);
+                // The undecided ones are counted by orient_3d()
+                if(result[f] != ZERO) {
+                    count_total(PCK::PRED_ORIENT3D);
+                }
+            }
+        }
+
         Sign orient_3dlifted(
             const double* p0, const double* p1,
             const double* p2, const double* p3, const double* p4,
             double h0, double h1, double h2, double h3, double h4
         ) {
-            cnt_orient3dh_total++;
+            count_total(PCK::PRED_ORIENT3DH);
             Sign result = Sign(
                 side4h_3d_filter(
                     p0, p1, p2, p3, p4, h0, h1, h2, h3, h4
@@ -2266,7 +2580,7 @@ namespace GEO {
             const double* p2, const double* p3, const double* p4,
             double h0, double h1, double h2, double h3, double h4
         ) {
-            cnt_orient3dh_total++;
+            count_total(PCK::PRED_ORIENT3DH);
             Sign result = Sign(
                 side4h_3d_filter(
                     p0, p1, p2, p3, p4, h0, h1, h2, h3, h4
@@ -2377,21 +2691,18 @@ namespace GEO {
 	bool aligned_3d(
 	    const double* p0, const double* p1, const double* p2
 	) {
-	    /*
-	    Sign result = Sign(
-		aligned_3d_filter(p0,p1,p2)
-	    );
-	    if(result != 0) {
-		return false;
+	    for(coord_index_t c=0; c<3; ++c) {
+		if(filtered_sign(TriangleNormalCoord(p0,p1,p2,c)) != ZERO) {
+		    return false;
+		}
 	    }
-	    */
-	    return aligned_3d_exact(p0, p1, p2);
+	    return true;
 	}
 	
 	Sign dot_3d(
 	    const double* p0, const double* p1, const double* p2
 	) {
-	    Sign result = Sign(det_3d_filter(p0, p1, p2));
+	    Sign result = Sign(dot_3d_filter(p0, p1, p2));
 	    if(result == 0) {
 		result = dot_3d_exact(p0, p1, p2);
 	    }
@@ -2459,47 +2770,70 @@ namespace GEO {
         }
 
         void show_stats() {
-            show_stats_plain(
-                "orient2d",
-                cnt_orient2d_total, cnt_orient2d_exact,
-                len_orient2d
-            );
-            show_stats_plain(
-                "orient3d",
-                cnt_orient3d_total, cnt_orient3d_exact,
-                len_orient3d
-            );
-            show_stats_sos(
-                "orient3dh",
-                cnt_orient3dh_total, cnt_orient3dh_exact, cnt_orient3dh_SOS,
-                len_orient3dh_num, len_orient3dh_denom, len_orient3dh_SOS
-            );
-            show_stats_sos(
-                "side1",
-                cnt_side1_total, cnt_side1_exact, cnt_side1_SOS,
-                len_side1
-            );
-            show_stats_sos(
-                "side2",
-                cnt_side2_total, cnt_side2_exact, cnt_side2_SOS,
-                len_side2_num, len_side2_denom, len_side2_SOS
-            );
-            show_stats_sos(
-                "side3",
-                cnt_side3_total, cnt_side3_exact, cnt_side3_SOS,
-                len_side3_num, len_side3_denom, len_side3_SOS
-            );
-            show_stats_sos(
-                "side3h",
-                cnt_side3h_total, cnt_side3h_exact, cnt_side3h_SOS,
-                len_side3h_num, len_side3h_denom, len_side3h_SOS
-            );
-            show_stats_sos(
-                "side4/insph.",
-                cnt_side4_total, cnt_side4_exact, cnt_side4_SOS,
-                len_side4_num, len_side4_denom, len_side4_SOS
-            );
+#ifdef GEOGRAM_WITH_PREDICATE_STATS
+            Stats S = get_stats();
+            show_predicate_stats(S, PRED_ORIENT2D, false, false);
+            show_predicate_stats(S, PRED_ORIENT3D, false, false);
+            show_predicate_stats(S, PRED_ORIENT3DH, true, true);
+            show_predicate_stats(S, PRED_SIDE1, true, false);
+            show_predicate_stats(S, PRED_SIDE2, true, true);
+            show_predicate_stats(S, PRED_SIDE3, true, true);
+            show_predicate_stats(S, PRED_SIDE3H, true, true);
+            show_predicate_stats(S, PRED_SIDE4, true, true);
+#else
+            Logger::out("PCK")
+                << "Statistics disabled "
+                << "(build with GEOGRAM_WITH_PREDICATE_STATS)"
+                << std::endl;
+#endif
+        }
+
+        const char* predicate_name(PredicateId id) {
+            static const char* names[PRED_NB] = {
+                "orient2d", "orient3d", "orient3dh",
+                "side1", "side2", "side3", "side3h", "side4/insph."
+            };
+            geo_debug_assert(id < PRED_NB);
+            return names[id];
         }
+
+#ifdef GEOGRAM_WITH_PREDICATE_STATS
+
+        Stats get_stats() {
+            Process::acquire_spinlock(stats_lock);
+            Stats result = terminated_threads_stats;
+            for(index_t i=0; i<index_t(all_thread_stats.size()); ++i) {
+                for(index_t j=0; j<PRED_NB; ++j) {
+                    all_thread_stats[i]->predicate[j].merge_into(
+                        result.predicate[j]
+                    );
+                }
+            }
+            Process::release_spinlock(stats_lock);
+            return result;
+        }
+
+        void reset_stats() {
+            Process::acquire_spinlock(stats_lock);
+            terminated_threads_stats = Stats();
+            for(index_t i=0; i<index_t(all_thread_stats.size()); ++i) {
+                for(index_t j=0; j<PRED_NB; ++j) {
+                    all_thread_stats[i]->predicate[j].clear();
+                }
+            }
+            Process::release_spinlock(stats_lock);
+        }
+
+#else
+
+        Stats get_stats() {
+            return Stats();
+        }
+
+        void reset_stats() {
+        }
+
+#endif
     }
 }
 
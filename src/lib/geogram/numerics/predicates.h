@@ -493,7 +493,76 @@ namespace GEO {
             return orient_3d(p0.data(),p1.data(),p2.data(),p3.data());
         }
 #endif
-        
+
+	/**
+	 * \brief Evaluates the arithmetic filter of the orientations of a
+	 *  point relative to the four facets of a tetrahedron.
+	 * \details When geogram is compiled with AVX2 support, the filter
+	 *  is evaluated for the four facets at once. No exact arithmetics
+	 *  is used, see TetFacetsOrient3d for the exact version.
+	 * \param[in] pv the four vertices of the tetrahedron
+	 * \param[in] q the query point
+	 * \param[out] result an array of four signs, where \p result[f]
+	 *  is the orientation of the tetrahedron obtained by replacing
+	 *  vertex \p f with \p q in \p pv, or ZERO if the filter could not
+	 *  determine it
+	 */
+	void GEOGRAM_API orient_3d_tet_facets_filter(
+	    const double* const* pv, const double* q, Sign* result
+	);
+
+	/**
+	 * \brief Computes the orientations of a point relative to the
+	 *  facets of a tetrahedron, on demand.
+	 * \details This is the operation used by the walk in the point
+	 *  location of 3d Delaunay triangulations. When geogram is compiled
+	 *  with AVX2 support, the arithmetic filter is evaluated for the
+	 *  four facets at once (it costs about the same as for a single
+	 *  facet), and the exact version is only evaluated for the facets
+	 *  that are queried.
+	 */
+	class TetFacetsOrient3d {
+	public:
+	    /**
+	     * \brief TetFacetsOrient3d constructor.
+	     * \param[in] pv the four vertices of the tetrahedron, stored
+	     *  by reference
+	     * \param[in] q the query point
+	     */
+	    TetFacetsOrient3d(const double* const* pv, const double* q) :
+		pv_(pv),
+		q_(q) {
+#ifdef __AVX2__
+		orient_3d_tet_facets_filter(pv, q, filter_);
+#endif
+	    }
+
+	    /**
+	     * \brief Computes the orientation of the query point relative
+	     *  to a facet.
+	     * \param[in] f the facet, in 0..3
+	     * \return the orientation of the tetrahedron obtained by 
+	     *  replacing vertex \p f with the query point
+	     */
+	    Sign operator()(index_t f) const {
+#ifdef __AVX2__
+		if(filter_[f] != ZERO) {
+		    return filter_[f];
+		}
+#endif
+		const double* p[4] = { pv_[0], pv_[1], pv_[2], pv_[3] };
+		p[f] = q_;
+		return orient_3d(p[0], p[1], p[2], p[3]);
+	    }
+
+	private:
+	    const double* const* pv_;
+	    const double* q_;
+#ifdef __AVX2__
+	    Sign filter_[4];
+#endif
+	};
+
         /**
          * \brief Computes the 4d orientation test.
          * \details Given four lifted points p0', p1', p2', and p3' in 
@@ -697,6 +766,152 @@ namespace GEO {
          */
         void GEOGRAM_API show_stats();
 
+	/**
+	 * \brief Identifiers of the predicates that have statistics.
+	 * \details Predicates that are implemented using another one
+	 *  (e.g. in_sphere_3d_SOS() that uses side4) are accounted
+	 *  in the statistics of the latter.
+	 */
+	enum PredicateId {
+	    PRED_ORIENT2D,
+	    PRED_ORIENT3D,
+	    PRED_ORIENT3DH,
+	    PRED_SIDE1,
+	    PRED_SIDE2,
+	    PRED_SIDE3,
+	    PRED_SIDE3H,
+	    PRED_SIDE4,
+	    PRED_NB
+	};
+
+	/**
+	 * \brief Gets the name of a predicate.
+	 * \param[in] id one of PRED_ORIENT2D, ... PRED_SIDE4
+	 * \return a pointer to a static string with the name of the
+	 *  predicate, as displayed by show_stats()
+	 */
+	const char* GEOGRAM_API predicate_name(PredicateId id);
+
+	/**
+	 * \brief Statistics about the invocations of a predicate.
+	 */
+	struct PredicateStats {
+
+	    /**
+	     * \brief PredicateStats constructor.
+	     * \details Initializes all counters to zero.
+	     */
+	    PredicateStats() :
+		nb_total(0),
+		nb_exact(0),
+		nb_SOS(0),
+		exact_time(0.0),
+		max_len_num(0),
+		max_len_denom(0),
+		max_len_SOS(0) {
+	    }
+
+	    /**
+	     * \brief Accumulates the counters of another PredicateStats.
+	     * \param[in] rhs the PredicateStats to be merged into this one
+	     */
+	    void merge(const PredicateStats& rhs) {
+		nb_total += rhs.nb_total;
+		nb_exact += rhs.nb_exact;
+		nb_SOS += rhs.nb_SOS;
+		exact_time += rhs.exact_time;
+		max_len_num = std::max(max_len_num, rhs.max_len_num);
+		max_len_denom = std::max(max_len_denom, rhs.max_len_denom);
+		max_len_SOS = std::max(max_len_SOS, rhs.max_len_SOS);
+	    }
+
+	    /**
+	     * \brief Gets the ratio of invocations that could not be
+	     *  decided by the floating point filter.
+	     * \return nb_exact / nb_total, or 0 if nb_total is zero
+	     */
+	    double exact_ratio() const {
+		return (nb_total == 0) ? 0.0 :
+		    double(nb_exact) / double(nb_total);
+	    }
+
+	    /** \brief total number of invocations */
+	    Numeric::uint64 nb_total;
+
+	    /** \brief number of invocations that used exact arithmetics */
+	    Numeric::uint64 nb_exact;
+
+	    /** \brief number of invocations that used symbolic perturbation */
+	    Numeric::uint64 nb_SOS;
+
+	    /**
+	     * \brief cumulated time (in seconds) spent in exact arithmetics
+	     *  and symbolic perturbation, summed over all threads.
+	     */
+	    double exact_time;
+
+	    /**
+	     * \brief maximum length of the expansions that represent the
+	     *  numerator (or the result for predicates without denominator).
+	     */
+	    index_t max_len_num;
+
+	    /** \brief maximum length of the expansions of the denominator */
+	    index_t max_len_denom;
+
+	    /** \brief maximum length of the expansions of the SOS terms */
+	    index_t max_len_SOS;
+	};
+
+	/**
+	 * \brief A snapshot of the statistics of all the predicates.
+	 */
+	struct Stats {
+	    /**
+	     * \brief Accumulates the counters of another Stats.
+	     * \param[in] rhs the Stats to be merged into this one
+	     */
+	    void merge(const Stats& rhs) {
+		for(index_t i=0; i<PRED_NB; ++i) {
+		    predicate[i].merge(rhs.predicate[i]);
+		}
+	    }
+
+	    /**
+	     * \brief Gets the statistics of a predicate.
+	     * \param[in] id one of PRED_ORIENT2D, ... PRED_SIDE4
+	     * \return a const reference to the statistics of the predicate
+	     */
+	    const PredicateStats& operator[](PredicateId id) const {
+		return predicate[id];
+	    }
+
+	    PredicateStats predicate[PRED_NB];
+	};
+
+	/**
+	 * \brief Gets the statistics about predicates.
+	 * \details Statistics are only maintained if geogram was built 
+	 *  with GEOGRAM_WITH_PREDICATE_STATS, else all counters are zero.
+	 *  Counters are maintained per thread, then merged by
+	 *  this function, together with the counters of the threads that
+	 *  were terminated since the last call to reset_stats(). The
+	 *  result is exact if no predicate is being evaluated concurrently,
+	 *  else it may miss the latest invocations.
+	 * \return a snapshot of the statistics of all predicates.
+	 */
+	Stats GEOGRAM_API get_stats();
+
+	/**
+	 * \brief Resets the statistics about predicates.
+	 * \details Can be used to measure the statistics of an algorithm,
+	 *  e.g. one stage of a pipeline, by calling reset_stats() before
+	 *  the algorithm and get_stats() after. If predicates are being
+	 *  evaluated concurrently, some of their invocations may be
+	 *  counted or not.
+	 */
+	void GEOGRAM_API reset_stats();
+
         /**
          * \brief Needs to be called before using any predicate.
          */
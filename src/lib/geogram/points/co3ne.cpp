@@ -53,6 +53,7 @@
 #include <geogram/mesh/mesh_topology.h>
 #include <geogram/mesh/mesh_reorder.h>
 #include <geogram/basic/geometry.h>
+#include <geogram/basic/geometry_nd.h>
 #include <geogram/basic/process.h>
 #include <geogram/basic/assert.h>
 #include <geogram/basic/progress.h>
@@ -173,7 +174,11 @@ namespace {
          * \brief Tentatively adds triangle from the specified list.
          * \details Some geometric and topological properties are
          *  verified by connect_and_validate_triangle() before accepting
-         *  the triangle.
+         *  the triangle. At each iteration, the tests that do not modify
+         *  the mesh are first run in parallel for all the candidate 
+         *  triangles (see precheck_triangle()), then the triangles are 
+         *  inserted in order. The result is the same as with sequential 
+         *  insertion, and does not depend on the number of threads.
          * \see connect_and_validate_triangle()
          */
         void add_triangles(const vector<index_t>& not_so_good_triangles) {
@@ -183,6 +188,14 @@ namespace {
             Logger::out("Co3ne") << "Tentatively add " 
                                  << nb_triangles << " triangles" << std::endl;
             vector<bool> t_is_classified(nb_triangles,false);
+
+            // precheck[t] caches the result of precheck_triangle(), computed
+            // in parallel at the beginning of each iteration. It remains
+            // valid as long as no triangle incident to a vertex of t was
+            // accepted during the iteration (v_stamp[v] is the last
+            // iteration where a triangle incident to v was accepted).
+            vector<Numeric::uint8> precheck(nb_triangles, PRECHECK_PASS);
+            vector<index_t> v_stamp(M_.vertices.nb(), index_t(-1));
             bool changed = true;
             index_t max_iter = strict_ ? 5000 : 50;
             index_t iter = 0;
@@ -203,15 +216,43 @@ namespace {
                 }
                 changed = false;
                 ++iter;
+                parallel_for_slice(
+                    0, nb_triangles,
+                    [&](index_t from, index_t to) {
+                        for(index_t t=from; t<to; ++t) {
+                            if(!t_is_classified[t]) {
+                                precheck[t] = precheck_triangle(
+                                    not_so_good_triangles[3*t],
+                                    not_so_good_triangles[3*t+1],
+                                    not_so_good_triangles[3*t+2]
+                                );
+                            }
+                        }
+                    }
+                );
                 for(index_t t=0; t<nb_triangles; ++t) {
                     if(!t_is_classified[t]) {
                         index_t i = not_so_good_triangles[3*t];
                         index_t j = not_so_good_triangles[3*t+1];
                         index_t k = not_so_good_triangles[3*t+2];
+                        if(
+                            precheck[t] != PRECHECK_PASS &&
+                            v_stamp[i] != iter &&
+                            v_stamp[j] != iter &&
+                            v_stamp[k] != iter
+                        ) {
+                            if(precheck[t] == PRECHECK_REJECT_CLASSIFIED) {
+                                t_is_classified[t] = true;
+                            }
+                            continue;
+                        }
                         index_t new_t = add_triangle(i,j,k);
                         bool classified = false;
                         if(connect_and_validate_triangle(new_t, classified)) {
                             changed = true;
+                            v_stamp[i] = iter;
+                            v_stamp[j] = iter;
+                            v_stamp[k] = iter;
                         } else {
                             rollback_triangle();
                         }
@@ -235,6 +276,108 @@ namespace {
 
     protected:
 
+        /**
+         * \brief Possible results of precheck_triangle().
+         */
+        enum PrecheckResult {
+            PRECHECK_REJECT,
+            PRECHECK_REJECT_CLASSIFIED,
+            PRECHECK_PASS
+        };
+
+        /**
+         * \brief Runs the tests of connect_and_validate_triangle() that
+         *  come before the triangle is connected, without modifying the
+         *  mesh.
+         * \details These tests (manifold edges, normals of the adjacent
+         *  triangles and number of adjacent triangles) only depend on the
+         *  triangles incident to the vertices of the candidate triangle,
+         *  and not on their orientations. Since nothing is modified, this
+         *  function can be called concurrently by several threads.
+         * \param[in] i , j , k the vertices of the candidate triangle
+         * \retval PRECHECK_REJECT if the triangle is rejected, but may be
+         *  accepted in a subsequent iteration
+         * \retval PRECHECK_REJECT_CLASSIFIED if the triangle is rejected
+         *  and does not need to be tested again
+         * \retval PRECHECK_PASS if connect_and_validate_triangle() needs
+         *  to be called to classify the triangle
+         */
+        Numeric::uint8 precheck_triangle(
+            index_t i, index_t j, index_t k
+        ) const {
+            index_t v[3] = { i, j, k };
+            index_t adj_t[3];
+            index_t nb_neighbors = 0;
+
+            //   Combinatorial test (I): tests whether the three 
+            // candidate edges are manifold.
+            for(index_t e=0; e<3; ++e) {
+                index_t v1 = v[e];
+                index_t v2 = v[(e+1)%3];
+                adj_t[e] = NO_FACET;
+                if(v2c_[v1] == NO_CORNER) {
+                    continue;
+                }
+                index_t c = v2c_[v1];
+                do {
+                    index_t t2 = c2f(c);
+                    if(
+                        M_.facet_corners.vertex(
+                            M_.facets.prev_corner_around_facet(t2,c)
+                        ) == v2
+                    ) {
+                        if(adj_t[e] != NO_FACET) {
+                            return PRECHECK_REJECT_CLASSIFIED;
+                        }
+                        adj_t[e] = t2;
+                    }
+                    if(
+                        M_.facet_corners.vertex(
+                            M_.facets.next_corner_around_facet(t2,c)
+                        ) == v2
+                    ) {
+                        if(adj_t[e] != NO_FACET) {
+                            return PRECHECK_REJECT_CLASSIFIED;
+                        }
+                        adj_t[e] = t2;
+                    }
+                    c = next_c_around_v_[c];
+                } while(c != v2c_[v1]);
+                if(adj_t[e] != NO_FACET) {
+                    ++nb_neighbors;
+                }
+            }
+
+            //   Geometric test.
+            for(index_t e=0; e<3; ++e) {
+                if(
+                    adj_t[e] != NO_FACET &&
+                    !triangles_normals_agree(i,j,k,adj_t[e])
+                ) {
+                    return PRECHECK_REJECT_CLASSIFIED;
+                }
+            }
+
+            // Combinatorial test (II)
+            if(nb_neighbors == 0) {
+                return PRECHECK_REJECT;
+            }
+            if(nb_neighbors == 1) {
+                if(!strict_) {
+                    return PRECHECK_REJECT;
+                }
+                for(index_t e=0; e<3; ++e) {
+                    if(
+                        adj_t[e] != NO_FACET &&
+                        v2c_[v[(e+2)%3]] != NO_CORNER
+                    ) {
+                        return PRECHECK_REJECT;
+                    }
+                }
+            }
+            return PRECHECK_PASS;
+        }
+
         /**
          * \brief Initializes the combinatorial data
          *  structures and deletes all facets incident
@@ -956,15 +1099,36 @@ namespace {
         bool triangles_normals_agree(
             index_t t1,
             index_t t2
+        ) const {
+            index_t c1 = M_.facets.corners_begin(t1);
+            return triangles_normals_agree(
+                M_.facet_corners.vertex(c1),
+                M_.facet_corners.vertex(c1+1),
+                M_.facet_corners.vertex(c1+2),
+                t2
+            );
+        }
+
+        /**
+         * \brief Tests whether the normals of a triangle given by its
+         *  vertices and of a triangle of the mesh that share an edge
+         *  'agree'.
+         * \details The first triangle does not need to be inserted in
+         *  the mesh.
+         * \param[in] i1 , j1 , k1 the vertices of the first triangle
+         * \param[in] t2 index of the second triangle
+         * \retval true if the normals of both triangles do not 
+         *  point in opposite directions
+         * \retval false otherwise
+         * \pre the two triangles have two vertices in common
+         */
+        bool triangles_normals_agree(
+            index_t i1, index_t j1, index_t k1,
+            index_t t2
         ) const {
             const vec3* points = 
                 reinterpret_cast<const vec3*>(M_.vertices.point_ptr(0));
 
-            index_t c1 = M_.facets.corners_begin(t1);
-            index_t i1 = M_.facet_corners.vertex(c1);
-            index_t j1 = M_.facet_corners.vertex(c1+1);
-            index_t k1 = M_.facet_corners.vertex(c1+2);
-            
             index_t c2 = M_.facets.corners_begin(t2);
             index_t i2 = M_.facet_corners.vertex(c2);
             index_t j2 = M_.facet_corners.vertex(c2+1);
@@ -1275,6 +1439,128 @@ namespace {
         }
     }
 
+    /**
+     * \brief Extracts a manifold surface from the raw triangles
+     *  reconstructed by Co3Ne, then post-processes it.
+     * \details The triangles are split into good and not so good 
+     *  triangles, then a manifold subset is extracted, oriented and 
+     *  repaired (if co3ne:repair is set). Only the combinatorics
+     *  and the vertices of \p mesh are used, the nearest neighbors 
+     *  search data structure is no longer needed at this stage.
+     * \param[in,out] mesh the pointset. On exit, it contains the
+     *  reconstructed surface.
+     * \param[in,out] raw_triangles the triangles generated from the
+     *  restricted Voronoi cells, as triplets of vertex indices. It is
+     *  modified by the algorithm.
+     * \param[in] progress the ProgressTask, advanced from 50 to 100
+     */
+    static void co3ne_extract_manifold(
+        Mesh& mesh, vector<index_t>& raw_triangles, ProgressTask& progress
+    ) {
+        {
+            Stopwatch W("Co3Ne manif.");
+
+            Logger::out("Co3Ne") << "Raw triangles: "
+                                 << raw_triangles.size() / 3
+                                 << std::endl;
+
+            if(CmdLine::get_arg_bool("dbg:co3ne")) {
+                Logger::out("Co3Ne") << ">> co3ne_raw.geogram"
+                                     << std::endl;
+                Mesh M;
+                M.vertices.assign_points(
+                    mesh.vertices.point_ptr(0),
+                    mesh.vertices.dimension(),
+                    mesh.vertices.nb()
+                );
+                M.facets.assign_triangle_mesh(raw_triangles, false);
+                M.vertices.set_dimension(3);
+                mesh_save(M, "co3ne_raw.geogram");
+            }
+            
+            vector<index_t> good_triangles;
+            vector<index_t> not_so_good_triangles;
+            co3ne_split_triangles_list(
+                raw_triangles, good_triangles, not_so_good_triangles
+            ); 
+
+
+            if(CmdLine::get_arg_bool("dbg:co3ne")) {
+                Logger::out("Co3Ne") << ">> co3ne_T3.geogram"
+                                     << std::endl;
+                Mesh M;
+                M.vertices.assign_points(
+                    mesh.vertices.point_ptr(0),
+                    mesh.vertices.dimension(),
+                    mesh.vertices.nb()
+                );
+                M.facets.assign_triangle_mesh(good_triangles, false);
+                M.vertices.set_dimension(3);
+                mesh_save(M, "co3ne_T3.geogram");
+            }
+
+            if(CmdLine::get_arg_bool("dbg:co3ne")) {
+                Logger::out("Co3Ne") << ">> co3ne_T12.geogram"
+                                     << std::endl;
+                Mesh M;
+                M.vertices.assign_points(
+                    mesh.vertices.point_ptr(0),
+                    mesh.vertices.dimension(),
+                    mesh.vertices.nb()
+                );
+                M.facets.assign_triangle_mesh(not_so_good_triangles, false);
+                M.vertices.set_dimension(3);
+                mesh_save(M, "co3ne_T12.geogram");
+            }
+
+	    progress.progress(53);		
+            
+            Co3NeManifoldExtraction manifold_extraction(
+                mesh, good_triangles
+            );
+
+	    progress.progress(55);				
+
+            if(CmdLine::get_arg_bool("co3ne:T12")) {
+                manifold_extraction.add_triangles(not_so_good_triangles);
+            }
+
+	    progress.progress(57);
+
+            mesh_reorient(mesh);
+
+	    progress.progress(60);		
+
+            if(CmdLine::get_arg_bool("dbg:co3ne")) {
+                Logger::out("Co3Ne") << ">> co3ne_manif.geogram"
+                                     << std::endl;
+                mesh_save(mesh, "co3ne_manif.geogram");
+            }                
+        }
+
+        if(CmdLine::get_arg_bool("co3ne:repair")) {
+            Stopwatch W("Co3Ne post.");
+            mesh_repair(mesh,
+                MeshRepairMode(
+                    MESH_REPAIR_DEFAULT | MESH_REPAIR_RECONSTRUCT
+                )
+            );
+            if(CmdLine::get_arg_bool("dbg:co3ne")) {
+                Logger::out("Co3Ne") << ">> co3ne_post.geogram"
+                                     << std::endl;
+                mesh_save(mesh, "co3ne_post.geogram");
+            }                
+        }
+
+	progress.progress(100);
+
+        Logger::out("Topology") 
+            << "nb components=" << mesh_nb_connected_components(mesh)
+            << " nb borders=" <<  mesh_nb_borders(mesh)
+            << std::endl;
+
+    }
+
     /************************************************************/
 
     /**
@@ -1807,6 +2093,24 @@ namespace {
             get_neighbors(i, neigh.data(), sq_dist.data(), nb);
         }
 
+        /**
+         * \brief Nearest neighbor search for a range of points,
+         *  in parallel.
+         * \param[in] first , last the query points are the points
+         *  first ... last-1
+         * \param[out] neigh array of (last-first)*nb index_t
+         * \param[in] nb number of neighbors to be searched
+         */
+        void get_neighbors_of_points(
+            index_t first, index_t last,
+            index_t* neigh,
+            index_t nb
+        ) const {
+            NN_->get_nearest_neighbors_of_points(
+                nb, first, last, neigh, nullptr
+            );
+        }
+
         /**
          * \brief Computes a Restricted Voronoi Cell (RVC), i.e.
          *  the intersection between a disk and the Voronoi cell
@@ -1857,41 +2161,122 @@ namespace {
         ) const {
             get_circle(i, P, N);
 
-            index_t nb_neigh = std::min(index_t(nb_points() - 1), index_t(20));
-            index_t jj = 0;
-
             // just in case, limit to 1000 neighbors.
             index_t max_neigh = std::min(index_t(1000), nb_points() - 1);
+            index_t nb_neigh = std::min(max_neigh, index_t(20));
+            if(nb_neigh == 0) {
+                return;
+            }
+            if(neighbor.size() < nb_neigh) {
+                get_neighbors(i, neighbor, squared_dist, nb_neigh);
+            }
+            nb_neigh = std::min(index_t(neighbor.size()), max_neigh);
+            if(!clip_RVC(i, P, Q, neighbor, squared_dist, nb_neigh)) {
+                return;
+            }
 
-            while(nb_neigh < max_neigh) {
-                if(P.nb_vertices() < 3) {
-                    return;
+            // All the known neighbors clipped the cell. The other points
+            // that can clip it are in the ball of security of the cell,
+            // all retrieved by a single query. The known neighbors nearer
+            // than the last one are in the ball, the ones at the same
+            // distance are remembered to be skipped.
+            double last_sq_dist = squared_dist[nb_neigh-1];
+            double R = std::min(sqROS_, 4.0 * squared_radius(point(i), P));
+            if(R < last_sq_dist || nb_neigh == max_neigh) {
+                return;
+            }
+            index_t nb_ties = 0;
+            while(
+                nb_ties < nb_neigh &&
+                squared_dist[nb_neigh-1-nb_ties] == last_sq_dist
+            ) {
+                ++nb_ties;
+            }
+            index_t* ties = (index_t*)alloca(sizeof(index_t) * nb_ties);
+            for(index_t k = 0; k < nb_ties; ++k) {
+                ties[k] = neighbor[nb_neigh-1-k];
+            }
+
+            NN_->get_neighbors_in_ball(
+                p_ + i * p_stride_, R, neighbor, squared_dist
+            );
+            index_t nb_new = 0;
+            for(index_t k = 0; k < neighbor.size(); ++k) {
+                if(
+                    squared_dist[k] < last_sq_dist || (
+                        squared_dist[k] == last_sq_dist &&
+                        std::find(ties, ties+nb_ties, neighbor[k]) !=
+                        ties+nb_ties
+                    )
+                ) {
+                    continue;
+                }
+                neighbor[nb_new] = neighbor[k];
+                ++nb_new;
+            }
+            neighbor.resize(nb_new);
+
+            // Sort the new neighbors by distance (recomputed rather than
+            // permuted along, they are the same as in the query).
+            const double* pi = p_ + i * p_stride_;
+            auto sq_dist_to_i = [this,pi](index_t j) {
+                return Geom::distance2(pi, p_ + j * p_stride_, 3);
+            };
+            std::sort(
+                neighbor.begin(), neighbor.end(),
+                [&sq_dist_to_i](index_t j1, index_t j2) {
+                    double d1 = sq_dist_to_i(j1);
+                    double d2 = sq_dist_to_i(j2);
+                    return d1 < d2 || (d1 == d2 && j1 < j2);
                 }
-                if(neighbor.size() < nb_neigh) {
-                    get_neighbors(i, neighbor, squared_dist, nb_neigh);
+            );
+            squared_dist.resize(nb_new);
+            for(index_t k = 0; k < nb_new; ++k) {
+                squared_dist[k] = sq_dist_to_i(neighbor[k]);
+            }
+            clip_RVC(
+                i, P, Q, neighbor, squared_dist,
+                std::min(nb_new, max_neigh - nb_neigh)
+            );
+        }
+
+        /**
+         * \brief Clips a Restricted Voronoi Cell by the bisectors
+         *  of the nearest neighbors, by increasing distance.
+         * \param[in] i index of the point that determines the Voronoi cell.
+         * \param[in,out] P the Restricted Voronoi Cell
+         * \param[in] Q work temporary variable, provided by caller
+         * \param[in] neighbor neighbor indices, sorted by increasing
+         *  distance
+         * \param[in] squared_dist neighbor squared distances
+         * \param[in] nb number of neighbors to be used
+         * \retval true if all the \p nb neighbors clipped the cell
+         * \retval false if further neighbors cannot clip the cell
+         */
+        bool clip_RVC(
+            index_t i, Polygon& P, Polygon& Q,
+            const vector<index_t>& neighbor,
+            const vector<double>& squared_dist,
+            index_t nb
+        ) const {
+            for(index_t jj = 0; jj < nb; ++jj) {
+                if(squared_dist[jj] < 1e-30) {
+                    continue;
                 }
-                while(jj < nb_neigh && squared_dist[jj] < 1e-30) {
-                    jj++;
+                if(P.nb_vertices() < 3) {
+                    return false;
                 }
-                while(jj < nb_neigh) {
-                    if(squared_dist[jj] > sqROS_) {
-                        return;
-                    }
-                    index_t j = neighbor[jj];
-                    double Rk = squared_radius(point(i), P);
-                    if(squared_dist[jj] > 4.0 * Rk) {
-                        return;
-                    }
-                    clip_polygon_by_bisector(P, Q, point(i), point(j), j);
-                    jj++;
+                if(squared_dist[jj] > sqROS_) {
+                    return false;
                 }
-                if(nb_neigh > 3) {
-                    nb_neigh += nb_neigh / 3;
-                } else {
-                    nb_neigh++;
+                double Rk = squared_radius(point(i), P);
+                if(squared_dist[jj] > 4.0 * Rk) {
+                    return false;
                 }
-                nb_neigh = std::min(nb_neigh, nb_points()-1);
+                index_t j = neighbor[jj];
+                clip_polygon_by_bisector(P, Q, point(i), point(j), j);
             }
+            return P.nb_vertices() >= 3;
         }
 
         /**
@@ -1932,14 +2317,18 @@ namespace {
 
     class Co3Ne;
 
+    /**
+     * \brief Number of points whose nearest neighbors are searched
+     *  at once by Co3Ne::for_each_neighborhood().
+     */
+    const index_t NEIGHBORHOODS_BLOCK_SIZE = 65536;
+
     /**
      * \brief Determines what a thread does in
      *  the multithreaded implementation of the Co3Ne reconstruction algorithm.
      */
     enum Co3NeMode {
         CO3NE_NONE,    /**< uninitialized */
-        CO3NE_NORMALS, /**< estimate normals in pointset */
-        CO3NE_SMOOTH,  /**< smooth the pointset */
         CO3NE_RECONSTRUCT, /**< reconstruct the triangles */
         CO3NE_NORMALS_AND_RECONSTRUCT
         /**< combined normal estimation and reconstruction */
@@ -1982,12 +2371,6 @@ namespace {
          */
 	void run() override {
             switch(mode_) {
-                case CO3NE_NORMALS:
-                    run_normals();
-                    break;
-                case CO3NE_SMOOTH:
-                    run_smooth();
-                    break;
                 case CO3NE_RECONSTRUCT:
                     run_reconstruct();
                     break;
@@ -2017,16 +2400,6 @@ namespace {
         }
 
     protected:
-        /**
-         * \brief Estimates the normals in the pointset.
-         */
-        void run_normals();
-
-        /**
-         * \brief Smoothes the pointset.
-         */
-        void run_smooth();
-
         /**
          * \brief Reconstructs the triangles.
          */
@@ -2097,6 +2470,39 @@ namespace {
 	void run_threads() {
 	    Process::run_threads(thread_);
 	}
+
+        /**
+         * \brief Calls a function for each point and its nearest
+         *  neighbors, in parallel.
+         * \details The nearest neighbors are searched by blocks of
+         *  points, with
+         *  NearestNeighborSearch::get_nearest_neighbors_of_points().
+         * \param[in] f the function, called with the index of a point,
+         *  a pointer to its RVD().nb_neighbors() nearest neighbors
+         *  and a work variable
+         */
+        template <class F> void for_each_neighborhood(const F& f) {
+            index_t nb = RVD_.nb_points();
+            index_t nb_neigh = RVD_.nb_neighbors();
+            index_t block_size = std::min(nb, NEIGHBORHOODS_BLOCK_SIZE);
+            vector<index_t> neigh(block_size * nb_neigh);
+            for(index_t b = 0; b < nb; b += block_size) {
+                index_t e = std::min(b + block_size, nb);
+                RVD_.get_neighbors_of_points(b, e, neigh.data(), nb_neigh);
+                parallel_for_slice(
+                    b, e,
+                    [&](index_t from, index_t to) {
+                        PrincipalAxes3d least_squares_normal;
+                        for(index_t i = from; i < to; ++i) {
+                            f(
+                                i, neigh.data() + (i - b) * nb_neigh,
+                                least_squares_normal
+                            );
+                        }
+                    }
+                );
+            }
+        }
 	
         /**
          * \brief Estimates the normals of the point set.
@@ -2114,10 +2520,19 @@ namespace {
             }
             RVD_.init(mesh_);
             RVD_.set_nb_neighbors(nb_neighbors);
-            for(index_t t = 0; t < thread_.size(); t++) {
-                thread_[t]->set_mode(CO3NE_NORMALS);
-            }
-            run_threads();
+            for_each_neighborhood(
+                [this](
+                    index_t i, const index_t* neigh,
+                    PrincipalAxes3d& least_squares_normal
+                ) {
+                    least_squares_normal.begin();
+                    for(index_t jj = 0; jj < RVD_.nb_neighbors(); jj++) {
+                        least_squares_normal.add_point(RVD_.point(neigh[jj]));
+                    }
+                    least_squares_normal.end();
+                    set_normal(i, least_squares_normal.normal());
+                }
+            );
         }
 
 	static inline double cos_angle(
@@ -2201,10 +2616,23 @@ namespace {
         void smooth(index_t nb_neighbors) {
             new_vertices_.resize(mesh_.vertices.nb() * 3);
             RVD_.set_nb_neighbors(nb_neighbors);
-            for(index_t t = 0; t < thread_.size(); t++) {
-                thread_[t]->set_mode(CO3NE_SMOOTH);
-            }
-            run_threads();
+            for_each_neighborhood(
+                [this](
+                    index_t i, const index_t* neigh,
+                    PrincipalAxes3d& least_squares_normal
+                ) {
+                    least_squares_normal.begin();
+                    for(index_t jj = 0; jj < RVD_.nb_neighbors(); jj++) {
+                        least_squares_normal.add_point(RVD_.point(neigh[jj]));
+                    }
+                    least_squares_normal.end();
+                    vec3 N = normalize(least_squares_normal.normal());
+                    vec3 g = least_squares_normal.center();
+                    vec3 d = RVD_.point(i) - g;
+                    d -= dot(d, N) * N;
+                    set_point(i, g + d);
+                }
+            );
             /*
               // TODO: once 'steal-arg' mode works for vertices,
               // we can use this one.
@@ -2240,6 +2668,28 @@ namespace {
          *  points adjacencies.
          */
         void reconstruct(double r) {
+	    ProgressTask progress("reconstruct",100);
+	    progress.progress(1);
+            vector<index_t> raw_triangles;
+            compute_raw_triangles(r, raw_triangles);
+	    progress.progress(50);
+            RVD_.clear();  // reclaim memory used by ANN
+            co3ne_extract_manifold(mesh_, raw_triangles, progress);
+        }
+
+        /**
+         * \brief Computes the triangles generated by the restricted
+         *  Voronoi cells of the points, before manifold extraction.
+         * \details If the mesh has a "normal" vertex attribute,
+         *  then the existing normals are used, else normals are estimated.
+         *  For each point i, the triangles (i,j,k) generated by the
+         *  restricted Voronoi cell of i are stored with i first.
+         * \param[in] r maximum distance used to determine
+         *  points adjacencies
+         * \param[out] raw_triangles the triangles, as triplets of
+         *  vertex indices, ordered by increasing first vertex
+         */
+        void compute_raw_triangles(double r, vector<index_t>& raw_triangles) {
             bool has_normals = false;
             {
                 Attribute<double> normal;
@@ -2249,20 +2699,14 @@ namespace {
                 );
             }
 
-	    ProgressTask progress("reconstruct",100);
-
+            Stopwatch W("Co3Ne recons");
             if(has_normals) {
-                Stopwatch W("Co3Ne recons");
                 RVD_.set_circles_radius(r);
                 for(index_t t = 0; t < thread_.size(); t++) {
                     thread_[t]->set_mode(CO3NE_RECONSTRUCT);
                     thread_[t]->triangles().clear();
                 }
-		progress.progress(1);
-                run_threads();
-		progress.progress(50);
             } else {
-                Stopwatch W("Co3Ne recons");                
                 Logger::out("Co3Ne")
                     << "using combined \'normals and reconstruct\'"
                     << std::endl;
@@ -2274,130 +2718,23 @@ namespace {
                     thread_[t]->set_mode(CO3NE_NORMALS_AND_RECONSTRUCT);
                     thread_[t]->triangles().clear();
                 }
-		progress.progress(1);		
-                run_threads();
-		progress.progress(50);		
-            }
-
-            {
-                Stopwatch W("Co3Ne manif.");
-                RVD_.clear();  // reclaim memory used by ANN
-
-                index_t nb_triangles = 0;
-                for(index_t t = 0; t < thread_.size(); t++) {
-                    nb_triangles += thread_[t]->nb_triangles();
-                }
-
-                Logger::out("Co3Ne") << "Raw triangles: "
-                                     << nb_triangles
-                                     << std::endl;
-
-                vector<index_t> raw_triangles; 
-                raw_triangles.reserve(nb_triangles * 3);
-                for(index_t th = 0; th < thread_.size(); th++) {
-                    vector<index_t>& triangles = thread_[th]->triangles();
-                    raw_triangles.insert(
-                        raw_triangles.end(), 
-                        triangles.begin(), triangles.end()
-                        );
-                    thread_[th]->triangles().clear();
-                }
-
-                if(CmdLine::get_arg_bool("dbg:co3ne")) {
-                    Logger::out("Co3Ne") << ">> co3ne_raw.geogram"
-                                         << std::endl;
-                    Mesh M;
-                    M.vertices.assign_points(
-                        mesh_.vertices.point_ptr(0),
-                        mesh_.vertices.dimension(),
-                        mesh_.vertices.nb()
-                    );
-                    M.facets.assign_triangle_mesh(raw_triangles, false);
-                    M.vertices.set_dimension(3);
-                    mesh_save(M, "co3ne_raw.geogram");
-                }
-                
-                vector<index_t> good_triangles;
-                vector<index_t> not_so_good_triangles;
-                co3ne_split_triangles_list(
-                    raw_triangles, good_triangles, not_so_good_triangles
-                ); 
-
-
-                if(CmdLine::get_arg_bool("dbg:co3ne")) {
-                    Logger::out("Co3Ne") << ">> co3ne_T3.geogram"
-                                         << std::endl;
-                    Mesh M;
-                    M.vertices.assign_points(
-                        mesh_.vertices.point_ptr(0),
-                        mesh_.vertices.dimension(),
-                        mesh_.vertices.nb()
-                    );
-                    M.facets.assign_triangle_mesh(good_triangles, false);
-                    M.vertices.set_dimension(3);
-                    mesh_save(M, "co3ne_T3.geogram");
-                }
-
-                if(CmdLine::get_arg_bool("dbg:co3ne")) {
-                    Logger::out("Co3Ne") << ">> co3ne_T12.geogram"
-                                         << std::endl;
-                    Mesh M;
-                    M.vertices.assign_points(
-                        mesh_.vertices.point_ptr(0),
-                        mesh_.vertices.dimension(),
-                        mesh_.vertices.nb()
-                    );
-                    M.facets.assign_triangle_mesh(not_so_good_triangles, false);
-                    M.vertices.set_dimension(3);
-                    mesh_save(M, "co3ne_T12.geogram");
-                }
-
-		progress.progress(53);		
-                
-                Co3NeManifoldExtraction manifold_extraction(
-                    mesh_, good_triangles
-                );
-
-		progress.progress(55);				
-
-                if(CmdLine::get_arg_bool("co3ne:T12")) {
-                    manifold_extraction.add_triangles(not_so_good_triangles);
-                }
-
-		progress.progress(57);
-
-                mesh_reorient(mesh_);
-
-		progress.progress(60);		
-
-                if(CmdLine::get_arg_bool("dbg:co3ne")) {
-                    Logger::out("Co3Ne") << ">> co3ne_manif.geogram"
-                                         << std::endl;
-                    mesh_save(mesh_, "co3ne_manif.geogram");
-                }                
             }
+            run_threads();
 
-            if(CmdLine::get_arg_bool("co3ne:repair")) {
-                Stopwatch W("Co3Ne post.");
-                mesh_repair(mesh_,
-                    MeshRepairMode(
-                        MESH_REPAIR_DEFAULT | MESH_REPAIR_RECONSTRUCT
-                    )
+            index_t nb_triangles = 0;
+            for(index_t t = 0; t < thread_.size(); t++) {
+                nb_triangles += thread_[t]->nb_triangles();
+            }
+            raw_triangles.clear();
+            raw_triangles.reserve(nb_triangles * 3);
+            for(index_t th = 0; th < thread_.size(); th++) {
+                vector<index_t>& triangles = thread_[th]->triangles();
+                raw_triangles.insert(
+                    raw_triangles.end(), 
+                    triangles.begin(), triangles.end()
                 );
-                if(CmdLine::get_arg_bool("dbg:co3ne")) {
-                    Logger::out("Co3Ne") << ">> co3ne_post.geogram"
-                                         << std::endl;
-                    mesh_save(mesh_, "co3ne_post.geogram");
-                }                
+                thread_[th]->triangles().clear();
             }
-
-	    progress.progress(100);		
-	    
-            Logger::out("Topology") 
-                << "nb components=" << mesh_nb_connected_components(mesh_)
-                << " nb borders=" <<  mesh_nb_borders(mesh_)
-                << std::endl;
-
         }
 
         /**
@@ -2455,48 +2792,6 @@ namespace {
 
     /************************************************************************/
 
-    void Co3NeThread::run_normals() {
-        Co3NeRestrictedVoronoiDiagram& RVD = master_->RVD();
-        index_t nb_neigh = RVD.nb_neighbors();
-        vector<index_t> neigh(nb_neigh);
-        vector<double> sq_dist(nb_neigh);
-
-        for(index_t i = from_; i < to_; i++) {
-            RVD.get_neighbors(
-                i, neigh, sq_dist, nb_neigh
-            );
-            least_squares_normal_.begin();
-            for(index_t jj = 0; jj < neigh.size(); jj++) {
-                least_squares_normal_.add_point(RVD.point(neigh[jj]));
-            }
-            least_squares_normal_.end();
-            master_->set_normal(i, least_squares_normal_.normal());
-        }
-    }
-
-    void Co3NeThread::run_smooth() {
-        Co3NeRestrictedVoronoiDiagram& RVD = master_->RVD();
-        index_t nb_neigh = RVD.nb_neighbors();
-        vector<index_t> neigh(nb_neigh);
-        vector<double> sq_dist(nb_neigh);
-
-        for(index_t i = from_; i < to_; i++) {
-            RVD.get_neighbors(
-                i, neigh, sq_dist, nb_neigh
-            );
-            least_squares_normal_.begin();
-            for(index_t jj = 0; jj < neigh.size(); jj++) {
-                least_squares_normal_.add_point(RVD.point(neigh[jj]));
-            }
-            least_squares_normal_.end();
-            vec3 N = normalize(least_squares_normal_.normal());
-            vec3 g = least_squares_normal_.center();
-            vec3 d = RVD.point(i) - g;
-            d -= dot(d, N) * N;
-            master_->set_point(i, g + d);
-        }
-    }
-
     void Co3NeThread::run_reconstruct() {
         Co3NeRestrictedVoronoiDiagram& RVD = master_->RVD();
         vector<index_t> neigh(100);
@@ -2625,6 +2920,336 @@ namespace {
             Process::leave_critical_section();
         }
     }
+
+    /************************************************************/
+
+    /**
+     * \brief Reconstructs a pointset by tiles.
+     * \details The pointset is partitioned by recursive bisection into
+     *  tiles with a bounded number of points. Each tile is extended with
+     *  the points nearer than a margin from its bounding box, and is 
+     *  processed independently (smoothing, normals and triangles 
+     *  generated by the restricted Voronoi cells), so that the nearest 
+     *  neighbors search data structure is only created for one tile at
+     *  a time. The triangles generated by the points of all the tiles 
+     *  are then gathered, and the manifold extraction is done globally,
+     *  which ensures a consistent output along the tiles borders.
+     */
+    class Co3NeTiledReconstruction {
+    public:
+        /**
+         * \brief Constructs a new Co3NeTiledReconstruction.
+         * \param[in,out] M the input pointset and the output mesh
+         * \param[in] max_tile_points maximum number of points in a tile,
+         *  not counting the points in the margin
+         * \param[in] margin width of the overlap between the tiles
+         */
+        Co3NeTiledReconstruction(
+            Mesh& M, index_t max_tile_points, double margin
+        ) :
+            mesh_(M),
+            max_tile_points_(max_tile_points),
+            margin_(margin),
+            nb_neighbors_(0),
+            nb_iterations_(0),
+            radius_(0.0),
+            nb_tiles_(0) {
+        }
+
+        /**
+         * \brief Smoothes the pointset and reconstructs the triangles.
+         * \param[in] nb_neighbors number of neighbors used to compute the
+         *  best approximating tangent planes
+         * \param[in] nb_iterations number of smoothing iterations
+         * \param[in] radius maximum distance used to connect neighbors 
+         *  with triangles
+         */
+        void reconstruct(
+            index_t nb_neighbors, index_t nb_iterations, double radius
+        ) {
+            nb_neighbors_ = nb_neighbors;
+            nb_iterations_ = nb_iterations;
+            radius_ = radius;
+            nb_tiles_ = 0;
+
+            // Each tile needs enough points for the nearest neighbors
+            // queries.
+            max_tile_points_ = std::max(
+                max_tile_points_, 2 * (nb_neighbors_ + 1)
+            );
+            
+            index_t nb = mesh_.vertices.nb();
+            sorted_.resize(nb);
+            for(index_t i = 0; i < nb; ++i) {
+                sorted_[i] = i;
+            }
+            if(nb_iterations_ != 0) {
+                smoothed_.resize(3 * nb);
+            }
+
+            {
+                Stopwatch W("Co3Ne tiles");
+                vector<index_t> halo;
+                split(0, nb, halo);
+                Logger::out("Co3Ne") << "Processed " << nb_tiles_ 
+                                     << " tiles" << std::endl;
+            }
+            sorted_.clear();
+
+            if(nb_iterations_ != 0) {
+                for(index_t i = 0; i < nb; ++i) {
+                    double* p = mesh_.vertices.point_ptr(i);
+                    for(coord_index_t c = 0; c < 3; ++c) {
+                        p[c] = smoothed_[3 * i + c];
+                    }
+                }
+                smoothed_.clear();
+            }
+
+            mesh_.facets.clear();
+	    ProgressTask progress("reconstruct",100);
+	    progress.progress(50);
+            co3ne_extract_manifold(mesh_, raw_triangles_, progress);
+            raw_triangles_.clear();
+        }
+
+    protected:
+        /**
+         * \brief Gets a point by index.
+         * \param[in] i the index of the point
+         * \return a const reference to the point
+         */
+        const vec3& point(index_t i) const {
+            return *reinterpret_cast<const vec3*>(
+                mesh_.vertices.point_ptr(i)
+            );
+        }
+
+        /**
+         * \brief Computes the bounding box of a subset of the points,
+         *  enlarged by the margin.
+         * \param[in] b , e the subset, as a range in sorted_
+         * \param[out] box the enlarged bounding box
+         */
+        void get_enlarged_bbox(index_t b, index_t e, Box& box) const {
+            for(coord_index_t c = 0; c < 3; ++c) {
+                box.xyz_min[c] = Numeric::max_float64();
+                box.xyz_max[c] = -Numeric::max_float64();
+            }
+            for(index_t i = b; i < e; ++i) {
+                const vec3& p = point(sorted_[i]);
+                for(coord_index_t c = 0; c < 3; ++c) {
+                    box.xyz_min[c] = std::min(box.xyz_min[c], p[c]);
+                    box.xyz_max[c] = std::max(box.xyz_max[c], p[c]);
+                }
+            }
+            for(coord_index_t c = 0; c < 3; ++c) {
+                box.xyz_min[c] -= margin_;
+                box.xyz_max[c] += margin_;
+            }
+        }
+
+        /**
+         * \brief Gathers the points of two lists that are in a box.
+         * \param[in] box the box
+         * \param[in] halo the first list of points
+         * \param[in] b , e the second list of points, as a range in
+         *  sorted_
+         * \param[out] result the points of both lists in \p box
+         */
+        void get_points_in_box(
+            const Box& box, const vector<index_t>& halo,
+            index_t b, index_t e, vector<index_t>& result
+        ) const {
+            result.clear();
+            for(index_t i = 0; i < halo.size(); ++i) {
+                if(box.contains(point(halo[i]))) {
+                    result.push_back(halo[i]);
+                }
+            }
+            for(index_t i = b; i < e; ++i) {
+                if(box.contains(point(sorted_[i]))) {
+                    result.push_back(sorted_[i]);
+                }
+            }
+        }
+
+        /**
+         * \brief Recursively splits a set of points into tiles.
+         * \param[in] b , e the points of the tile, as a range in sorted_
+         * \param[in] halo the points in the margin of the tile
+         */
+        void split(index_t b, index_t e, const vector<index_t>& halo) {
+            if(e - b <= max_tile_points_) {
+                reconstruct_tile(b, e, halo);
+                return;
+            }
+
+            // Split along the longest axis of the bounding box
+            Box box;
+            get_enlarged_bbox(b, e, box);
+            coord_index_t axis = 0;
+            for(coord_index_t c = 1; c < 3; ++c) {
+                if(
+                    box.xyz_max[c] - box.xyz_min[c] >
+                    box.xyz_max[axis] - box.xyz_min[axis]
+                ) {
+                    axis = c;
+                }
+            }
+            index_t m = b + (e - b) / 2;
+            std::nth_element(
+                sorted_.begin() + std::ptrdiff_t(b),
+                sorted_.begin() + std::ptrdiff_t(m),
+                sorted_.begin() + std::ptrdiff_t(e),
+                [this, axis](index_t i, index_t j) {
+                    double ci = point(i)[axis];
+                    double cj = point(j)[axis];
+                    return ci < cj || (ci == cj && i < j);
+                }
+            );
+
+            vector<index_t> halo1;
+            vector<index_t> halo2;
+            get_enlarged_bbox(b, m, box);
+            get_points_in_box(box, halo, m, e, halo1);
+            get_enlarged_bbox(m, e, box);
+            get_points_in_box(box, halo, b, m, halo2);
+            split(b, m, halo1);
+            halo1.clear();
+            split(m, e, halo2);
+        }
+
+        /**
+         * \brief Reconstructs the triangles of a tile.
+         * \details The triangles generated by the points of the tile
+         *  are appended to raw_triangles_. If smoothing is used, the
+         *  smoothed points of the tile are stored in smoothed_.
+         * \param[in] b , e the points of the tile, as a range in sorted_
+         * \param[in] halo the points in the margin of the tile
+         */
+        void reconstruct_tile(
+            index_t b, index_t e, const vector<index_t>& halo
+        ) {
+            ++nb_tiles_;
+            index_t nb_core = e - b;
+            Logger::out("Co3Ne") << "Tile " << nb_tiles_ << ": "
+                                 << nb_core << " points + "
+                                 << halo.size() << " in margin"
+                                 << std::endl;
+
+            // The points of the tile are ordered like in the mesh, so that
+            // ties in the nearest neighbors queries are resolved in the 
+            // same way as with the whole pointset.
+            std::sort(
+                sorted_.begin() + std::ptrdiff_t(b),
+                sorted_.begin() + std::ptrdiff_t(e)
+            );
+            vector<index_t> sorted_halo(halo);
+            std::sort(sorted_halo.begin(), sorted_halo.end());
+            vector<index_t> tile2mesh(nb_core + halo.size());
+            vector<bool> is_core(tile2mesh.size());
+            index_t i1 = b;
+            index_t i2 = 0;
+            for(index_t i = 0; i < tile2mesh.size(); ++i) {
+                is_core[i] = (
+                    i2 == sorted_halo.size() ||
+                    (i1 < e && sorted_[i1] < sorted_halo[i2])
+                );
+                tile2mesh[i] = is_core[i] ? sorted_[i1++] : sorted_halo[i2++];
+            }
+            sorted_halo.clear();
+
+            Mesh tile;
+            tile.vertices.set_dimension(3);
+            tile.vertices.create_vertices(tile2mesh.size());
+            for(index_t i = 0; i < tile2mesh.size(); ++i) {
+                const vec3& p = point(tile2mesh[i]);
+                double* q = tile.vertices.point_ptr(i);
+                q[0] = p.x;
+                q[1] = p.y;
+                q[2] = p.z;
+            }
+            {
+                Attribute<double> normal;
+                normal.bind_if_is_defined(mesh_.vertices.attributes(),"normal");
+                if(normal.is_bound() && normal.dimension() == 3) {
+                    Attribute<double> tile_normal;
+                    tile_normal.create_vector_attribute(
+                        tile.vertices.attributes(), "normal", 3
+                    );
+                    for(index_t i = 0; i < tile2mesh.size(); ++i) {
+                        for(index_t c = 0; c < 3; ++c) {
+                            tile_normal[3 * i + c] =
+                                normal[3 * tile2mesh[i] + c];
+                        }
+                    }
+                }
+            }
+
+            Co3Ne co3ne(tile);
+            if(nb_iterations_ != 0) {
+                co3ne.RVD().set_exact(false);
+                for(index_t i = 0; i < nb_iterations_; i++) {
+                    co3ne.smooth(nb_neighbors_);
+                    co3ne.RVD().update();
+                }
+                co3ne.end_smooth();
+                for(index_t i = 0; i < tile2mesh.size(); ++i) {
+                    if(is_core[i]) {
+                        const double* p = tile.vertices.point_ptr(i);
+                        for(coord_index_t c = 0; c < 3; ++c) {
+                            smoothed_[3 * tile2mesh[i] + c] = p[c];
+                        }
+                    }
+                }
+            }
+            co3ne.RVD().set_exact(true);
+
+            // Keep the triangles generated by the restricted Voronoi
+            // cells of the points of the tile (the first vertex of each
+            // triangle is the point that generated it).
+            vector<index_t> triangles;
+            co3ne.compute_raw_triangles(radius_, triangles);
+            for(index_t t = 0; t < triangles.size() / 3; ++t) {
+                if(is_core[triangles[3 * t]]) {
+                    for(index_t c = 0; c < 3; ++c) {
+                        raw_triangles_.push_back(
+                            tile2mesh[triangles[3 * t + c]]
+                        );
+                    }
+                }
+            }
+        }
+
+    private:
+        Mesh& mesh_;
+        index_t max_tile_points_;
+        double margin_;
+        index_t nb_neighbors_;
+        index_t nb_iterations_;
+        double radius_;
+        index_t nb_tiles_;
+
+        /**
+         * \brief The indices of the points, reordered in such a
+         *  way that each tile corresponds to a contiguous range.
+         */
+        vector<index_t> sorted_;
+
+        /**
+         * \brief The triangles generated by all the tiles.
+         */
+        vector<index_t> raw_triangles_;
+
+        /**
+         * \brief The smoothed coordinates of the points. They are
+         *  copied to the mesh once all the tiles are processed, since
+         *  the original coordinates are needed by the margins of the 
+         *  subsequent tiles.
+         */
+        vector<double> smoothed_;
+    };
 }
 
 /****************************************************************************/
@@ -2715,5 +3340,14 @@ namespace GEO {
         co3ne.RVD().set_exact(true);
         co3ne.reconstruct(radius);
     }
+
+    void Co3Ne_smooth_and_reconstruct_tiled(
+        Mesh& M, index_t nb_neighbors, index_t nb_iterations, double radius,
+        index_t max_tile_points, double margin
+    ) {
+        Stopwatch W("Co3Ne total");
+        Co3NeTiledReconstruction tiles(M, max_tile_points, margin);
+        tiles.reconstruct(nb_neighbors, nb_iterations, radius);
+    }
 }
 
@@ -114,6 +114,33 @@ namespace GEO {
     void GEOGRAM_API Co3Ne_smooth_and_reconstruct(
         Mesh& M, index_t nb_neighbors, index_t nb_iterations, double radius
     );
+
+    /**
+     * \brief Smoothes and reconstructs a large pointset by tiles.
+     * \details The pointset is partitioned into tiles of at most
+     *  \p max_tile_points points. Each tile, extended with the points
+     *  nearer than \p margin, is smoothed and generates its candidate 
+     *  triangles independently, so that the nearest neighbors search
+     *  data structure only exists for one tile at a time. The candidate
+     *  triangles of all the tiles are then merged into a single manifold
+     *  surface. Without smoothing, when \p margin is larger than the 
+     *  neighborhoods used by the algorithm (typically 2 * \p radius), 
+     *  the result is the same as with Co3Ne_smooth_and_reconstruct(),
+     *  up to ties between equidistant nearest neighbors.
+     * \param[in,out] M the input pointset and the output mesh
+     * \param[in] nb_neighbors number of neighbors used to compute the
+     *  best approximating tangent planes
+     * \param[in] nb_iterations number of smoothing iterations
+     * \param[in] radius maximum distance used to connect neighbors with
+     *  triangles
+     * \param[in] max_tile_points maximum number of points in a tile,
+     *  not counting the points in the margin
+     * \param[in] margin width of the overlap between neighboring tiles
+     */
+    void GEOGRAM_API Co3Ne_smooth_and_reconstruct_tiled(
+        Mesh& M, index_t nb_neighbors, index_t nb_iterations, double radius,
+        index_t max_tile_points, double margin
+    );
 }
 
 #endif
@@ -84,50 +84,24 @@ namespace {
             return NN_->nb_points();
         }
 
-        /**
-         * \brief Finds the nearest neighbors of a given point.
-         * \param[in] i index of the query point
-         * \param[in] nb maximum number of neighbors
-         * \return true when all the neighbors nearer than
-         *    tolerance have been found, false otherwise.
-         */
-        bool find_nearest_neighbors(index_t i, index_t nb) {
-            // allocated on the stack, more multithread-friendly
-            // and no need to deallocate (and VC++ does not support
-            // int neighbors[nb] where nb is a variable)
-            index_t* neighbors = (index_t*) alloca(sizeof(index_t) * nb);
-            double* dist = (double*) alloca(sizeof(double) * nb);
-
-            NN_->get_nearest_neighbors(
-                nb, NN_->point_ptr(i), neighbors, dist
-            );
-
-            index_t smallest = i;
-            for(index_t jj = 0; jj < nb; jj++) {
-                if(dist[jj] > sq_tolerance_) {
-                    old2new_[i] = smallest;
-                    return true;
-                }
-                smallest = std::min(smallest, neighbors[jj]);
-            }
-            old2new_[i] = smallest;
-            return false;
-        }
-
         /**
          * \brief Finds all the neighbors nearer than tolerance from 
-         * a given point.
-         * \details Called in parallel using parallel_for().
-         * \param[in] i index of the query point
+         * the points of a range.
+         * \details Called in parallel using parallel_for_slice().
+         * \param[in] from , to the query points are from ... to-1
          */
-        void do_it(index_t i) {
-            index_t nb = std::min(index_t(6),nb_points());
-            while(!find_nearest_neighbors(i, nb) && nb < nb_points()) {
-                if(nb == nb_points()) {
-                    break;
+        void do_it(index_t from, index_t to) {
+            vector<index_t> neighbors;
+            vector<double> sq_dist;
+            for(index_t i = from; i < to; ++i) {
+                NN_->get_neighbors_in_ball(
+                    NN_->point_ptr(i), sq_tolerance_, neighbors, sq_dist
+                );
+                index_t smallest = i;
+                for(index_t j: neighbors) {
+                    smallest = std::min(smallest, j);
                 }
-                nb += nb / 2;
-                nb = std::min(nb, nb_points());
+                old2new_[i] = smallest;
             }
         }
 
@@ -242,15 +216,14 @@ namespace GEO {
             Colocate colocate_obj(NN, old2new, tolerance);
 	    
             if(CmdLine::get_arg_bool("sys:multithread")) {
-                parallel_for(
+                parallel_for_slice(
 		    0, nb_points,
-		    [&colocate_obj](index_t i){ colocate_obj.do_it(i); },
-		    1, true
+		    [&colocate_obj](index_t from, index_t to) {
+                        colocate_obj.do_it(from, to);
+                    }
 		);
             } else {
-                for(index_t i = 0; i < nb_points; i++) {
-                    colocate_obj.do_it(i);
-                }
+                colocate_obj.do_it(0, nb_points);
             }
             index_t result = 0;
             for(index_t i = 0; i < old2new.size(); i++) {
@@ -0,0 +1,413 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/points/dynamic_kd_tree.h>
+#include <geogram/basic/geometry_nd.h>
+
+namespace GEO {
+
+    DynamicKdTree::Level::Level(
+        const DynamicKdTree* tree, const vector<index_t>& ids
+    ) :
+        BalancedKdTree(tree->dimension())
+    {
+        coord_index_t dim = dimension();
+        coords_.resize(size_t(ids.size()) * dim);
+        for(index_t i=0; i<ids.size(); ++i) {
+            const double* p = tree->point_ptr(ids[i]);
+            double* q = coords_.data() + size_t(i) * dim;
+            for(coord_index_t c=0; c<dim; ++c) {
+                q[c] = p[c];
+            }
+        }
+        set_points(ids.size(), coords_.data());
+        leaf_ids_.resize(ids.size());
+        for(index_t i=0; i<ids.size(); ++i) {
+            leaf_ids_[i] = ids[point_index_[i]];
+        }
+        leaf_alive_.assign(ids.size(), 1);
+    }
+
+    void DynamicKdTree::Level::find_nearest_neighbors(
+        const double* query_point, NearestNeighbors& NN
+    ) const {
+        double box_dist = 0.0;
+        double* bbox_min = (double*) (alloca(dimension() * sizeof(double)));
+        double* bbox_max = (double*) (alloca(dimension() * sizeof(double)));
+	init_bbox_and_bbox_dist_for_traversal(
+	    bbox_min, bbox_max, box_dist, query_point
+	);
+        if(box_dist > NN.furthest_neighbor_sq_dist()) {
+            return;
+        }
+        get_nearest_neighbors_recursive(
+            root_, 0, nb_points(), bbox_min, bbox_max, box_dist, 
+            query_point, NN
+        );
+    }
+
+    void DynamicKdTree::Level::find_neighbors_in_ball(
+        const double* query_point, double sq_radius,
+        vector<index_t>& neighbors,
+        vector<double>& neighbors_sq_dist
+    ) const {
+        double box_dist = 0.0;
+        double* bbox_min = (double*) (alloca(dimension() * sizeof(double)));
+        double* bbox_max = (double*) (alloca(dimension() * sizeof(double)));
+	init_bbox_and_bbox_dist_for_traversal(
+	    bbox_min, bbox_max, box_dist, query_point
+	);
+        if(box_dist > sq_radius) {
+            return;
+        }
+        get_neighbors_in_ball_recursive(
+            root_, 0, nb_points(), bbox_min, bbox_max, box_dist,
+            query_point, sq_radius, neighbors, neighbors_sq_dist
+        );
+    }
+
+    void DynamicKdTree::Level::get_nearest_neighbors_leaf(
+        index_t node_index, index_t b, index_t e,
+        const double* query_point,
+        NearestNeighbors& NN
+    ) const {
+	geo_argused(node_index);
+        NN.nb_visited += (e-b);
+	double local_sq_dist[MAX_LEAF_SIZE];
+	get_leaf_sq_dist(b, e, query_point, local_sq_dist);
+	double R = NN.furthest_neighbor_sq_dist();
+        for(index_t ii=0; ii<e-b; ++ii) {
+	    double sq_dist = local_sq_dist[ii];
+            if(sq_dist <= R && leaf_alive_[b+ii]) {
+                NN.insert(leaf_ids_[b+ii], sq_dist);
+                R = NN.furthest_neighbor_sq_dist();
+            }
+        }
+    }
+
+    void DynamicKdTree::Level::get_neighbors_in_ball_leaf(
+        index_t node_index, index_t b, index_t e,
+        const double* query_point,
+        double sq_radius,
+        vector<index_t>& neighbors,
+        vector<double>& neighbors_sq_dist
+    ) const {
+	geo_argused(node_index);
+	double local_sq_dist[MAX_LEAF_SIZE];
+	get_leaf_sq_dist(b, e, query_point, local_sq_dist);
+        for(index_t ii=0; ii<e-b; ++ii) {
+	    double sq_dist = local_sq_dist[ii];
+            if(sq_dist <= sq_radius && leaf_alive_[b+ii]) {
+                neighbors.push_back(leaf_ids_[b+ii]);
+                neighbors_sq_dist.push_back(sq_dist);
+            }
+        }
+    }
+
+    /**************************************************************/
+
+    DynamicKdTree::DynamicKdTree(coord_index_t dim) :
+        NearestNeighborSearch(dim),
+        nb_alive_points_(0) {
+        stride_ = dim;
+    }
+
+    DynamicKdTree::~DynamicKdTree() {
+    }
+
+    bool DynamicKdTree::stride_supported() const {
+        return true;
+    }
+
+    void DynamicKdTree::set_points(index_t nb_points, const double* points) {
+        set_points(nb_points, points, dimension());
+    }
+
+    void DynamicKdTree::set_points(
+        index_t nb_points, const double* points, index_t stride
+    ) {
+        coord_index_t dim = dimension();
+        coords_.resize(size_t(nb_points) * dim);
+        for(index_t i=0; i<nb_points; ++i) {
+            for(coord_index_t c=0; c<dim; ++c) {
+                coords_.data()[size_t(i)*dim+c] = points[size_t(i)*stride+c];
+            }
+        }
+        location_.assign(nb_points, index_t(BUFFER));
+        position_.resize(nb_points);
+        nb_alive_points_ = nb_points;
+        update_points_ptr();
+        rebuild();
+    }
+
+    index_t DynamicKdTree::insert_point(const double* p) {
+        index_t result = nb_points();
+        // p may point into coords_ (for instance when duplicating a
+        // point), and insert() may reallocate coords_: copy it first.
+        double* q = (double*) (alloca(dimension() * sizeof(double)));
+        Memory::copy(q, p, dimension() * sizeof(double));
+        coords_.insert(coords_.end(), q, q+dimension());
+        location_.push_back(index_t(REMOVED));
+        position_.push_back(0);
+        update_points_ptr();
+        ++nb_alive_points_;
+        add_to_buffer(result);
+        return result;
+    }
+
+    void DynamicKdTree::remove_point(index_t i) {
+        geo_assert(!point_is_removed(i));
+        detach_point(i);
+        location_[i] = REMOVED;
+        --nb_alive_points_;
+    }
+
+    void DynamicKdTree::move_point(index_t i, const double* p) {
+        geo_assert(!point_is_removed(i));
+        double* q = coords_.data() + size_t(i) * dimension();
+        for(coord_index_t c=0; c<dimension(); ++c) {
+            q[c] = p[c];
+        }
+        // Points in the buffer are searched exhaustively, they just
+        // need their coordinates updated.
+        if(location_[i] == BUFFER) {
+            return;
+        }
+        detach_point(i);
+        add_to_buffer(i);
+    }
+
+    void DynamicKdTree::move_points(
+        index_t nb, const index_t* points, const double* new_coords
+    ) {
+        if(nb * REBUILD_RATIO <= nb_alive_points_) {
+            for(index_t k=0; k<nb; ++k) {
+                move_point(points[k], new_coords + size_t(k) * dimension());
+            }
+            return;
+        }
+        for(index_t k=0; k<nb; ++k) {
+            index_t i = points[k];
+            geo_assert(!point_is_removed(i));
+            double* q = coords_.data() + size_t(i) * dimension();
+            for(coord_index_t c=0; c<dimension(); ++c) {
+                q[c] = new_coords[size_t(k) * dimension() + c];
+            }
+        }
+        rebuild();
+    }
+
+    void DynamicKdTree::rebuild() {
+        vector<index_t> ids;
+        ids.reserve(nb_alive_points_);
+        for(index_t i=0; i<nb_points(); ++i) {
+            if(!point_is_removed(i)) {
+                ids.push_back(i);
+            }
+        }
+        buffer_.clear();
+        levels_.clear();
+        level_nb_alive_.clear();
+        // All the points go to the smallest level that can hold them.
+        index_t j = 0;
+        while(Numeric::uint64(BUFFER_SIZE) << j < ids.size()) {
+            ++j;
+        }
+        create_level(j, ids);
+    }
+
+    void DynamicKdTree::get_nearest_neighbors(
+        index_t nb_neighbors,
+        const double* query_point,
+        index_t* neighbors,
+        double* neighbors_sq_dist
+    ) const {
+        geo_debug_assert(nb_neighbors <= nb_points());
+        KdTree::NearestNeighbors NN(
+            nb_neighbors,
+	    neighbors,
+	    neighbors_sq_dist,
+	    (index_t*)alloca(sizeof(index_t) * (nb_neighbors+1)),
+	    (double*)alloca(sizeof(double) * (nb_neighbors+1))
+        );
+        find_nearest_neighbors(query_point, NN);
+	NN.copy_to_user();
+    }
+
+    void DynamicKdTree::get_nearest_neighbors(
+        index_t nb_neighbors,
+        const double* query_point,
+        index_t* neighbors,
+        double* neighbors_sq_dist,
+	KeepInitialValues
+    ) const {
+        geo_debug_assert(nb_neighbors <= nb_points());
+        KdTree::NearestNeighbors NN(
+            nb_neighbors,
+	    neighbors,
+	    neighbors_sq_dist,
+	    (index_t*)alloca(sizeof(index_t) * (nb_neighbors+1)),
+	    (double*)alloca(sizeof(double) * (nb_neighbors+1))
+        );
+	NN.copy_from_user();
+        find_nearest_neighbors(query_point, NN);
+	NN.copy_to_user();
+    }
+
+    void DynamicKdTree::get_neighbors_in_ball(
+        const double* query_point,
+        double sq_radius,
+        vector<index_t>& neighbors,
+        vector<double>& neighbors_sq_dist
+    ) const {
+        neighbors.resize(0);
+        neighbors_sq_dist.resize(0);
+        for(index_t j=0; j<levels_.size(); ++j) {
+            if(!levels_[j].is_null()) {
+                levels_[j]->find_neighbors_in_ball(
+                    query_point, sq_radius, neighbors, neighbors_sq_dist
+                );
+            }
+        }
+        for(index_t i: buffer_) {
+            double sq_dist = Geom::distance2(
+                query_point, point_ptr(i), dimension()
+            );
+            if(sq_dist <= sq_radius) {
+                neighbors.push_back(i);
+                neighbors_sq_dist.push_back(sq_dist);
+            }
+        }
+    }
+
+    void DynamicKdTree::find_nearest_neighbors(
+        const double* query_point, KdTree::NearestNeighbors& NN
+    ) const {
+        // Largest levels first: they are the most likely to contain
+        // the nearest neighbors, that prune the other traversals.
+        for(index_t j=levels_.size(); j>0; --j) {
+            if(!levels_[j-1].is_null()) {
+                levels_[j-1]->find_nearest_neighbors(query_point, NN);
+            }
+        }
+	double R = NN.furthest_neighbor_sq_dist();
+        for(index_t i: buffer_) {
+            double sq_dist = Geom::distance2(
+                query_point, point_ptr(i), dimension()
+            );
+            if(sq_dist <= R) {
+                NN.insert(i, sq_dist);
+		R = NN.furthest_neighbor_sq_dist();
+            }
+        }
+    }
+
+    void DynamicKdTree::create_level(index_t j, const vector<index_t>& ids) {
+        if(j >= levels_.size()) {
+            levels_.resize(j+1);
+            level_nb_alive_.resize(j+1, 0);
+        }
+        if(ids.size() == 0) {
+            levels_[j].reset();
+            level_nb_alive_[j] = 0;
+            return;
+        }
+        levels_[j] = new Level(this, ids);
+        level_nb_alive_[j] = ids.size();
+        const vector<index_t>& level_ids = levels_[j]->ids();
+        for(index_t k=0; k<level_ids.size(); ++k) {
+            location_[level_ids[k]] = j;
+            position_[level_ids[k]] = k;
+        }
+    }
+
+    void DynamicKdTree::flush_buffer() {
+        vector<index_t> ids;
+        ids.swap(buffer_);
+        index_t j = 0;
+        while(j < levels_.size() && !levels_[j].is_null()) {
+            for(index_t i: levels_[j]->ids()) {
+                if(location_[i] == j) {
+                    ids.push_back(i);
+                }
+            }
+            levels_[j].reset();
+            level_nb_alive_[j] = 0;
+            ++j;
+        }
+        create_level(j, ids);
+    }
+
+    void DynamicKdTree::add_to_buffer(index_t i) {
+        location_[i] = BUFFER;
+        buffer_.push_back(i);
+        if(buffer_.size() == BUFFER_SIZE) {
+            flush_buffer();
+        }
+    }
+
+    void DynamicKdTree::detach_point(index_t i) {
+        index_t j = location_[i];
+        location_[i] = REMOVED;
+        if(j == BUFFER) {
+            buffer_.erase(std::find(buffer_.begin(), buffer_.end(), i));
+            return;
+        }
+        levels_[j]->detach(position_[i]);
+        --level_nb_alive_[j];
+        // Lazy rebalancing: the level is rebuilt with its remaining
+        // points when more than half of them were detached.
+        if(2 * level_nb_alive_[j] < levels_[j]->ids().size()) {
+            vector<index_t> ids;
+            ids.reserve(level_nb_alive_[j]);
+            for(index_t k: levels_[j]->ids()) {
+                if(location_[k] == j) {
+                    ids.push_back(k);
+                }
+            }
+            create_level(j, ids);
+        }
+    }
+}
@@ -0,0 +1,378 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#ifndef GEOGRAM_POINTS_DYNAMIC_KD_TREE
+#define GEOGRAM_POINTS_DYNAMIC_KD_TREE
+
+#include <geogram/basic/common.h>
+#include <geogram/points/kd_tree.h>
+
+/**
+ * \file geogram/points/dynamic_kd_tree.h
+ * \brief An implementation of NearestNeighborSearch that supports
+ *  insertion, removal and motion of points
+ */
+
+namespace GEO {
+
+    /**
+     * \brief Implements NearestNeighborSearch for a point set that
+     *  changes over time.
+     * \details The points are stored in a logarithmic forest of static
+     *  BalancedKdTree levels, where level j has at most 
+     *  BUFFER_SIZE * 2^j points, plus a small buffer of recently
+     *  inserted or moved points searched exhaustively. When the buffer
+     *  is full, it is merged with the levels 0 .. j-1 into the first
+     *  empty level j. Removed points are only marked in their level, 
+     *  which is rebuilt when more than half of its points are removed.
+     *  Points are identified by the index returned by insert_point(),
+     *  that does not change when other points are inserted, removed
+     *  or moved. The coordinates are copied, and point_ptr() refers
+     *  to the copy.
+     */
+    class GEOGRAM_API DynamicKdTree : public NearestNeighborSearch {
+    public:
+        /**
+         * \brief Creates a new empty DynamicKdTree.
+         * \param[in] dim dimension of the points
+         */
+        DynamicKdTree(coord_index_t dim);
+
+        /**
+         * \copydoc NearestNeighborSearch::set_points()
+         * \details Replaces all the points, that are copied. The indices 
+         *  of the points are 0 ... nb_points-1.
+         */
+        virtual void set_points(index_t nb_points, const double* points);
+
+	/** \copydoc NearestNeighborSearch::stride_supported() */
+        virtual bool stride_supported() const;
+
+        /** \copydoc DynamicKdTree::set_points(index_t,const double*) */
+        virtual void set_points(
+            index_t nb_points, const double* points, index_t stride
+        );
+
+        /**
+         * \brief Inserts a point.
+         * \param[in] p a pointer to the dimension() coordinates of the point,
+         *  that are copied
+         * \return the index of the new point. It is equal to nb_points()
+         *  before the insertion (indices of removed points are not reused).
+         */
+        index_t insert_point(const double* p);
+
+        /**
+         * \brief Removes a point.
+         * \details Removed points are no longer returned by the queries.
+         *  Their index stays valid for point_ptr().
+         * \param[in] i the index of the point
+         * \pre !point_is_removed(i)
+         */
+        void remove_point(index_t i);
+
+        /**
+         * \brief Moves a point.
+         * \param[in] i the index of the point
+         * \param[in] p a pointer to the dimension() new coordinates 
+         *  of the point, that are copied
+         * \pre !point_is_removed(i)
+         */
+        void move_point(index_t i, const double* p);
+
+        /**
+         * \brief Moves a set of points.
+         * \details When many points move, rebuilding the whole forest
+         *  at once is faster than moving them one by one.
+         * \param[in] nb number of points to be moved
+         * \param[in] points the indices of the nb points
+         * \param[in] new_coords a pointer to the nb * dimension() new 
+         *  coordinates, that are copied
+         * \pre none of the points is removed
+         */
+        void move_points(
+            index_t nb, const index_t* points, const double* new_coords
+        );
+
+        /**
+         * \brief Rebuilds the forest as a single level with all the
+         *  points that are not removed.
+         */
+        void rebuild();
+
+        /**
+         * \brief Tests whether a point was removed.
+         * \param[in] i the index of the point
+         * \retval true if point \p i was removed
+         * \retval false otherwise
+         */
+        bool point_is_removed(index_t i) const {
+            geo_debug_assert(i < nb_points());
+            return location_[i] == REMOVED;
+        }
+
+        /**
+         * \brief Gets the number of points that were not removed.
+         * \details Nearest neighbors queries for more neighbors than
+         *  that leave the last entries set to index_t(-1).
+         * \return the number of points that were not removed
+         */
+        index_t nb_alive_points() const {
+            return nb_alive_points_;
+        }
+
+	/** \copydoc NearestNeighborSearch::get_nearest_neighbors() */
+        virtual void get_nearest_neighbors(
+            index_t nb_neighbors,
+            const double* query_point,
+            index_t* neighbors,
+            double* neighbors_sq_dist
+        ) const;
+
+	/** \copydoc NearestNeighborSearch::get_nearest_neighbors() */
+        virtual void get_nearest_neighbors(
+            index_t nb_neighbors,
+            const double* query_point,
+            index_t* neighbors,
+            double* neighbors_sq_dist,
+	    KeepInitialValues
+        ) const;
+
+	/** \copydoc NearestNeighborSearch::get_neighbors_in_ball() */
+        virtual void get_neighbors_in_ball(
+            const double* query_point,
+            double sq_radius,
+            vector<index_t>& neighbors,
+            vector<double>& neighbors_sq_dist
+        ) const;
+
+    protected:
+        /**
+         * \brief DynamicKdTree destructor.
+         */
+        virtual ~DynamicKdTree();
+
+        /**
+         * \brief A level of the forest.
+         * \details A BalancedKdTree on a copy of the coordinates of
+         *  a subset of the points, that skips the points detached from
+         *  this level (removed or moved).
+         */
+        class Level : public BalancedKdTree {
+        public:
+            /**
+             * \brief Creates a new Level.
+             * \param[in] tree the DynamicKdTree this level belongs to
+             * \param[in] ids the indices of the points in \p tree
+             */
+            Level(const DynamicKdTree* tree, const vector<index_t>& ids);
+
+            /**
+             * \brief Gets the indices of the points of this level.
+             * \return a const reference to the indices of the points in
+             *  the DynamicKdTree, detached points included, in the order
+             *  of the leaves.
+             */
+            const vector<index_t>& ids() const {
+                return leaf_ids_;
+            }
+
+            /**
+             * \brief Detaches a point from this level.
+             * \param[in] i the position of the point in ids()
+             */
+            void detach(index_t i) {
+                leaf_alive_[i] = 0;
+            }
+
+            /**
+             * \brief Finds the nearest neighbors of a point in this level.
+             * \param[in] query_point the query point
+             * \param[in,out] NN the nearest neighbors found so far, 
+             *  with the indices of the points in the DynamicKdTree
+             */
+            void find_nearest_neighbors(
+                const double* query_point, NearestNeighbors& NN
+            ) const;
+
+            /**
+             * \brief Finds the points of this level in a ball.
+             * \param[in] query_point the center of the ball
+             * \param[in] sq_radius the squared radius of the ball
+             * \param[in,out] neighbors , neighbors_sq_dist the indices,
+             *  in the DynamicKdTree, and squared distances of the points
+             *  in the ball are appended to these vectors
+             */
+            void find_neighbors_in_ball(
+                const double* query_point, double sq_radius,
+                vector<index_t>& neighbors,
+                vector<double>& neighbors_sq_dist
+            ) const;
+
+        protected:
+	    /** \copydoc KdTree::get_nearest_neighbors_leaf() */
+            virtual void get_nearest_neighbors_leaf(
+                index_t node_index, index_t b, index_t e,
+                const double* query_point,
+                NearestNeighbors& neighbors	    
+            ) const;
+
+	    /** \copydoc KdTree::get_neighbors_in_ball_leaf() */
+            virtual void get_neighbors_in_ball_leaf(
+                index_t node_index, index_t b, index_t e,
+                const double* query_point,
+                double sq_radius,
+                vector<index_t>& neighbors,
+                vector<double>& neighbors_sq_dist
+            ) const;
+
+        private:
+            vector<double> coords_;
+
+            /**
+             * \brief The indices of the points in the DynamicKdTree,
+             *  in the order of point_index_.
+             */
+            vector<index_t> leaf_ids_;
+
+            /**
+             * \brief 1 for the points that are not detached, 0 otherwise,
+             *  in the order of point_index_.
+             */
+            vector<Numeric::uint8> leaf_alive_;
+        };
+
+        /**
+         * \brief Maximum number of points in the buffer.
+         */
+        static const index_t BUFFER_SIZE = 64;
+
+        /**
+         * \brief move_points() rebuilds the forest when it moves more than
+         *  nb_alive_points() / REBUILD_RATIO points.
+         */
+        static const index_t REBUILD_RATIO = 16;
+
+        /**
+         * \brief Value of location_ for the points in the buffer.
+         */
+        static const index_t BUFFER = index_t(-2);
+
+        /**
+         * \brief Value of location_ for the removed points.
+         */
+        static const index_t REMOVED = index_t(-1);
+
+        /**
+         * \brief Finds the nearest neighbors of a point in all the levels
+         *  and in the buffer.
+         * \param[in] query_point the query point
+         * \param[in,out] NN the nearest neighbors
+         */
+        void find_nearest_neighbors(
+            const double* query_point, KdTree::NearestNeighbors& NN
+        ) const;
+
+        /**
+         * \brief Creates a level.
+         * \param[in] j the index of the level
+         * \param[in] ids the indices of the points of the level
+         */
+        void create_level(index_t j, const vector<index_t>& ids);
+
+        /**
+         * \brief Inserts the points of the buffer into the forest.
+         * \details The buffer and the levels 0 .. j-1 are merged into
+         *  the first empty level j.
+         */
+        void flush_buffer();
+
+        /**
+         * \brief Appends a point to the buffer, and flushes the buffer
+         *  if it is full.
+         * \param[in] i the index of the point
+         */
+        void add_to_buffer(index_t i);
+
+        /**
+         * \brief Detaches a point from the level or the buffer
+         *  it belongs to.
+         * \details Rebuilds the level if more than half of its points are
+         *  detached.
+         * \param[in] i the index of the point
+         */
+        void detach_point(index_t i);
+
+        /**
+         * \brief Updates points_, nb_points_ and stride_ after
+         *  coords_ changed.
+         */
+        void update_points_ptr() {
+            nb_points_ = location_.size();
+            points_ = coords_.data();
+            stride_ = dimension();
+        }
+
+    private:
+        vector<double> coords_;
+
+        /** 
+         * \brief For each point, the index of its level, 
+         *  BUFFER or REMOVED.
+         */
+        vector<index_t> location_;
+
+        /** \brief For each point in a level, its position in ids(). */
+        vector<index_t> position_;
+        vector<index_t> buffer_;
+        vector<SmartPointer<Level> > levels_;
+
+        /** \brief For each level, number of points that belong to it. */
+        vector<index_t> level_nb_alive_;
+        index_t nb_alive_points_;
+    };
+}
+
+#endif
@@ -103,6 +103,77 @@ namespace {
         index_t stride_;
         coord_index_t splitting_coord_;
     };
+
+    /**
+     * \brief Computes the squared distances between a query point
+     *  and the points of a leaf.
+     * \details Coordinates are stored coordinate by coordinate, so that
+     *  the inner loop is vectorized by the compiler.
+     * \tparam T the type of the coordinates, float or double
+     * \param[in] coords the first coordinate of the first point
+     *  of the leaf
+     * \param[in] coords_stride number of Ts between two
+     *  consecutive coordinates of a point
+     * \param[in] dim the dimension of the points
+     * \param[in] query_point the query point
+     * \param[in] nb the number of points in the leaf
+     * \param[out] sq_dist the nb squared distances
+     */
+    template <class T> inline void compute_leaf_sq_dist(
+        const T* geo_restrict coords, index_t coords_stride,
+        coord_index_t dim, const double* query_point,
+        index_t nb, T* geo_restrict sq_dist
+    ) {
+        for(index_t ii=0; ii<nb; ++ii) {
+            sq_dist[ii] = T(0);
+        }
+        for(coord_index_t c=0; c<dim; ++c) {
+            const T* geo_restrict X = coords + size_t(c)*coords_stride;
+            T q = T(query_point[c]);
+            for(index_t ii=0; ii<nb; ++ii) {
+                T d = X[ii] - q;
+                sq_dist[ii] += d*d;
+            }
+        }
+    }
+
+    /**
+     * \brief Replaces the squared distances of the neighbors with
+     *  their exact values and sorts the neighbors accordingly.
+     * \details Used to re-rank the neighbors found with single
+     *  precision leaves.
+     * \param[in] NN the NearestNeighborSearch
+     * \param[in] nb_neighbors the number of neighbors
+     * \param[in] query_point the query point
+     * \param[in,out] neighbors the neighbors. Entries set to index_t(-1)
+     *  are left as is.
+     * \param[in,out] neighbors_sq_dist the squared distances
+     */
+    void rerank_neighbors(
+        const NearestNeighborSearch& NN,
+        index_t nb_neighbors, const double* query_point,
+        index_t* neighbors, double* neighbors_sq_dist
+    ) {
+        for(index_t i=0; i<nb_neighbors; ++i) {
+            if(neighbors[i] != index_t(-1)) {
+                neighbors_sq_dist[i] = Geom::distance2(
+                    query_point, NN.point_ptr(neighbors[i]), NN.dimension()
+                );
+            }
+        }
+        for(index_t i=1; i<nb_neighbors; ++i) {
+            index_t j = neighbors[i];
+            double d = neighbors_sq_dist[i];
+            index_t k = i;
+            while(k > 0 && neighbors_sq_dist[k-1] > d) {
+                neighbors[k] = neighbors[k-1];
+                neighbors_sq_dist[k] = neighbors_sq_dist[k-1];
+                --k;
+            }
+            neighbors[k] = j;
+            neighbors_sq_dist[k] = d;
+        }
+    }
 }
 
 /****************************************************************************/
@@ -113,7 +184,8 @@ namespace GEO {
         NearestNeighborSearch(dim),
         bbox_min_(dim),
         bbox_max_(dim),
-        root_(index_t(-1)) {
+        root_(index_t(-1)),
+        float_leaves_(false) {
     }
 
     KdTree::~KdTree() {
@@ -149,6 +221,47 @@ namespace GEO {
         }
 	
 	root_ = build_tree();
+	init_leaf_coords();
+    }
+
+    void KdTree::set_float_leaves(bool x) {
+        if(x == float_leaves_) {
+            return;
+        }
+        float_leaves_ = x;
+        init_leaf_coords();
+    }
+
+    void KdTree::init_leaf_coords() {
+        index_t nb = nb_points();
+        coord_index_t dim = dimension();
+        if(!float_leaves_) {
+            leaf_coords_float_.clear();
+            leaf_coords_float_.shrink_to_fit();
+            leaf_coords_.resize(size_t(nb)*dim);
+        } else {
+            leaf_coords_.clear();
+            leaf_coords_.shrink_to_fit();
+            leaf_coords_float_.resize(size_t(nb)*dim);
+        }
+        double* coords = leaf_coords_.data();
+        float* coords_float = leaf_coords_float_.data();
+        parallel_for_slice(
+            0, nb,
+            [&](index_t b, index_t e) {
+                for(index_t i=b; i<e; ++i) {
+                    const double* p = point_ptr(point_index_[i]);
+                    for(coord_index_t c=0; c<dim; ++c) {
+                        size_t offset = size_t(c)*nb + i;
+                        if(coords != nullptr) {
+                            coords[offset] = p[c];
+                        } else {
+                            coords_float[offset] = float(p[c]);
+                        }
+                    }
+                }
+            }
+        );
     }
 
     void KdTree::set_points(
@@ -191,6 +304,11 @@ namespace GEO {
             root_, 0, nb_points(), bbox_min, bbox_max, box_dist, query_point, NN
         );
 	NN.copy_to_user();
+	if(float_leaves_) {
+	    rerank_neighbors(
+		*this, nb_neighbors, query_point, neighbors, neighbors_sq_dist
+	    );
+	}
     }
 
     void KdTree::get_nearest_neighbors(
@@ -223,10 +341,15 @@ namespace GEO {
 	    (double*)alloca(sizeof(double) * (nb_neighbors+1))
         );
 	NN.copy_from_user();
-        get_nearest_neighbors_recursive( 
+        get_nearest_neighbors_recursive(
             root_, 0, nb_points(), bbox_min, bbox_max, box_dist, query_point, NN
         );
 	NN.copy_to_user();
+	if(float_leaves_) {
+	    rerank_neighbors(
+		*this, nb_neighbors, query_point, neighbors, neighbors_sq_dist
+	    );
+	}
     }
 
     void KdTree::get_nearest_neighbors(
@@ -246,6 +369,141 @@ namespace GEO {
         );
     }
 
+    void KdTree::get_neighbors_in_ball(
+        const double* query_point,
+        double sq_radius,
+        vector<index_t>& neighbors,
+        vector<double>& neighbors_sq_dist
+    ) const {
+        neighbors.resize(0);
+        neighbors_sq_dist.resize(0);
+        if(nb_points() == 0) {
+            return;
+        }
+        double box_dist = 0.0;
+        double* bbox_min = (double*) (alloca(dimension() * sizeof(double)));
+        double* bbox_max = (double*) (alloca(dimension() * sizeof(double)));
+	init_bbox_and_bbox_dist_for_traversal(
+	    bbox_min, bbox_max, box_dist, query_point
+	);
+        if(box_dist > sq_radius) {
+            return;
+        }
+        get_neighbors_in_ball_recursive(
+            root_, 0, nb_points(), bbox_min, bbox_max, box_dist,
+            query_point, sq_radius, neighbors, neighbors_sq_dist
+        );
+    }
+
+    void KdTree::get_neighbors_in_ball_recursive(
+        index_t node_index, index_t b, index_t e,
+        double* bbox_min, double* bbox_max, double box_dist,
+        const double* query_point, double sq_radius,
+        vector<index_t>& neighbors, vector<double>& neighbors_sq_dist
+    ) const {
+        geo_debug_assert(e > b);
+
+        if((e - b) <= MAX_LEAF_SIZE) {
+	    get_neighbors_in_ball_leaf(
+                node_index, b, e, query_point, sq_radius,
+                neighbors, neighbors_sq_dist
+            );
+            return;
+        }
+
+	index_t left_node_index;
+	index_t right_node_index;
+	coord_index_t coord;
+	index_t m;	
+	double val;
+	
+	get_node(
+	    node_index, b, e,
+	    left_node_index, right_node_index,
+	    coord, m, val
+	);
+
+        // Same bbox distance update as in get_nearest_neighbors_recursive(),
+        // except that the far subtree is pruned by the radius of the ball.
+        double cut_diff = query_point[coord] - val;
+        if(cut_diff < 0.0) {
+            {
+                double bbox_max_save = bbox_max[coord];
+                bbox_max[coord] = val;
+                get_neighbors_in_ball_recursive(
+                    left_node_index, b, m, bbox_min, bbox_max, box_dist,
+                    query_point, sq_radius, neighbors, neighbors_sq_dist
+                );
+                bbox_max[coord] = bbox_max_save;
+            }
+            double box_diff = bbox_min[coord] - query_point[coord];
+            if(box_diff > 0.0) {
+                box_dist -= geo_sqr(box_diff);
+            }
+            box_dist += geo_sqr(cut_diff);
+            if(box_dist <= sq_radius) {
+                double bbox_min_save = bbox_min[coord];
+                bbox_min[coord] = val;
+                get_neighbors_in_ball_recursive(
+                    right_node_index, m, e, bbox_min, bbox_max, box_dist,
+                    query_point, sq_radius, neighbors, neighbors_sq_dist
+                );
+                bbox_min[coord] = bbox_min_save;
+            }
+        } else {
+            {
+                double bbox_min_save = bbox_min[coord];
+                bbox_min[coord] = val;
+                get_neighbors_in_ball_recursive(
+                    right_node_index, m, e, bbox_min, bbox_max, box_dist,
+                    query_point, sq_radius, neighbors, neighbors_sq_dist
+                );
+                bbox_min[coord] = bbox_min_save;
+            }
+            double box_diff = query_point[coord] - bbox_max[coord];
+            if(box_diff > 0.0) {
+                box_dist -= geo_sqr(box_diff);
+            }
+            box_dist += geo_sqr(cut_diff);
+            if(box_dist <= sq_radius) {
+                double bbox_max_save = bbox_max[coord];
+                bbox_max[coord] = val;
+                get_neighbors_in_ball_recursive(
+                    left_node_index, b, m, bbox_min, bbox_max, box_dist,
+                    query_point, sq_radius, neighbors, neighbors_sq_dist
+                );
+                bbox_max[coord] = bbox_max_save;
+            }
+        }
+    }
+
+    void KdTree::get_neighbors_in_ball_leaf(
+	index_t node_index, index_t b, index_t e,
+	const double* query_point, double sq_radius,
+        vector<index_t>& neighbors, vector<double>& neighbors_sq_dist
+    ) const {
+	geo_argused(node_index);
+	index_t nb = e-b;
+	double local_sq_dist[MAX_LEAF_SIZE];
+	if(!float_leaves_) {
+	    get_leaf_sq_dist(b, e, query_point, local_sq_dist);
+	} else {
+	    // Single precision distances are not used here, so that
+	    // ball queries remain exact.
+	    for(index_t ii=0; ii<nb; ++ii) {
+		local_sq_dist[ii] = Geom::distance2(
+		    query_point, point_ptr(point_index_[b+ii]), dimension()
+		);
+	    }
+	}
+	for(index_t ii=0; ii<nb; ++ii) {
+            if(local_sq_dist[ii] <= sq_radius) {
+                neighbors.push_back(point_index_[b+ii]);
+                neighbors_sq_dist.push_back(local_sq_dist[ii]);
+            }
+	}
+    }
+
     void KdTree::get_nearest_neighbors_recursive(
         index_t node_index, index_t b, index_t e,
         double* bbox_min, double* bbox_max, double box_dist,
@@ -352,45 +610,47 @@ namespace GEO {
     ) const {
 	geo_argused(node_index);
         NN.nb_visited += (e-b);
-	double R = NN.furthest_neighbor_sq_dist();
 	index_t nb = e-b;
 	const index_t* geo_restrict idx = &point_index_[b];
-
-	// TODO: check generated ASM (I'd like to have AVX here).
-	// We may need to dispatch according to dimension.
-	
-	index_t local_idx[MAX_LEAF_SIZE];
-	double  local_sq_dist[MAX_LEAF_SIZE];
-
-	// Cache indices and computed distances in local
-	// array. I guess AVX likes that (to be checked).
-	// Not sure, because access to p is indirect, maybe
-	// I should copy the points to local memory before
-	// computing the distances (or having another copy
-	// of the points array that I pre-reorder so that
-	// leaf's points are in a contiguous chunk of memory),
-	// to be tested...
-	for(index_t ii=0; ii<nb; ++ii) {
-	    index_t i = idx[ii];
-	    const double* geo_restrict p = point_ptr(i);
-	    double sq_dist = Geom::distance2(
-		query_point, p, dimension()
-	    );
-	    local_idx[ii] = i;
-	    local_sq_dist[ii] = sq_dist;
-	}
+	double local_sq_dist[MAX_LEAF_SIZE];
+	get_leaf_sq_dist(b, e, query_point, local_sq_dist);
 
 	// Now insert the points that are nearer to query
 	// point than NN's bounding ball.
+	double R = NN.furthest_neighbor_sq_dist();
 	for(index_t ii=0; ii<nb; ++ii) {
 	    double sq_dist = local_sq_dist[ii];
 	    if(sq_dist <= R) {
-		NN.insert(local_idx[ii],sq_dist);
+		NN.insert(idx[ii],sq_dist);
 		R = NN.furthest_neighbor_sq_dist();
 	    }
 	}
     }
 
+    void KdTree::get_leaf_sq_dist(
+	index_t b, index_t e, const double* query_point, double* sq_dist
+    ) const {
+	// The coordinates of the points of the leaf are contiguous in
+	// leaf_coords_ (or leaf_coords_float_ if float_leaves_ is set).
+	index_t nb = e-b;
+	geo_debug_assert(nb <= MAX_LEAF_SIZE);
+	if(!float_leaves_) {
+	    compute_leaf_sq_dist(
+		leaf_coords_.data() + b, nb_points(), dimension(),
+		query_point, nb, sq_dist
+	    );
+	} else {
+	    float sq_dist_float[MAX_LEAF_SIZE];
+	    compute_leaf_sq_dist(
+		leaf_coords_float_.data() + b, nb_points(), dimension(),
+		query_point, nb, sq_dist_float
+	    );
+	    for(index_t ii=0; ii<nb; ++ii) {
+		sq_dist[ii] = double(sq_dist_float[ii]);
+	    }
+	}
+    }
+
     void KdTree::init_bbox_and_bbox_dist_for_traversal(
 	double* bbox_min, double* bbox_max,
 	double& box_dist, const double* query_point
@@ -103,6 +103,37 @@ namespace GEO {
             index_t* neighbors,
             double* neighbors_sq_dist
         ) const;
+
+	/**
+	 * \brief Computes the distances to the points in the leaves
+	 *  in single precision.
+	 * \details This approximation is opt-in and independent of
+	 *  set_exact(). The copy of the leaf coordinates is stored in
+	 *  single precision (this halves its memory), then the neighbors
+	 *  found are re-ranked with their exact distances. Some neighbors
+	 *  can be missed when distances are nearly equal. Ball queries
+	 *  remain exact.
+	 * \param[in] x true to use single precision leaves, false to use
+	 *  double precision leaves (default)
+	 */
+        void set_float_leaves(bool x);
+
+	/**
+	 * \brief Tests whether the distances to the points in the leaves
+	 *  are computed in single precision.
+	 * \see set_float_leaves()
+	 */
+	bool float_leaves() const {
+	    return float_leaves_;
+	}
+
+	/** \copydoc NearestNeighborSearch::get_neighbors_in_ball() */
+        virtual void get_neighbors_in_ball(
+            const double* query_point,
+            double sq_radius,
+            vector<index_t>& neighbors,
+            vector<double>& neighbors_sq_dist
+        ) const;
 	
 	/**********************************************************************/
 	
@@ -393,6 +424,79 @@ namespace GEO {
             NearestNeighbors& neighbors	    
 	) const;
 
+        /**
+         * \brief The recursive function to implement KdTree traversal
+         *  and ball queries.
+         * \details Traverses the subtree under the node_index node that
+         *  corresponds to the [b,e) point sequence, and appends the points
+         *  in the ball to neighbors.
+         * \param[in] node_index index of the current node in the Kd tree
+         * \param[in] b index of the first point in the subtree under
+         *  node \p node_index
+         * \param[in] e one position past the index of the last point in the
+         *  subtree under node \p node_index
+         * \param[in,out] bbox_min , bbox_max coordinates of the
+         *  bounding box, as in get_nearest_neighbors_recursive()
+         * \param[in] bbox_dist squared distance between
+         *  the query point and the bounding box of the
+         *  [b,e) point sequence
+         * \param[in] query_point the center of the ball
+         * \param[in] sq_radius the squared radius of the ball
+         * \param[in,out] neighbors , neighbors_sq_dist the points found
+         *  in the ball and their squared distances to \p query_point
+         */
+        void get_neighbors_in_ball_recursive(
+            index_t node_index, index_t b, index_t e,
+            double* bbox_min, double* bbox_max,
+            double bbox_dist, const double* query_point,
+            double sq_radius,
+            vector<index_t>& neighbors,
+            vector<double>& neighbors_sq_dist
+        ) const;
+
+        /**
+         * \brief Finds the points of a leaf that are in a ball.
+         * \param[in] node_index index of the leaf to be traversed.
+         * \param[in] b index of the first point in the leaf.
+         * \param[in] e one position past the index of the last point in the
+	 *  leaf.
+         * \param[in] query_point the center of the ball
+         * \param[in] sq_radius the squared radius of the ball
+         * \param[in,out] neighbors , neighbors_sq_dist the points found
+         *  in the ball and their squared distances to \p query_point
+         */
+	virtual void get_neighbors_in_ball_leaf(
+            index_t node_index, index_t b, index_t e,
+	    const double* query_point,
+            double sq_radius,
+            vector<index_t>& neighbors,
+            vector<double>& neighbors_sq_dist
+	) const;
+
+	/**
+	 * \brief Computes the squared distances between a query point
+	 *  and the points of a leaf.
+	 * \details Uses leaf_coords_, or leaf_coords_float_ if
+	 *  float_leaves() is set.
+	 * \param[in] b index of the first point in the leaf
+	 * \param[in] e one position past the index of the last point in
+	 *  the leaf
+	 * \param[in] query_point the query point
+	 * \param[out] sq_dist the e-b squared distances
+	 */
+	void get_leaf_sq_dist(
+	    index_t b, index_t e, const double* query_point, double* sq_dist
+	) const;
+
+	/**
+	 * \brief Copies the coordinates of the points in the order of
+	 *  the leaves of the tree.
+	 * \details Called after the tree is built and each time
+	 *  set_float_leaves() changes the mode. Fills leaf_coords_, or
+	 *  leaf_coords_float_ if float_leaves() is set.
+	 */
+	void init_leaf_coords();
+
 	/**
 	 * \brief Computes the minimum and maximum point coordinates 
 	 *   along a coordinate.
@@ -438,6 +542,24 @@ namespace GEO {
         vector<double> bbox_min_;
         vector<double> bbox_max_;
 	index_t root_;
+
+	/**
+	 * \brief The coordinates of the points, in the order of
+	 *  point_index_, stored coordinate by coordinate.
+	 * \details Coordinate c of the point point_index_[i] is
+	 *  leaf_coords_[c*nb_points()+i], thus the coordinates of
+	 *  the points of a leaf are contiguous. Empty if float_leaves()
+	 *  is set.
+	 */
+	vector<double> leaf_coords_;
+
+	/**
+	 * \brief Same as leaf_coords_ in single precision, used if
+	 *  float_leaves() is set. Empty otherwise.
+	 */
+	vector<float> leaf_coords_float_;
+
+	bool float_leaves_;
     };
 
     /*********************************************************************/
@@ -45,8 +45,89 @@
 
 #include <geogram/points/nn_search.h>
 #include <geogram/points/kd_tree.h>
+#include <geogram/mesh/mesh_reorder.h>
 #include <geogram/basic/command_line.h>
 #include <geogram/basic/logger.h>
+#include <geogram/basic/geometry_nd.h>
+#include <geogram/basic/process.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Batches of queries smaller than this are not
+     *  sorted spatially.
+     */
+    const index_t MIN_SORTED_QUERIES = 1024;
+
+    /**
+     * \brief Queries for fewer neighbors than this are too cheap
+     *  for the spatial sort to pay off.
+     */
+    const index_t MIN_SORTED_NEIGHBORS = 2;
+
+    /**
+     * \brief Number of blocks of points per thread used by
+     *  NearestNeighborSearch::get_radius_graph().
+     * \details Several blocks per thread balance the load
+     *  when the density of points varies.
+     */
+    const index_t RADIUS_GRAPH_BLOCKS_PER_THREAD = 8;
+
+    /**
+     * \brief Finds the nearest neighbors of a point, using the
+     *  nearest neighbors of a nearby point to initialize the search.
+     * \details The nearest neighbors of the nearby point give an
+     *  upper bound of the distance to the furthest neighbor, used
+     *  to prune the search from the start.
+     * \param[in] NN the NearestNeighborSearch
+     * \param[in] nb_neighbors number of neighbors to be searched
+     * \param[in] query_point the query point
+     * \param[out] neighbors array of nb_neighbors index_t
+     * \param[out] neighbors_sq_dist array of nb_neighbors doubles
+     * \param[in] guess nb_neighbors distinct point indices, or
+     *  nullptr if there is no initial guess
+     */
+    void get_nearest_neighbors_with_guess(
+        const NearestNeighborSearch& NN,
+        index_t nb_neighbors,
+        const double* query_point,
+        index_t* neighbors,
+        double* neighbors_sq_dist,
+        const index_t* guess
+    ) {
+        if(guess == nullptr || nb_neighbors == 0) {
+            NN.get_nearest_neighbors(
+                nb_neighbors, query_point, neighbors, neighbors_sq_dist
+            );
+            return;
+        }
+        double R = 0.0;
+        for(index_t i=0; i<nb_neighbors; ++i) {
+            R = std::max(
+                R, Geom::distance2(
+                    query_point, NN.point_ptr(guess[i]), NN.dimension()
+                )
+            );
+        }
+        // The nb_neighbors points of the guess are nearer than R, thus
+        // they replace all these placeholders during the search.
+        for(index_t i=0; i<nb_neighbors; ++i) {
+            neighbors[i] = index_t(-1);
+            neighbors_sq_dist[i] = R;
+        }
+        NN.get_nearest_neighbors(
+            nb_neighbors, query_point, neighbors, neighbors_sq_dist,
+            NearestNeighborSearch::KeepInitialValues()
+        );
+        if(neighbors[nb_neighbors-1] == index_t(-1)) {
+            NN.get_nearest_neighbors(
+                nb_neighbors, query_point, neighbors, neighbors_sq_dist
+            );
+        }
+    }
+}
 
 /****************************************************************************/
 
@@ -91,6 +172,189 @@ namespace GEO {
         );
     }
 
+    void NearestNeighborSearch::get_nearest_neighbors_batch(
+        index_t nb_neighbors,
+        index_t nb_queries,
+        const double* query_points,
+        index_t* neighbors,
+        double* neighbors_sq_dist,
+        index_t query_stride
+    ) const {
+        geo_assert(nb_neighbors <= nb_points());
+        if(query_stride == 0) {
+            query_stride = dimension();
+        }
+
+        vector<index_t> order(nb_queries);
+        for(index_t q=0; q<nb_queries; ++q) {
+            order[q] = q;
+        }
+        if(
+            (dimension() == 2 || dimension() == 3) &&
+            nb_queries >= MIN_SORTED_QUERIES &&
+            nb_neighbors >= MIN_SORTED_NEIGHBORS
+        ) {
+            compute_Hilbert_order(
+                nb_queries, query_points, order, 0, nb_queries,
+                dimension(), query_stride
+            );
+        }
+
+        parallel_for_slice(
+            0, nb_queries,
+            [&](index_t b, index_t e) {
+                vector<double> work_sq_dist(nb_neighbors);
+                const index_t* guess = nullptr;
+                for(index_t k=b; k<e; ++k) {
+                    index_t q = order[k];
+                    index_t* q_neighbors =
+                        neighbors + size_t(q)*nb_neighbors;
+                    double* q_sq_dist = (neighbors_sq_dist == nullptr) ?
+                        work_sq_dist.data() :
+                        neighbors_sq_dist + size_t(q)*nb_neighbors;
+                    get_nearest_neighbors_with_guess(
+                        *this, nb_neighbors,
+                        query_points + size_t(q)*query_stride,
+                        q_neighbors, q_sq_dist, guess
+                    );
+                    guess = q_neighbors;
+                }
+            }
+        );
+    }
+
+    void NearestNeighborSearch::get_nearest_neighbors_of_points(
+        index_t nb_neighbors,
+        index_t first, index_t last,
+        index_t* neighbors,
+        double* neighbors_sq_dist
+    ) const {
+        geo_assert(first <= last && last <= nb_points());
+        if(first == last) {
+            return;
+        }
+        get_nearest_neighbors_batch(
+            nb_neighbors, last - first, point_ptr(first),
+            neighbors, neighbors_sq_dist, stride_
+        );
+    }
+
+    void NearestNeighborSearch::get_neighbors_in_ball(
+        const double* query_point,
+        double sq_radius,
+        vector<index_t>& neighbors,
+        vector<double>& neighbors_sq_dist
+    ) const {
+        index_t nb = std::min(index_t(16), nb_points());
+        for(;;) {
+            neighbors.resize(nb);
+            neighbors_sq_dist.resize(nb);
+            get_nearest_neighbors(
+                nb, query_point, neighbors.data(), neighbors_sq_dist.data()
+            );
+            if(nb == nb_points() || neighbors_sq_dist[nb-1] > sq_radius) {
+                break;
+            }
+            nb = std::min(2*nb, nb_points());
+        }
+        // Neighbors are sorted, remove the ones outside the ball.
+        while(nb > 0 && neighbors_sq_dist[nb-1] > sq_radius) {
+            --nb;
+        }
+        neighbors.resize(nb);
+        neighbors_sq_dist.resize(nb);
+    }
+
+    void NearestNeighborSearch::get_radius_graph(
+        double radius,
+        vector<Numeric::uint64>& graph_ptr,
+        std::vector<index_t>& graph
+    ) const {
+        index_t nb = nb_points();
+        graph_ptr.assign(nb+1, 0);
+        graph.clear();
+        if(nb == 0) {
+            return;
+        }
+        double sq_radius = geo_sqr(radius);
+
+        // Points are processed in spatial order, for memory locality.
+        vector<index_t> order(nb);
+        for(index_t i=0; i<nb; ++i) {
+            order[i] = i;
+        }
+        if(
+            (dimension() == 2 || dimension() == 3) &&
+            nb >= MIN_SORTED_QUERIES
+        ) {
+            compute_Hilbert_order(
+                nb, points_, order, 0, nb, dimension(), stride_
+            );
+        }
+
+        // Each block of sorted points stores its part of the graph, then
+        // the parts are copied to their final location.
+        index_t nb_blocks = std::min(
+            nb,
+            Process::maximum_concurrent_threads() *
+            RADIUS_GRAPH_BLOCKS_PER_THREAD
+        );
+        auto block_begin = [nb, nb_blocks](index_t k) {
+            return index_t(Numeric::uint64(nb) * k / nb_blocks);
+        };
+        std::vector<std::vector<index_t> > block_graph(nb_blocks);
+
+        parallel_for(
+            0, nb_blocks,
+            [&](index_t k) {
+                vector<index_t> neighbors;
+                vector<double> neighbors_sq_dist;
+                std::vector<index_t>& G = block_graph[k];
+                for(index_t kk=block_begin(k); kk<block_begin(k+1); ++kk) {
+                    index_t i = order[kk];
+                    get_neighbors_in_ball(
+                        point_ptr(i), sq_radius,
+                        neighbors, neighbors_sq_dist
+                    );
+                    std::sort(neighbors.begin(), neighbors.end());
+                    index_t nb_neighbors = 0;
+                    for(index_t j: neighbors) {
+                        if(j != i) {
+                            G.push_back(j);
+                            ++nb_neighbors;
+                        }
+                    }
+                    graph_ptr[i+1] = nb_neighbors;
+                }
+            },
+            1, true
+        );
+
+        for(index_t i=0; i<nb; ++i) {
+            graph_ptr[i+1] += graph_ptr[i];
+        }
+        geo_assert(
+            graph_ptr[nb] <= Numeric::uint64(graph.max_size())
+        );
+        graph.resize(size_t(graph_ptr[nb]));
+        parallel_for(
+            0, nb_blocks,
+            [&](index_t k) {
+                const index_t* G = block_graph[k].data();
+                for(index_t kk=block_begin(k); kk<block_begin(k+1); ++kk) {
+                    index_t i = order[kk];
+                    index_t nb_neighbors =
+                        index_t(graph_ptr[i+1] - graph_ptr[i]);
+                    std::copy(
+                        G, G + nb_neighbors,
+                        graph.data() + size_t(graph_ptr[i])
+                    );
+                    G += nb_neighbors;
+                }
+            }
+        );
+    }
+
     void NearestNeighborSearch::set_points(
         index_t nb_points, const double* points
     ) {
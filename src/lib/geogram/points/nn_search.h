@@ -48,6 +48,7 @@
 
 #include <geogram/basic/common.h>
 #include <geogram/basic/numeric.h>
+#include <geogram/basic/memory.h>
 #include <geogram/basic/smart_pointer.h>
 #include <geogram/basic/counted.h>
 #include <geogram/basic/factory.h>
@@ -190,6 +191,102 @@ namespace GEO {
             double* neighbors_sq_dist
         ) const;
 
+        /**
+         * \brief Finds the nearest neighbors of a set of points given
+         *  by coordinates, in parallel.
+         * \details The queries are sorted spatially, then each thread
+         *  processes a contiguous chunk of the sorted queries. The
+         *  neighbors of a query are used to initialize the search
+         *  for the next one. The squared distances are the same as
+         *  the ones returned by get_nearest_neighbors() for each query
+         *  point. When several points are at the same distance from a
+         *  query point, they may be returned in a different order, and
+         *  if they are at the distance of the farthest neighbor, a
+         *  different subset of them may be returned, since the initial
+         *  guess changes which one is found first.
+         * \param[in] nb_neighbors number of neighbors to be searched
+         *  for each query point. Should be smaller or equal to
+         *  nb_points()
+         * \param[in] nb_queries number of query points
+         * \param[in] query_points an array of nb_queries points
+         * \param[out] neighbors array of nb_queries * nb_neighbors
+         *  index_t. The neighbors of query point q are stored in
+         *  neighbors[q*nb_neighbors ... (q+1)*nb_neighbors-1]
+         * \param[out] neighbors_sq_dist array of nb_queries * nb_neighbors
+         *  doubles, or nullptr if squared distances are not needed
+         * \param[in] query_stride number of doubles between two
+         *  consecutive query points, or 0 if they are packed
+         */
+        virtual void get_nearest_neighbors_batch(
+            index_t nb_neighbors,
+            index_t nb_queries,
+            const double* query_points,
+            index_t* neighbors,
+            double* neighbors_sq_dist,
+            index_t query_stride = 0
+        ) const;
+
+        /**
+         * \brief Finds the nearest neighbors of a range of the points
+         *  inserted in this NearestNeighborSearch, in parallel.
+         * \see get_nearest_neighbors_batch()
+         * \param[in] nb_neighbors number of neighbors to be searched
+         *  for each point. Should be smaller or equal to nb_points()
+         * \param[in] first , last the query points are the points
+         *  of index first ... last-1
+         * \param[out] neighbors array of (last-first) * nb_neighbors
+         *  index_t. The neighbors of point i are stored in
+         *  neighbors[(i-first)*nb_neighbors ... (i-first+1)*nb_neighbors-1]
+         * \param[out] neighbors_sq_dist array of (last-first) * nb_neighbors
+         *  doubles, or nullptr if squared distances are not needed
+         */
+        virtual void get_nearest_neighbors_of_points(
+            index_t nb_neighbors,
+            index_t first, index_t last,
+            index_t* neighbors,
+            double* neighbors_sq_dist
+        ) const;
+
+        /**
+         * \brief Finds all the points in a ball.
+         * \details The default implementation emulates the ball query
+         *  with nearest neighbors queries of increasing size.
+         * \param[in] query_point array of dimension() doubles, the
+         *  center of the ball
+         * \param[in] sq_radius the squared radius of the ball
+         * \param[out] neighbors the indices of the points at a squared
+         *  distance smaller or equal to \p sq_radius from
+         *  \p query_point, in no particular order
+         * \param[out] neighbors_sq_dist the squared distances between
+         *  \p query_point and the points in \p neighbors
+         */
+        virtual void get_neighbors_in_ball(
+            const double* query_point,
+            double sq_radius,
+            vector<index_t>& neighbors,
+            vector<double>& neighbors_sq_dist
+        ) const;
+
+        /**
+         * \brief Computes the graph that connects each pair of points
+         *  nearer than a given distance, in parallel.
+         * \details The graph is stored in compressed row storage: the
+         *  neighbors of point i are
+         *  graph[graph_ptr[i] ... graph_ptr[i+1]-1], sorted by
+         *  increasing index. A point is not its own neighbor.
+         *  The number of edges can exceed 2^32 for dense graphs, thus
+         *  the offsets are 64-bit and \p graph is a std::vector.
+         * \param[in] radius the maximum distance between two
+         *  neighbors
+         * \param[out] graph_ptr nb_points()+1 offsets in \p graph
+         * \param[out] graph the concatenated lists of neighbors
+         */
+        virtual void get_radius_graph(
+            double radius,
+            vector<Numeric::uint64>& graph_ptr,
+            std::vector<index_t>& graph
+        ) const;
+
         /**
          * \brief Nearest neighbor search.
          * \param[in] query_point array of dimension() doubles
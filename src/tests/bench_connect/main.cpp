@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/process.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Creates a triangulated grid, without connecting it.
+     * \param[out] M the generated mesh
+     * \param[in] n number of vertices on each side of the grid
+     */
+    void create_grid(Mesh& M, index_t n) {
+        M.clear();
+        M.vertices.set_dimension(3);
+        M.vertices.create_vertices(n*n);
+        for(index_t i=0; i<n; ++i) {
+            for(index_t j=0; j<n; ++j) {
+                double* p = M.vertices.point_ptr(i*n+j);
+                p[0] = double(i);
+                p[1] = double(j);
+                p[2] = 0.0;
+            }
+        }
+        index_t f = M.facets.create_triangles(2*(n-1)*(n-1));
+        for(index_t i=0; i+1<n; ++i) {
+            for(index_t j=0; j+1<n; ++j) {
+                index_t v00 = i*n+j;
+                index_t v10 = v00+n;
+                M.facets.set_vertex(f,0,v00);
+                M.facets.set_vertex(f,1,v10);
+                M.facets.set_vertex(f,2,v10+1);
+                ++f;
+                M.facets.set_vertex(f,0,v00);
+                M.facets.set_vertex(f,1,v10+1);
+                M.facets.set_vertex(f,2,v00+1);
+                ++f;
+            }
+        }
+    }
+
+    /**
+     * \brief Creates a tetrahedralized grid, without connecting it.
+     * \details Each cube is split into six tetrahedra that share
+     *  its main diagonal.
+     * \param[out] M the generated mesh
+     * \param[in] n number of vertices on each side of the grid
+     */
+    void create_tet_grid(Mesh& M, index_t n) {
+        M.clear();
+        M.vertices.set_dimension(3);
+        M.vertices.create_vertices(n*n*n);
+        for(index_t i=0; i<n; ++i) {
+            for(index_t j=0; j<n; ++j) {
+                for(index_t k=0; k<n; ++k) {
+                    double* p = M.vertices.point_ptr((i*n+j)*n+k);
+                    p[0] = double(i);
+                    p[1] = double(j);
+                    p[2] = double(k);
+                }
+            }
+        }
+        // The six paths from corner 000 to corner 111 along the edges
+        // of a cube, as offsets along the three axes.
+        static const index_t axis_order[6][3] = {
+            {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0}
+        };
+        index_t offset[3] = { n*n, n, 1 };
+        index_t t = M.cells.create_tets(6*(n-1)*(n-1)*(n-1));
+        for(index_t i=0; i+1<n; ++i) {
+            for(index_t j=0; j+1<n; ++j) {
+                for(index_t k=0; k+1<n; ++k) {
+                    index_t v000 = (i*n+j)*n+k;
+                    for(index_t p=0; p<6; ++p) {
+                        index_t v = v000;
+                        M.cells.set_vertex(t,0,v);
+                        for(index_t lv=1; lv<4; ++lv) {
+                            v += offset[axis_order[p][lv-1]];
+                            M.cells.set_vertex(t,lv,v);
+                        }
+                        ++t;
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Connects the facets and the cells of a copy of a mesh.
+     * \param[in] M the mesh
+     * \param[out] result the connected copy of \p M
+     * \param[in] multithreaded if false, multithreading is disabled
+     *  while connecting
+     * \return the elapsed time in seconds
+     */
+    double connect(const Mesh& M, Mesh& result, bool multithreaded) {
+        result.copy(M);
+        bool was_enabled = Process::multithreading_enabled();
+        Process::enable_multithreading(multithreaded);
+        double elapsed = 0.0;
+        {
+            Stopwatch W(multithreaded ? "Parallel" : "Sequential", false);
+            if(result.facets.nb() != 0) {
+                result.facets.connect();
+            }
+            if(result.cells.nb() != 0) {
+                result.cells.connect();
+            }
+            elapsed = W.elapsed_time();
+        }
+        Process::enable_multithreading(was_enabled);
+        return elapsed;
+    }
+
+    /**
+     * \brief Tests whether two connected meshes have the same adjacency.
+     * \param[in] M1 , M2 the two meshes
+     * \retval true if facet corners and cell facets have the same 
+     *  adjacent elements
+     * \retval false otherwise
+     */
+    bool same_adjacency(const Mesh& M1, const Mesh& M2) {
+        if(
+            M1.facet_corners.nb() != M2.facet_corners.nb() ||
+            M1.cell_facets.nb() != M2.cell_facets.nb()
+        ) {
+            return false;
+        }
+        for(index_t c: M1.facet_corners) {
+            if(
+                M1.facet_corners.adjacent_facet(c) !=
+                M2.facet_corners.adjacent_facet(c)
+            ) {
+                return false;
+            }
+        }
+        for(index_t f: M1.cell_facets) {
+            if(
+                M1.cell_facets.adjacent_cell(f) !=
+                M2.cell_facets.adjacent_cell(f)
+            ) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::declare_arg(
+            "grid_size", 1000,
+            "size of the generated triangulated grid "
+            "(if no file is specified)"
+        );
+        CmdLine::declare_arg(
+            "tet_grid_size", 60,
+            "size of the generated tetrahedralized grid "
+            "(if no file is specified)"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames, "<meshfile>")) {
+            return 1;
+        }
+
+        std::vector<Mesh*> meshes;
+        if(filenames.size() == 1) {
+            meshes.push_back(new Mesh);
+            if(!mesh_load(filenames[0], *meshes[0])) {
+                delete meshes[0];
+                return 1;
+            }
+        } else {
+            meshes.push_back(new Mesh);
+            create_grid(*meshes[0], CmdLine::get_arg_uint("grid_size"));
+            meshes.push_back(new Mesh);
+            create_tet_grid(
+                *meshes[1], CmdLine::get_arg_uint("tet_grid_size")
+            );
+        }
+
+        bool ok = true;
+        for(Mesh* M: meshes) {
+            Logger::out("Connect")
+                << "Mesh with " << M->facets.nb() << " facets and "
+                << M->cells.nb() << " cells, "
+                << Process::maximum_concurrent_threads() << " threads"
+                << std::endl;
+
+            Mesh M_seq;
+            double t_seq = connect(*M, M_seq, false);
+            Mesh M_par;
+            double t_par = connect(*M, M_par, true);
+            bool same = same_adjacency(M_seq, M_par);
+
+            Logger::out("Connect")
+                << "Sequential: " << t_seq << "s"
+                << " Parallel: " << t_par << "s"
+                << " Speedup: " << ((t_par == 0.0) ? 0.0 : t_seq / t_par)
+                << (same ? " (same result)" : " (results differ !)")
+                << std::endl;
+            ok = ok && same;
+            delete M;
+        }
+        if(!ok) {
+            return 1;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+
+#include <random>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Creates a triangulated grid.
+     * \param[out] M the generated mesh
+     * \param[in] n number of vertices on each side of the grid
+     */
+    void create_grid(Mesh& M, index_t n) {
+        M.clear();
+        M.vertices.set_dimension(3);
+        M.vertices.create_vertices(n*n);
+        for(index_t i=0; i<n; ++i) {
+            for(index_t j=0; j<n; ++j) {
+                double* p = M.vertices.point_ptr(i*n+j);
+                p[0] = double(i);
+                p[1] = double(j);
+                p[2] = 0.0;
+            }
+        }
+        index_t f = M.facets.create_triangles(2*(n-1)*(n-1));
+        for(index_t i=0; i+1<n; ++i) {
+            for(index_t j=0; j+1<n; ++j) {
+                index_t v00 = i*n+j;
+                index_t v10 = v00+n;
+                M.facets.set_vertex(f,0,v00);
+                M.facets.set_vertex(f,1,v10);
+                M.facets.set_vertex(f,2,v10+1);
+                ++f;
+                M.facets.set_vertex(f,0,v00);
+                M.facets.set_vertex(f,1,v10+1);
+                M.facets.set_vertex(f,2,v00+1);
+                ++f;
+            }
+        }
+        M.facets.connect();
+    }
+
+    /**
+     * \brief Deletes facets in several rounds.
+     * \details Facets are identified by their index in the initial
+     *  mesh, stored in the "id" facet attribute.
+     * \param[in,out] M the mesh
+     * \param[in] rounds the initial indices of the facets to be
+     *  deleted at each round
+     * \param[in] deferred if true, facets are marked at each round
+     *  and deleted at the end, else they are deleted at each round
+     */
+    void delete_facets(
+        Mesh& M, const std::vector<vector<index_t> >& rounds, bool deferred
+    ) {
+        Attribute<index_t> id(M.facets.attributes(), "id");
+        if(deferred) {
+            // Facets are not renumbered until the end, thus the
+            // initial indices can be used directly.
+            for(const vector<index_t>& round: rounds) {
+                for(index_t f: round) {
+                    M.facets.mark_for_deletion(f);
+                }
+            }
+            M.facets.delete_marked_elements();
+            return;
+        }
+        vector<index_t> deleted_id(M.facets.nb(), 0);
+        for(const vector<index_t>& round: rounds) {
+            for(index_t f: round) {
+                deleted_id[f] = 1;
+            }
+            vector<index_t> to_delete(M.facets.nb(), 0);
+            for(index_t f: M.facets) {
+                to_delete[f] = deleted_id[id[f]];
+            }
+            M.facets.delete_elements(to_delete);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::declare_arg(
+            "grid_size", 1000,
+            "size of the generated grid (if no file is specified)"
+        );
+        CmdLine::declare_arg("nb_rounds", 30, "number of deletion rounds");
+        CmdLine::declare_arg(
+            "nb_deleted", 100, "number of facets deleted at each round"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames, "<meshfile>")) {
+            return 1;
+        }
+
+        Mesh M;
+        if(filenames.size() == 1) {
+            if(!mesh_load(filenames[0], M)) {
+                return 1;
+            }
+        } else {
+            create_grid(M, CmdLine::get_arg_uint("grid_size"));
+        }
+
+        {
+            Attribute<index_t> id(M.facets.attributes(), "id");
+            Attribute<double> weight(M.facet_corners.attributes(), "weight");
+            for(index_t f: M.facets) {
+                id[f] = f;
+            }
+            for(index_t c: M.facet_corners) {
+                weight[c] = double(c);
+            }
+        }
+
+        index_t nb_rounds = CmdLine::get_arg_uint("nb_rounds");
+        index_t nb_deleted = CmdLine::get_arg_uint("nb_deleted");
+        std::vector<vector<index_t> > rounds(nb_rounds);
+        std::mt19937 rng(0);
+        std::uniform_int_distribution<index_t> random_facet(
+            0, M.facets.nb()-1
+        );
+        for(index_t r=0; r<nb_rounds; ++r) {
+            for(index_t i=0; i<nb_deleted; ++i) {
+                rounds[r].push_back(random_facet(rng));
+            }
+        }
+
+        Logger::out("Delete")
+            << nb_rounds << " rounds of " << nb_deleted << " facets in a mesh"
+            << " with " << M.facets.nb() << " facets" << std::endl;
+
+        Mesh M_immediate;
+        M_immediate.copy(M);
+        {
+            Stopwatch W("Immediate");
+            delete_facets(M_immediate, rounds, false);
+        }
+
+        Mesh M_deferred;
+        M_deferred.copy(M);
+        {
+            Stopwatch W("Deferred");
+            delete_facets(M_deferred, rounds, true);
+        }
+
+        bool same =
+            M_immediate.vertices.nb() == M_deferred.vertices.nb() &&
+            M_immediate.facets.nb() == M_deferred.facets.nb();
+        if(same) {
+            Attribute<index_t> id1(M_immediate.facets.attributes(), "id");
+            Attribute<index_t> id2(M_deferred.facets.attributes(), "id");
+            for(index_t f: M_immediate.facets) {
+                same = same && (id1[f] == id2[f]);
+            }
+            for(index_t c: M_immediate.facet_corners) {
+                same = same &&
+                    M_immediate.facet_corners.vertex(c) ==
+                    M_deferred.facet_corners.vertex(c) &&
+                    M_immediate.facet_corners.adjacent_facet(c) ==
+                    M_deferred.facet_corners.adjacent_facet(c);
+            }
+        }
+        Logger::out("Delete")
+            << "Remaining facets: " << M_deferred.facets.nb()
+            << (same ? " (same result)" : " (results differ !)")
+            << std::endl;
+        if(!same) {
+            return 1;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/basic/geometry_nd.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+#include <geogram/mesh/mesh_reorder.h>
+
+#include <random>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Computes the average distance between two consecutive
+     *  points in a spatial order.
+     * \details Used to compare the quality of the orders.
+     * \param[in] points the coordinates of the points
+     * \param[in] order the spatial order
+     * \return the average distance between consecutive points
+     */
+    double average_step(
+        const vector<double>& points, const vector<index_t>& order
+    ) {
+        double result = 0.0;
+        for(index_t i=1; i<order.size(); ++i) {
+            result += Geom::distance(
+                &points[3*order[i-1]], &points[3*order[i]], 3
+            );
+        }
+        return result / double(std::max(order.size(), index_t(2)) - 1);
+    }
+
+    /**
+     * \brief Benchmarks compute_Hilbert_order() and compute_BRIO_order()
+     *  with a spatial sort mode.
+     * \param[in] name the name of the mode, displayed in the logger
+     * \param[in] points the coordinates of the points
+     * \param[in] mode the spatial sort mode
+     */
+    void bench(
+        const std::string& name, const vector<double>& points,
+        SpatialSortMode mode
+    ) {
+        index_t nb = points.size() / 3;
+        vector<index_t> order(nb);
+
+        {
+            Stopwatch W(name + " Hilbert");
+            for(index_t i=0; i<nb; ++i) {
+                order[i] = i;
+            }
+            compute_Hilbert_order(
+                nb, points.data(), order, 0, nb, 3, 3, mode
+            );
+        }
+        Logger::out(name) << "Hilbert average step: "
+                          << average_step(points, order) << std::endl;
+
+        {
+            Stopwatch W(name + " BRIO");
+            compute_BRIO_order(
+                nb, points.data(), order, 3, 3, 64, 0.125, nullptr, mode
+            );
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::declare_arg(
+            "nb_points", 1000000,
+            "number of random points (if no file is specified)"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames, "<pointsfile>")) {
+            return 1;
+        }
+
+        vector<double> points;
+        if(filenames.size() == 1) {
+            Mesh M;
+            if(!mesh_load(filenames[0], M)) {
+                return 1;
+            }
+            points.resize(3*M.vertices.nb());
+            for(index_t v: M.vertices) {
+                for(index_t c=0; c<3; ++c) {
+                    points[3*v+c] = M.vertices.point_ptr(v)[c];
+                }
+            }
+        } else {
+            index_t nb = CmdLine::get_arg_uint("nb_points");
+            points.resize(3*nb);
+            std::mt19937 rng(0);
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            for(index_t i=0; i<3*nb; ++i) {
+                points[i] = uniform(rng);
+            }
+        }
+
+        Logger::out("SpatialSort")
+            << "Sorting " << points.size()/3 << " points" << std::endl;
+
+        bench("Recursive", points, SPATIAL_SORT_RECURSIVE);
+        bench("Radix", points, SPATIAL_SORT_RADIX);
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
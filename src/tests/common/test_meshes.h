@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#ifndef GEOGRAM_TESTS_COMMON_TEST_MESHES
+#define GEOGRAM_TESTS_COMMON_TEST_MESHES
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/geometry.h>
+#include <geogram/mesh/mesh.h>
+
+#include <map>
+
+/**
+ * \file tests/common/test_meshes.h
+ * \brief Simple meshes generated by the test programs.
+ */
+
+namespace GEO {
+
+    namespace TestMeshes {
+
+        /**
+         * \brief Creates the boundary of the unit cube, with a regular
+         *  grid of n x n squares on each face, split into triangles.
+         * \details The vertices are shared between the facets, the
+         *  facets are oriented outwards and connected.
+         * \param[out] M the generated mesh
+         * \param[in] n the number of subdivisions along each edge
+         *  of the cube
+         */
+        inline void create_cube_surface(Mesh& M, index_t n) {
+            M.clear();
+            Numeric::uint64 N = n + 1;
+            // Vertex of the grid point (i,j,k) of the boundary, indexed
+            // by i + N*(j + N*k)
+            std::map<Numeric::uint64, index_t> grid_vertex;
+            for(index_t axis=0; axis<3; ++axis) {
+                for(index_t side=0; side<2; ++side) {
+                    for(index_t i=0; i<n; ++i) {
+                        for(index_t j=0; j<n; ++j) {
+                            index_t v[4];
+                            for(index_t lv=0; lv<4; ++lv) {
+                                index_t key[3];
+                                key[axis] = side * n;
+                                key[(axis+1)%3] =
+                                    i + index_t(lv==1 || lv==2);
+                                key[(axis+2)%3] = j + index_t(lv >= 2);
+                                Numeric::uint64 grid_index =
+                                    key[0] + N * (key[1] + N * key[2]);
+                                auto it = grid_vertex.find(grid_index);
+                                if(it == grid_vertex.end()) {
+                                    vec3 p(
+                                        static_cast<double>(key[0]) / double(n),
+                                        static_cast<double>(key[1]) / double(n),
+                                        static_cast<double>(key[2]) / double(n)
+                                    );
+                                    index_t w = M.vertices.create_vertex(
+                                        p.data()
+                                    );
+                                    it = grid_vertex.insert(
+                                        std::make_pair(grid_index, w)
+                                    ).first;
+                                }
+                                v[lv] = it->second;
+                            }
+                            if(side == 1) {
+                                M.facets.create_triangle(v[0], v[1], v[2]);
+                                M.facets.create_triangle(v[0], v[2], v[3]);
+                            } else {
+                                M.facets.create_triangle(v[0], v[2], v[1]);
+                                M.facets.create_triangle(v[0], v[3], v[2]);
+                            }
+                        }
+                    }
+                }
+            }
+            M.facets.connect();
+        }
+
+        /**
+         * \brief Creates the unit cube, with a regular grid of n x n x n
+         *  cubes, each of them split into six tetrahedra.
+         * \details The cells are connected and the boundary is
+         *  triangulated.
+         * \param[out] M the generated mesh
+         * \param[in] n the number of subdivisions along each edge
+         *  of the cube
+         */
+        inline void create_cube_volume(Mesh& M, index_t n) {
+            M.clear();
+            index_t N = n + 1;
+            for(index_t k=0; k<N; ++k) {
+                for(index_t j=0; j<N; ++j) {
+                    for(index_t i=0; i<N; ++i) {
+                        vec3 p(
+                            double(i) / double(n),
+                            double(j) / double(n),
+                            double(k) / double(n)
+                        );
+                        M.vertices.create_vertex(p.data());
+                    }
+                }
+            }
+            for(index_t k=0; k<n; ++k) {
+                for(index_t j=0; j<n; ++j) {
+                    for(index_t i=0; i<n; ++i) {
+                        index_t v[8];
+                        for(index_t lv=0; lv<8; ++lv) {
+                            v[lv] = (i + (lv & 1)) +
+                                N * (j + ((lv >> 1) & 1)) +
+                                N * N * (k + ((lv >> 2) & 1));
+                        }
+                        M.cells.create_tet(v[0], v[1], v[3], v[7]);
+                        M.cells.create_tet(v[0], v[1], v[7], v[5]);
+                        M.cells.create_tet(v[0], v[5], v[7], v[4]);
+                        M.cells.create_tet(v[0], v[3], v[2], v[7]);
+                        M.cells.create_tet(v[0], v[2], v[6], v[7]);
+                        M.cells.create_tet(v[0], v[6], v[4], v[7]);
+                    }
+                }
+            }
+            M.cells.connect();
+            M.cells.compute_borders();
+        }
+
+        /**
+         * \brief Translates all the vertices of a mesh.
+         * \param[in,out] M the mesh, with 3d vertices
+         * \param[in] t the translation vector
+         */
+        inline void translate(Mesh& M, const vec3& t) {
+            for(index_t v: M.vertices) {
+                double* p = M.vertices.point_ptr(v);
+                p[0] += t.x;
+                p[1] += t.y;
+                p[2] += t.z;
+            }
+        }
+    }
+}
+
+#endif
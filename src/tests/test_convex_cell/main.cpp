@@ -362,7 +362,7 @@ int main(int argc, char** argv) {
             }
         }
 
-        CmdLine::set_arg("nb_clip", delaunay->nb_vertices() - 1);
+        CmdLine::set_arg("nb_clip", int(delaunay->nb_vertices()) - 1);
 
         Mesh M;
         initialize_mesh_with_box(M);
@@ -0,0 +1,236 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/basic/geometry_nd.h>
+#include <geogram/points/dynamic_kd_tree.h>
+
+#include <random>
+#include <algorithm>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Checks the nearest neighbors and ball queries of a
+     *  DynamicKdTree against exhaustive search.
+     * \param[in] NN the DynamicKdTree
+     * \param[in] q the query point
+     * \param[in] nb_neighbors number of neighbors
+     * \return true if the results match, false otherwise
+     */
+    bool check_queries(
+        const DynamicKdTree& NN, const double* q, index_t nb_neighbors
+    ) {
+        std::vector<double> sq_dist;
+        for(index_t i=0; i<NN.nb_points(); ++i) {
+            if(!NN.point_is_removed(i)) {
+                sq_dist.push_back(Geom::distance2(q, NN.point_ptr(i), 3));
+            }
+        }
+        std::sort(sq_dist.begin(), sq_dist.end());
+        nb_neighbors = std::min(nb_neighbors, index_t(sq_dist.size()));
+        if(nb_neighbors == 0) {
+            return true;
+        }
+
+        vector<index_t> neighbors(nb_neighbors);
+        vector<double> neighbors_sq_dist(nb_neighbors);
+        NN.get_nearest_neighbors(
+            nb_neighbors, q, neighbors.data(), neighbors_sq_dist.data()
+        );
+        for(index_t k=0; k<nb_neighbors; ++k) {
+            if(
+                NN.point_is_removed(neighbors[k]) ||
+                neighbors_sq_dist[k] != sq_dist[k] ||
+                Geom::distance2(q, NN.point_ptr(neighbors[k]), 3) !=
+                sq_dist[k]
+            ) {
+                return false;
+            }
+        }
+
+        double R = sq_dist[nb_neighbors-1];
+        vector<index_t> in_ball;
+        vector<double> in_ball_sq_dist;
+        NN.get_neighbors_in_ball(q, R, in_ball, in_ball_sq_dist);
+        index_t expected = index_t(
+            std::upper_bound(sq_dist.begin(), sq_dist.end(), R) -
+            sq_dist.begin()
+        );
+        return in_ball.size() == expected;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::import_arg_group("algo");
+        CmdLine::declare_arg("nb_points", 100000, "number of points");
+        CmdLine::declare_arg("nb_steps", 100, "number of motion steps");
+        CmdLine::declare_arg(
+            "moved", 0.01, "fraction of the points moved at each step"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames)) {
+            return 1;
+        }
+
+        index_t nb_points = CmdLine::get_arg_uint("nb_points");
+        index_t nb_steps = CmdLine::get_arg_uint("nb_steps");
+        double moved = CmdLine::get_arg_double("moved");
+        const index_t nb_neighbors = 10;
+
+        std::mt19937 random(0);
+        std::uniform_real_distribution<double> U(0.0, 1.0);
+
+        // Random insertions, removals and motions, checked against
+        // exhaustive search.
+        {
+            NearestNeighborSearch_var NN_var = new DynamicKdTree(3);
+            DynamicKdTree& NN = static_cast<DynamicKdTree&>(*NN_var);
+            bool ok = true;
+            for(index_t k=0; k<20000 && ok; ++k) {
+                double p[3] = { U(random), U(random), U(random) };
+                double r = U(random);
+                index_t i = NN.nb_points() == 0 ? 0 :
+                    index_t(random() % NN.nb_points());
+                if(r < 0.1 && NN.nb_points() != 0) {
+                    // Duplicates a point given by a pointer into the
+                    // storage of the tree, that the insertion may
+                    // reallocate.
+                    double pi[3];
+                    Memory::copy(pi, NN.point_ptr(i), sizeof(pi));
+                    index_t j = NN.insert_point(NN.point_ptr(i));
+                    ok = (Geom::distance2(pi, NN.point_ptr(j), 3) == 0.0);
+                } else if(r < 0.5 || NN.nb_alive_points() == 0) {
+                    NN.insert_point(p);
+                } else if(!NN.point_is_removed(i)) {
+                    if(r < 0.7) {
+                        NN.remove_point(i);
+                    } else {
+                        NN.move_point(i, p);
+                    }
+                }
+                if(k % 97 == 0) {
+                    double q[3] = { U(random), U(random), U(random) };
+                    ok = ok && check_queries(NN, q, nb_neighbors);
+                }
+            }
+            if(!ok) {
+                Logger::err("DynKdTree") << "Mismatch" << std::endl;
+                return 2;
+            }
+            Logger::out("DynKdTree") << "Queries match exhaustive search"
+                                     << std::endl;
+        }
+
+        // Relaxation-like loop: at each step, a fraction of the points
+        // move, then their neighbors are queried.
+        vector<double> points(3 * nb_points);
+        for(double& x: points) {
+            x = U(random);
+        }
+        index_t nb_moved = index_t(moved * double(nb_points));
+        vector<index_t> neighbors(nb_neighbors);
+        vector<double> neighbors_sq_dist(nb_neighbors);
+
+        for(index_t mode=0; mode<2; ++mode) {
+            std::mt19937 step_random(1);
+            vector<double> P = points;
+            NearestNeighborSearch_var NN = (mode == 0) ?
+                NearestNeighborSearch::create(3, "BNN") :
+                new DynamicKdTree(3);
+            NN->set_points(nb_points, P.data());
+            double checksum = 0.0;
+            Stopwatch W(mode == 0 ? "Rebuild" : "Dynamic");
+            for(index_t step=0; step<nb_steps; ++step) {
+                vector<index_t> moved_points(nb_moved);
+                vector<double> new_coords(3 * nb_moved);
+                for(index_t k=0; k<nb_moved; ++k) {
+                    index_t i = index_t(step_random() % nb_points);
+                    moved_points[k] = i;
+                    for(index_t c=0; c<3; ++c) {
+                        P[3*i+c] += 0.001 * (U(step_random) - 0.5);
+                        new_coords[3*k+c] = P[3*i+c];
+                    }
+                }
+                if(mode == 0) {
+                    NN->set_points(nb_points, P.data());
+                } else {
+                    static_cast<DynamicKdTree&>(*NN).move_points(
+                        nb_moved, moved_points.data(), new_coords.data()
+                    );
+                }
+                for(index_t i: moved_points) {
+                    NN->get_nearest_neighbors(
+                        nb_neighbors, &P[3*i],
+                        neighbors.data(), neighbors_sq_dist.data()
+                    );
+                    checksum += neighbors_sq_dist[nb_neighbors-1];
+                }
+            }
+            Logger::out("DynKdTree") << (mode == 0 ? "Rebuild" : "Dynamic")
+                                     << " checksum=" << checksum
+                                     << std::endl;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
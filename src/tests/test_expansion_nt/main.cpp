@@ -44,7 +44,11 @@
  */
 
 #include <geogram/numerics/expansion_nt.h>
+#include <geogram/basic/common.h>
+#include <geogram/basic/process.h>
+#include <geogram/basic/stopwatch.h>
 #include <iostream>
+#include <type_traits>
 
 /**
  * \brief Outputs an expansion_nt to a stream.
@@ -120,10 +124,64 @@ template <class T> inline void compute2(const T& zzz) {
 }
 
 
+/**
+ * \brief Evaluates a 3x3 determinant with many temporaries.
+ * \details Used to benchmark the allocation of temporaries.
+ * \param[in] seed used to generate the coefficients
+ * \return the sign of the determinant
+ */
+template <class T> inline GEO::Sign det3x3(GEO::index_t seed) {
+    double a[9];
+    for(GEO::index_t i=0; i<9; ++i) {
+        a[i] = double((seed * 7919u + i * 104729u) % 1000u) * 1e-3 + 1e-20;
+    }
+    T r = 
+        T(a[0])*(T(a[4])*T(a[8])-T(a[5])*T(a[7])) -
+        T(a[1])*(T(a[3])*T(a[8])-T(a[5])*T(a[6])) +
+        T(a[2])*(T(a[3])*T(a[7])-T(a[4])*T(a[6])) ;
+    return GEO::geo_sgn(r);
+}
+
+#ifndef GEOGRAM_PSM
+
+/**
+ * \brief Measures the time taken by evaluating many determinants,
+ *  sequentially and in parallel.
+ * \param[in] name the name of the number type, to be displayed
+ * \param[in] nb number of determinants to be evaluated
+ */
+template <class T> inline void benchmark(const char* name, GEO::index_t nb) {
+    GEO::index_t nb_positive = 0;
+    double t0 = GEO::SystemStopwatch::now();
+    for(GEO::index_t i=0; i<nb; ++i) {
+        if(det3x3<T>(i) == GEO::POSITIVE) {
+            ++nb_positive;
+        }
+    }
+    double t1 = GEO::SystemStopwatch::now();
+    GEO::parallel_for(
+        0, nb, [](GEO::index_t i) { det3x3<T>(i); }
+    );
+    double t2 = GEO::SystemStopwatch::now();
+    std::cout << "   " << name << ": "
+              << nb << " determinants ("
+              << nb_positive << " positive) "
+              << "sequential: " << (t1 - t0) << "s "
+              << "parallel: " << (t2 - t1) << "s"
+              << std::endl;
+}
+
+#endif
+
 int main() {
     //   This function needs to be called before
-    // using expansion_nt.
+    // using expansion_nt (it also initializes the
+    // multithreading used by the benchmark).
+#ifdef GEOGRAM_PSM
     GEO::expansion::initialize();
+#else    
+    GEO::initialize();
+#endif    
 
     std::cout << "Using double:" << std::endl;
     compute(double());
@@ -142,5 +200,41 @@ int main() {
     std::cout << "Using rational_nt:" << std::endl;    
     compute2(GEO::rational_nt());
 
+#ifndef GEOGRAM_PSM    
+    {
+        // Moves do not allocate, thus vectors of numbers are not
+        // copied when they grow.
+        static_assert(
+            std::is_nothrow_move_constructible<GEO::expansion_nt>::value &&
+            std::is_nothrow_move_constructible<GEO::rational_nt>::value,
+            "moves of exact numbers should be noexcept"
+        );
+
+        // A moved-from expansion_nt is zero, and can be used again.
+        // A moved-from rational_nt can be assigned.
+        GEO::expansion_nt a(2.0);
+        GEO::expansion_nt b(std::move(a));
+        GEO::rational_nt r(b, b);
+        GEO::rational_nt s(std::move(r));
+        std::cout << "Moved-from signs: " << GEO::geo_sgn(a) << " "
+                  << GEO::geo_sgn(r) << std::endl;
+        a += b;
+        r = s;
+        r += s;
+        if(
+            GEO::geo_sgn(a - b) != GEO::ZERO ||
+            GEO::geo_sgn(r - s - s) != GEO::ZERO
+        ) {
+            std::cout << "Error: invalid moved-from number" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Benchmark:" << std::endl;
+    benchmark<double>("double", 1000000);
+    benchmark<GEO::expansion_nt>("expansion_nt", 1000000);
+    benchmark<GEO::rational_nt>("rational_nt", 1000000);
+#endif    
+    
     return 0;
 }
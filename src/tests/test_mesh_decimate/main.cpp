@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+#include <geogram/mesh/mesh_geometry.h>
+#include <geogram/mesh/mesh_decimate.h>
+
+#include "../common/test_meshes.h"
+
+#include <map>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Tests whether a triangulated surface is manifold and
+     *  consistently oriented.
+     * \param[in] M the mesh
+     * \return true if each oriented edge appears at most once, 
+     *  false otherwise
+     */
+    bool is_oriented_manifold(const Mesh& M) {
+        std::map<std::pair<index_t, index_t>, index_t> edges;
+        for(index_t f=0; f<M.facets.nb(); ++f) {
+            for(index_t lv=0; lv<3; ++lv) {
+                index_t v1 = M.facets.vertex(f,lv);
+                index_t v2 = M.facets.vertex(f,(lv+1)%3);
+                if(v1 == v2 || ++edges[std::make_pair(v1,v2)] > 1) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * \brief Computes the largest distance between a corner of the
+     *  unit cube and the nearest vertex of a mesh.
+     * \param[in] M the mesh
+     * \return the largest distance over the eight corners
+     */
+    double max_corner_distance(const Mesh& M) {
+        double result = 0.0;
+        for(index_t c=0; c<8; ++c) {
+            vec3 q(double(c & 1), double((c >> 1) & 1), double(c >> 2));
+            double d = Numeric::max_float64();
+            for(index_t v=0; v<M.vertices.nb(); ++v) {
+                d = std::min(d, length(vec3(M.vertices.point_ptr(v)) - q));
+            }
+            result = std::max(result, d);
+        }
+        return result;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::import_arg_group("algo");
+        CmdLine::declare_arg(
+            "grid", 100, "subdivisions of the cube (if no input file)"
+        );
+        CmdLine::declare_arg(
+            "ratio", 0.01, "target nb. of facets relative to the input"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames, "<inmesh> <outmesh>")) {
+            return 1;
+        }
+
+        Mesh M;
+        bool cube = filenames.size() == 0;
+        if(cube) {
+            TestMeshes::create_cube_surface(
+                M, CmdLine::get_arg_uint("grid")
+            );
+        } else if(!mesh_load(filenames[0], M)) {
+            return 1;
+        }
+        double ratio = CmdLine::get_arg_double("ratio");
+        index_t nb_facets = index_t(ratio * double(M.facets.nb()));
+
+        // Reference: vertex clustering with a similar nb. of facets.
+        {
+            Mesh M2;
+            M2.copy(M);
+            index_t nb_bins = index_t(::sqrt(double(nb_facets) / 3.0));
+            Stopwatch W("VCluster");
+            mesh_decimate_vertex_clustering(M2, std::max(nb_bins, 2u));
+            Logger::out("VCluster") << "Facets: " << M2.facets.nb()
+                                    << std::endl;
+        }
+
+        double area = Geom::mesh_area(M);
+        mesh_decimate_quadric(M, nb_facets);
+        Logger::out("Decimate") << "Area: " << area << " -> "
+                                << Geom::mesh_area(M) << std::endl;
+
+        if(!is_oriented_manifold(M)) {
+            Logger::err("Decimate") << "Non-manifold or inconsistently "
+                                    << "oriented result" << std::endl;
+            return 2;
+        }
+        if(cube) {
+            double d = max_corner_distance(M);
+            Logger::out("Decimate") << "Max corner distance: " << d
+                                    << std::endl;
+            if(d > 1e-3) {
+                Logger::err("Decimate") << "Lost a corner" << std::endl;
+                return 2;
+            }
+        }
+
+        if(filenames.size() >= 2) {
+            mesh_save(M, filenames[1]);
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
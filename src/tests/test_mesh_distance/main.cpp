@@ -0,0 +1,127 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+#include <geogram/mesh/mesh_distance.h>
+
+#include "../common/test_meshes.h"
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::import_arg_group("algo");
+        CmdLine::declare_arg("tolerance", 1e-4, "tolerance of the bounds");
+        CmdLine::declare_arg(
+            "sampling_step", 0.01, "sampling step (for comparison)"
+        );
+
+        std::vector<std::string> filenames;
+        if(!CmdLine::parse(argc, argv, filenames, "<mesh1> <mesh2>")) {
+            return 1;
+        }
+
+        double tolerance = CmdLine::get_arg_double("tolerance");
+        double sampling_step = CmdLine::get_arg_double("sampling_step");
+
+        Mesh M1, M2;
+        if(filenames.size() == 2) {
+            if(
+                !mesh_load(filenames[0], M1) || 
+                !mesh_load(filenames[1], M2)
+            ) {
+                return 1;
+            }
+        } else {
+            // The distance between a cube and a translated copy of 
+            // it is the length of the translation.
+            TestMeshes::create_cube_surface(M1, 10);
+            TestMeshes::create_cube_surface(M2, 7);
+            TestMeshes::translate(M2, vec3(0.0, 0.0, 0.0123));
+        }
+
+        double lower_bound, upper_bound;
+        {
+            Stopwatch W("Bounds");
+            mesh_symmetric_Hausdorff_distance_bounds(
+                M1, M2, tolerance, lower_bound, upper_bound
+            );
+        }
+        double sampled;
+        {
+            Stopwatch W("Sampling");
+            sampled = mesh_symmetric_Hausdorff_distance(
+                M1, M2, sampling_step
+            );
+        }
+        Logger::out("Distance") << "Bounds: [" << lower_bound << ", "
+                                << upper_bound << "], sampled: " 
+                                << sampled << std::endl;
+
+        if(
+            upper_bound - lower_bound > tolerance ||
+            sampled > upper_bound ||
+            (filenames.size() != 2 && 
+             ::fabs(lower_bound - 0.0123) > 1e-9)
+        ) {
+            Logger::err("Distance") << "Invalid bounds" << std::endl;
+            return 2;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/basic/process.h>
+#include <geogram/basic/stopwatch.h>
+#include <geogram/mesh/mesh.h>
+#include <geogram/mesh/mesh_io.h>
+#include <geogram/mesh/mesh_sampling.h>
+
+#include "../common/test_meshes.h"
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Computes the smallest distance between two samples.
+     * \param[in] p the samples
+     * \param[in] nb_points the number of samples
+     * \return the smallest distance between two samples
+     */
+    double min_distance(const vector<double>& p, index_t nb_points) {
+        double result = Numeric::max_float64();
+        for(index_t i=0; i<nb_points; ++i) {
+            for(index_t j=i+1; j<nb_points; ++j) {
+                result = std::min(
+                    result,
+                    Geom::distance2(&p[3*i], &p[3*j], 3)
+                );
+            }
+        }
+        return ::sqrt(result);
+    }
+
+    /**
+     * \brief Tests whether the samples are in the unit cube.
+     * \param[in] p the samples
+     * \param[in] nb_points the number of samples
+     * \param[in] on_boundary if set, tests whether the samples
+     *  are on the boundary of the unit cube
+     * \retval true if all the samples are in (resp. on the boundary of) 
+     *  the unit cube
+     * \retval false otherwise
+     */
+    bool samples_in_cube(
+        const vector<double>& p, index_t nb_points, bool on_boundary
+    ) {
+        const double eps = 1e-10;
+        for(index_t i=0; i<nb_points; ++i) {
+            bool boundary = false;
+            for(index_t c=0; c<3; ++c) {
+                double x = p[3*i+c];
+                if(x < -eps || x > 1.0 + eps) {
+                    return false;
+                }
+                boundary = boundary || x < eps || x > 1.0 - eps;
+            }
+            if(on_boundary && !boundary) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * \brief Tests a sampling function.
+     * \details Checks that the samples are in the domain, that they
+     *  do not depend on the number of threads, and (for blue noise) 
+     *  that they are not closer than \p min_dist.
+     * \param[in] name the name of the sampling function
+     * \param[in] sample the sampling function
+     * \param[in] nb_points the number of samples
+     * \param[in] on_boundary true for surfacic sampling
+     * \param[in] min_dist the minimum distance between two samples
+     * \retval true if the test succeeded
+     * \retval false otherwise
+     */
+    bool test_sampling(
+        const std::string& name,
+        std::function<void(double*, index_t)> sample,
+        index_t nb_points, bool on_boundary, double min_dist
+    ) {
+        vector<double> p1(3*nb_points);
+        vector<double> p2(3*nb_points);
+        {
+            Stopwatch W(name);
+            sample(p1.data(), nb_points);
+        }
+        index_t max_threads = Process::maximum_concurrent_threads();
+        Process::set_max_threads(1);
+        sample(p2.data(), nb_points);
+        Process::set_max_threads(max_threads);
+
+        bool OK = true;
+        if(p1 != p2) {
+            Logger::err(name) << "Result depends on number of threads"
+                              << std::endl;
+            OK = false;
+        }
+        if(!samples_in_cube(p1, nb_points, on_boundary)) {
+            Logger::err(name) << "Samples outside of domain" << std::endl;
+            OK = false;
+        }
+        if(min_dist != 0.0) {
+            double d = min_distance(p1, nb_points);
+            Logger::out(name) << "Min. distance: " << d << std::endl;
+            if(d < min_dist) {
+                Logger::err(name) << "Samples too close" << std::endl;
+                OK = false;
+            }
+        }
+        return OK;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::declare_arg("nb_pts", 3000, "number of samples");
+
+        if(!CmdLine::parse(argc, argv)) {
+            return 1;
+        }
+
+        index_t nb_points = CmdLine::get_arg_uint("nb_pts");
+
+        Mesh M;
+        TestMeshes::create_cube_volume(M, 6);
+        Attribute<double> weight; // left unbound
+
+        // Radii of the densest packings of nb_points disks on the
+        // boundary of the cube and spheres in the cube. Weighted
+        // sample elimination achieves more than 0.7 times the
+        // maximum radius.
+        double r_surface = ::sqrt(
+            6.0 / (2.0 * ::sqrt(3.0) * double(nb_points))
+        );
+        double r_volume = ::pow(
+            1.0 / (4.0 * ::sqrt(2.0) * double(nb_points)), 1.0 / 3.0
+        );
+
+        bool OK = true;
+        OK = test_sampling(
+            "Surface",
+            [&](double* p, index_t n) {
+                mesh_generate_random_samples_on_surface<3>(M, p, n, weight);
+            },
+            nb_points, true, 0.0
+        ) && OK;
+        OK = test_sampling(
+            "Volume",
+            [&](double* p, index_t n) {
+                mesh_generate_random_samples_in_volume<3>(M, p, n, weight);
+            },
+            nb_points, false, 0.0
+        ) && OK;
+        OK = test_sampling(
+            "BlueSurface",
+            [&](double* p, index_t n) {
+                mesh_generate_blue_noise_samples_on_surface<3>(
+                    M, p, n, weight
+                );
+            },
+            nb_points, true, 2.0 * 0.6 * r_surface
+        ) && OK;
+        OK = test_sampling(
+            "BlueVolume",
+            [&](double* p, index_t n) {
+                mesh_generate_blue_noise_samples_in_volume<3>(
+                    M, p, n, weight
+                );
+            },
+            nb_points, false, 2.0 * 0.6 * r_volume
+        ) && OK;
+
+        if(!OK) {
+            return 2;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -51,6 +51,7 @@
 #include <geogram/basic/command_line_args.h>
 #include <geogram/basic/stopwatch.h>
 #include <geogram/points/nn_search.h>
+#include <geogram/points/kd_tree.h>
 #include <geogram/mesh/mesh.h>
 #include <geogram/mesh/mesh_io.h>
 
@@ -79,6 +80,10 @@ int main(int argc, char** argv) {
         CmdLine::declare_arg(
             "by_index", false, "query points by index"
         );
+        CmdLine::declare_arg(
+            "float_leaves", false,
+            "compute kd-tree leaf distances in single precision"
+        );
 
         std::vector<std::string> filenames;
         if(!CmdLine::parse(argc, argv, filenames, "pointsfile")) {
@@ -93,6 +98,7 @@ int main(int argc, char** argv) {
         std::string NN1_algo = CmdLine::get_arg("algo:nn_search");
         std::string NN2_algo = CmdLine::get_arg("algo:nn_check");
         bool by_index = CmdLine::get_arg_bool("by_index");
+        bool float_leaves = CmdLine::get_arg_bool("float_leaves");
 
 
         Logger::out("NN Search") << "Using " << NN1_algo << std::endl;
@@ -108,6 +114,15 @@ int main(int argc, char** argv) {
             M.vertices.dimension(), NN2_algo
         );
 
+        if(float_leaves) {
+            KdTree* kd_tree = dynamic_cast<KdTree*>(NN1.get());
+            if(kd_tree == nullptr) {
+                Logger::err("NN Search")
+                    << NN1_algo << " is not a kd-tree" << std::endl;
+                return 1;
+            }
+            kd_tree->set_float_leaves(true);
+        }
         NN1->set_points(M.vertices.nb(), M.vertices.point_ptr(0));
         NN2->set_points(M.vertices.nb(), M.vertices.point_ptr(0));
 
@@ -124,48 +139,56 @@ int main(int argc, char** argv) {
             nb_neigh = M.vertices.nb();
         }
 
-        vector<index_t> neigh1(nb_neigh);
-        vector<double> sq_dist1(nb_neigh);
-
-        vector<index_t> neigh2(nb_neigh);
-        vector<double> sq_dist2(nb_neigh);
-
-        bool match = true;
-        for(index_t i = 0; i < M.vertices.nb(); ++i) {
-            const double* q = M.vertices.point_ptr(i);
-
-            if(by_index) {
-                NN1->get_nearest_neighbors(
-                    nb_neigh, i, neigh1.data(), sq_dist1.data()
-                );
-                NN2->get_nearest_neighbors(
-                    nb_neigh, i, neigh2.data(), sq_dist2.data()
-                );
-            } else {
-                NN1->get_nearest_neighbors(
-                    nb_neigh, q, neigh1.data(), sq_dist1.data()
-                );
-                NN2->get_nearest_neighbors(
-                    nb_neigh, q, neigh2.data(), sq_dist2.data()
-                );
+        index_t nb_points = M.vertices.nb();
+        vector<index_t> neigh1(nb_neigh * nb_points);
+        vector<double> sq_dist1(nb_neigh * nb_points);
+
+        vector<index_t> neigh2(nb_neigh * nb_points);
+        vector<double> sq_dist2(nb_neigh * nb_points);
+
+        NearestNeighborSearch* NN[2] = { NN1, NN2 };
+        index_t* neigh[2] = { neigh1.data(), neigh2.data() };
+        double* sq_dist[2] = { sq_dist1.data(), sq_dist2.data() };
+        std::string algo[2] = { NN1_algo, NN2_algo };
+
+        for(index_t k = 0; k < 2; ++k) {
+            Stopwatch W_query(algo[k]);
+            for(index_t i = 0; i < nb_points; ++i) {
+                index_t* neigh_i = neigh[k] + i * nb_neigh;
+                double* sq_dist_i = sq_dist[k] + i * nb_neigh;
+                if(by_index) {
+                    NN[k]->get_nearest_neighbors(
+                        nb_neigh, i, neigh_i, sq_dist_i
+                    );
+                } else {
+                    NN[k]->get_nearest_neighbors(
+                        nb_neigh, M.vertices.point_ptr(i),
+                        neigh_i, sq_dist_i
+                    );
+                }
             }
+        }
 
-            for(index_t j = 0; j < nb_neigh; ++j) {
-                if(sq_dist1[j] != sq_dist2[j]) {
-                    Logger::err("NN Search")
-                        << j << "th neighbor mismatches"
-                        << std::endl;
-                    match = false;
-                }
+        index_t nb_mismatches = 0;
+        for(index_t j = 0; j < nb_neigh * nb_points; ++j) {
+            if(sq_dist1[j] != sq_dist2[j]) {
+                ++nb_mismatches;
             }
         }
-        if(match) {
+        if(nb_mismatches == 0) {
             Logger::out("NN Search")
                 << NN1_algo << " and " << NN2_algo << " match."
                 << std::endl;
+        } else if(float_leaves) {
+            Logger::out("NN Search")
+                << NN1_algo << " (float leaves) and " << NN2_algo
+                << ": " << nb_mismatches << " / "
+                << nb_neigh * nb_points << " neighbors mismatch."
+                << std::endl;
         } else {
             Logger::err("NN Search")
-                << NN1_algo << " and " << NN2_algo << " mismatch."
+                << NN1_algo << " and " << NN2_algo << ": "
+                << nb_mismatches << " neighbors mismatch."
                 << std::endl;
             return 2;
         }
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2012-2014, Bruno Levy
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *  this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *  this list of conditions and the following disclaimer in the documentation
+ *  and/or other materials provided with the distribution.
+ *  * Neither the name of the ALICE Project-Team nor the names of its
+ *  contributors may be used to endorse or promote products derived from this
+ *  software without specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  If you modify this software, you should include a notice giving the
+ *  name of the person performing the modification, the date of modification,
+ *  and the reason for such modification.
+ *
+ *  Contact: Bruno Levy
+ *
+ *     Bruno.Levy@inria.fr
+ *     http://www.loria.fr/~levy
+ *
+ *     ALICE Project
+ *     LORIA, INRIA Lorraine, 
+ *     Campus Scientifique, BP 239
+ *     54506 VANDOEUVRE LES NANCY CEDEX 
+ *     FRANCE
+ *
+ */
+#include <geogram/basic/common.h>
+#include <geogram/basic/logger.h>
+#include <geogram/basic/command_line.h>
+#include <geogram/basic/command_line_args.h>
+#include <geogram/numerics/predicates.h>
+
+namespace {
+
+    using namespace GEO;
+
+    /**
+     * \brief Compares orient_3d_tet_facets_filter() and
+     *  TetFacetsOrient3d with orient_3d().
+     * \details When geogram is compiled with AVX2 support, both use
+     *  the vectorized filter.
+     * \param[in] pv the four vertices of a tetrahedron
+     * \param[in] q the query point
+     * \retval true if the predicates agree
+     * \retval false otherwise
+     */
+    bool check_tet_facets(const double* const* pv, const double* q) {
+        Sign filter[4];
+        PCK::orient_3d_tet_facets_filter(pv, q, filter);
+        PCK::TetFacetsOrient3d orient_facet(pv, q);
+        for(index_t f=0; f<4; ++f) {
+            const double* p[4] = { pv[0], pv[1], pv[2], pv[3] };
+            p[f] = q;
+            Sign expected = PCK::orient_3d(p[0], p[1], p[2], p[3]);
+            if(filter[f] != ZERO && filter[f] != expected) {
+                return false;
+            }
+            if(orient_facet(f) != expected) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace GEO;
+
+    GEO::initialize();
+
+    try {
+        CmdLine::import_arg_group("standard");
+        CmdLine::declare_arg("nb_tests", 100000, "number of tests");
+        if(!CmdLine::parse(argc, argv)) {
+            return 1;
+        }
+
+        index_t nb_tests = CmdLine::get_arg_uint("nb_tests");
+        index_t nb_errors = 0;
+        for(index_t i=0; i<nb_tests; ++i) {
+            double P[5][3];
+            for(index_t j=0; j<5; ++j) {
+                for(index_t c=0; c<3; ++c) {
+                    // Half of the tests use points on a small grid, 
+                    // to generate degenerate configurations that
+                    // exercise the exact arithmetics.
+                    P[j][c] = (i % 2 == 0) ? Numeric::random_float64() :
+                        double(Numeric::random_int32() % 3);
+                }
+            }
+            const double* pv[4] = { P[0], P[1], P[2], P[3] };
+            if(!check_tet_facets(pv, P[4])) {
+                ++nb_errors;
+            }
+        }
+        Logger::out("Predicates") << nb_errors << " errors" << std::endl;
+        if(nb_errors != 0) {
+            return 2;
+        }
+    }
+    catch(const std::exception& e) {
+        std::cerr << "Received an exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}